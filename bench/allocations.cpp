@@ -0,0 +1,131 @@
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+#include <string>
+
+#include "../src/module_input/input.h"
+#include "../src/module_output/output.h"
+#include "../src/module_parameter/parameter.h"
+#include "../src/module_weather/weather.h"
+#include "../src/module_soil/soil.h"
+#include "../src/module_management/management.h"
+#include "../src/module_init/init.h"
+#include "../src/module_step/step.h"
+#include "../src/module_context/context.h"
+#include "../src/module_plant/community.h"
+#include "../src/module_interaction/interaction.h"
+#include "../src/utils/utils.h"
+
+/**
+ * @brief Counters of the global allocation hook (number of calls to operator new and requested bytes).
+ */
+static std::size_t numberOfAllocations = 0;
+static std::size_t numberOfAllocatedBytes = 0;
+
+void *operator new(std::size_t size)
+{
+   numberOfAllocations++;
+   numberOfAllocatedBytes += size;
+   if (void *memory = std::malloc(size > 0 ? size : 1))
+   {
+      return memory;
+   }
+   throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+   std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+   std::free(memory);
+}
+
+/**
+ * @brief Counts the heap allocations of one copy of an object, i.e. the costs of passing it by value.
+ */
+template <typename T>
+void printAllocationsOfCopy(const std::string &name, const T &object)
+{
+   std::size_t allocationsBefore = numberOfAllocations;
+   std::size_t bytesBefore = numberOfAllocatedBytes;
+   {
+      T copy(object);
+   }
+   std::cout << "copy_" << name << "_allocations\t" << numberOfAllocations - allocationsBefore << std::endl;
+   std::cout << "copy_" << name << "_bytes\t" << numberOfAllocatedBytes - bytesBefore << std::endl;
+}
+
+/**
+ * @brief Benchmark of heap allocations per simulated day.
+ *
+ * Reads the input data of a simulation run exactly like the model executable, runs all
+ * day steps and counts every call to operator new during the simulation. Simulation
+ * results are kept in the output buffers but not written to files.
+ *
+ * Usage: GRASSMIND3_BENCH_ALLOCATIONS <configuration file>
+ *
+ * The results are printed as tab-separated key-value pairs. Besides the allocations per
+ * simulated day, the allocations of a single copy of the read-only simulation inputs are
+ * reported, which is what every by-value function argument of these classes costs.
+ */
+int main(int argc, char *argv[])
+{
+   if (argc < 2)
+   {
+      std::cerr << "Usage: GRASSMIND3_BENCH_ALLOCATIONS <configuration file>" << std::endl;
+      return 1;
+   }
+   std::string path = argv[1];
+
+   INPUT input;
+   OUTPUT output;
+   UTILS utils;
+   PARAMETER parameter;
+   WEATHER weather;
+   SOIL soil;
+   MANAGEMENT management;
+   ALLOMETRY allometry;
+   INIT init;
+   STEP step;
+   COMMUNITY community;
+   RECRUITMENT recruitment;
+   MORTALITY mortality;
+   GROWTH growth;
+   INTERACTION interaction;
+
+   input.getInputData(path, utils, parameter, weather, soil, management);
+   output.formatter.prepareOutputFormatter(utils, parameter);
+   init.initModelSimulation(parameter, community, recruitment, soil, interaction);
+   output.outputWritingDatesFileOpened = false; // daily results are stored in the output buffers
+
+   SIMULATIONCONTEXT context(utils, parameter, weather, management, allometry);
+
+   std::size_t allocationsBefore = numberOfAllocations;
+   std::size_t bytesBefore = numberOfAllocatedBytes;
+   auto startTime = std::chrono::steady_clock::now();
+
+   step.runModelSimulation(context, parameter, init, community, recruitment, mortality, growth, soil, interaction, output);
+
+   auto stopTime = std::chrono::steady_clock::now();
+   std::size_t allocations = numberOfAllocations - allocationsBefore;
+   std::size_t bytes = numberOfAllocatedBytes - bytesBefore;
+   double seconds = std::chrono::duration<double>(stopTime - startTime).count();
+   int days = parameter.simulationTimeInDays;
+
+   std::cout << "days\t" << days << std::endl;
+   std::cout << "allocations\t" << allocations << std::endl;
+   std::cout << "allocations_per_day\t" << (double)allocations / days << std::endl;
+   std::cout << "allocated_bytes_per_day\t" << (double)bytes / days << std::endl;
+   std::cout << "seconds_per_day\t" << seconds / days << std::endl;
+
+   printAllocationsOfCopy("parameter", parameter);
+   printAllocationsOfCopy("weather", weather);
+   printAllocationsOfCopy("management", management);
+   printAllocationsOfCopy("soil", soil);
+
+   return 0;
+}
\ No newline at end of file
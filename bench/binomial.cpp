@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+#include "../src/module_random/random.h"
+
+/**
+ * @brief Exact probability mass function of the binomial distribution, computed in log space.
+ */
+double binomialProbability(int numberOfTrials, double probability, int k)
+{
+   double logCoefficient = std::lgamma(numberOfTrials + 1.0) - std::lgamma(k + 1.0) - std::lgamma(numberOfTrials - k + 1.0);
+   return std::exp(logCoefficient + k * std::log(probability) + (numberOfTrials - k) * std::log1p(-probability));
+}
+
+/**
+ * @brief Chi-square goodness-of-fit of sampled counts against the exact binomial distribution.
+ *
+ * Classes with an expected count below 5 are pooled with their neighbours. The statistic is
+ * converted to a standard normal z-score by the Wilson-Hilferty transformation.
+ */
+double chiSquareZScore(const std::vector<long long> &observedCounts, int numberOfTrials, double probability, long long numberOfSamples)
+{
+   double chiSquare = 0.0;
+   int degreesOfFreedom = -1;
+   double pooledObserved = 0.0;
+   double pooledExpected = 0.0;
+
+   for (int k = 0; k <= numberOfTrials; k++)
+   {
+      pooledObserved += observedCounts[k];
+      pooledExpected += numberOfSamples * binomialProbability(numberOfTrials, probability, k);
+      if (pooledExpected >= 5.0)
+      {
+         chiSquare += (pooledObserved - pooledExpected) * (pooledObserved - pooledExpected) / pooledExpected;
+         degreesOfFreedom++;
+         pooledObserved = 0.0;
+         pooledExpected = 0.0;
+      }
+   }
+   chiSquare += (pooledExpected > 0.0) ? (pooledObserved - pooledExpected) * (pooledObserved - pooledExpected) / pooledExpected : 0.0;
+
+   if (degreesOfFreedom < 1)
+   {
+      return 0.0;
+   }
+   double v = degreesOfFreedom;
+   return (std::cbrt(chiSquare / v) - (1.0 - 2.0 / (9.0 * v))) / std::sqrt(2.0 / (9.0 * v));
+}
+
+/**
+ * @brief Statistical equivalence check and benchmark of basic mortality sampling.
+ *
+ * For several cohort sizes and mortality probabilities, the number of dying plants of a cohort
+ * is sampled (a) by one Bernoulli draw per plant and (b) by one binomial draw per cohort
+ * (`RANDOM::binomial`). Both sample distributions are compared with the exact binomial
+ * distribution by a chi-square goodness-of-fit test, and the runtime per cohort is reported.
+ *
+ * Usage: GRASSMIND3_BENCH_BINOMIAL [number of samples per case]
+ *
+ * The results are printed as tab-separated table. The exit code is 1 if any z-score exceeds
+ * 4 (i.e. a deviation from the binomial distribution at a significance level of about 3e-5).
+ */
+int main(int argc, char *argv[])
+{
+   long long numberOfSamples = (argc > 1) ? std::atoll(argv[1]) : 100000;
+   const std::vector<int> cohortSizes = {1, 10, 100, 1000, 10000};
+   const std::vector<double> probabilities = {0.0001, 0.02, 0.3, 0.9};
+   const unsigned int seed = 12345;
+   const double maximumZScore = 4.0;
+
+   RANDOM random;
+   bool allEquivalent = true;
+
+   std::cout << "plants\tprobability\tzPerPlant\tzBinomial\tnsPerCohortPerPlant\tnsPerCohortBinomial" << std::endl;
+   for (int numberOfTrials : cohortSizes)
+   {
+      for (double probability : probabilities)
+      {
+         // limit the number of per-plant draws of large cohorts to keep the runtime reasonable
+         long long samples = std::min(numberOfSamples, 20000000LL / numberOfTrials);
+         std::vector<long long> countsPerPlant(numberOfTrials + 1, 0);
+         std::vector<long long> countsBinomial(numberOfTrials + 1, 0);
+
+         auto startTime = std::chrono::steady_clock::now();
+         for (long long sample = 0; sample < samples; sample++)
+         {
+            int numberOfDyingPlants = 0;
+            for (int plantIndex = 0; plantIndex < numberOfTrials; plantIndex++)
+            {
+               if (random.uniform(seed, 1, sample, randomEventBasicMortality, plantIndex) <= probability)
+               {
+                  numberOfDyingPlants++;
+               }
+            }
+            countsPerPlant[numberOfDyingPlants]++;
+         }
+         auto middleTime = std::chrono::steady_clock::now();
+         for (long long sample = 0; sample < samples; sample++)
+         {
+            countsBinomial[random.binomial(numberOfTrials, probability, seed, 2, sample, randomEventBasicMortality)]++;
+         }
+         auto stopTime = std::chrono::steady_clock::now();
+
+         double zPerPlant = chiSquareZScore(countsPerPlant, numberOfTrials, probability, samples);
+         double zBinomial = chiSquareZScore(countsBinomial, numberOfTrials, probability, samples);
+         allEquivalent = allEquivalent && std::fabs(zPerPlant) < maximumZScore && std::fabs(zBinomial) < maximumZScore;
+
+         std::cout << numberOfTrials << "\t" << probability << "\t" << zPerPlant << "\t" << zBinomial << "\t";
+         std::cout << std::chrono::duration<double, std::nano>(middleTime - startTime).count() / samples << "\t";
+         std::cout << std::chrono::duration<double, std::nano>(stopTime - middleTime).count() / samples << std::endl;
+      }
+   }
+
+   std::cout << (allEquivalent ? "equivalent" : "NOT equivalent") << std::endl;
+   return allEquivalent ? 0 : 1;
+}
\ No newline at end of file
@@ -0,0 +1,154 @@
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../src/module_input/input.h"
+#include "../src/module_parameter/parameter.h"
+#include "../src/module_weather/weather.h"
+#include "../src/module_soil/soil.h"
+#include "../src/module_management/management.h"
+#include "../src/module_init/init.h"
+#include "../src/module_step/step.h"
+#include "../src/module_context/context.h"
+#include "../src/module_plant/community.h"
+#include "../src/module_interaction/interaction.h"
+#include "../src/utils/utils.h"
+
+/**
+ * @brief Summary of one simulation run of the fusion benchmark.
+ */
+struct FUSIONRUN
+{
+   double secondsPerDay = 0.0;
+   double meanNumberOfCohorts = 0.0;
+   int finalNumberOfCohorts = 0;
+   double meanNumberOfPlants = 0.0;
+   double meanShootBiomass = 0.0;
+   double meanRootBiomass = 0.0;
+};
+
+/**
+ * @brief Runs all day steps of a simulation with the given fusion settings and summarizes the community.
+ */
+FUSIONRUN runSimulation(const std::string &path, bool fusionActivated, double toleranceFactor, int maximumNumberOfCohorts)
+{
+   INPUT input;
+   UTILS utils;
+   PARAMETER parameter;
+   WEATHER weather;
+   SOIL soil;
+   MANAGEMENT management;
+   ALLOMETRY allometry;
+   INIT init;
+   STEP step;
+   COMMUNITY community;
+   RECRUITMENT recruitment;
+   MORTALITY mortality;
+   GROWTH growth;
+   INTERACTION interaction;
+
+   input.getInputData(path, utils, parameter, weather, soil, management);
+   init.initModelSimulation(parameter, community, recruitment, soil, interaction);
+
+   parameter.cohortFusionActivated = fusionActivated;
+   parameter.cohortFusionAgeTolerance = (int)std::lround(parameter.cohortFusionAgeTolerance * toleranceFactor);
+   parameter.cohortFusionHeightTolerance *= toleranceFactor;
+   parameter.cohortFusionBiomassTolerance *= toleranceFactor;
+   parameter.maximumNumberOfCohorts = maximumNumberOfCohorts;
+
+   SIMULATIONCONTEXT context(utils, parameter, weather, management, allometry);
+
+   FUSIONRUN run;
+   auto startTime = std::chrono::steady_clock::now();
+
+   for (int day = 1; day <= parameter.simulationTimeInDays; day++)
+   {
+      parameter.day = day;
+      init.initAndResetProcessVariables(parameter, recruitment, community);
+      interaction.getEnvironmentalConditionsOfDay(weather, soil, management, parameter.day);
+      step.doDayStepOfModelSimulation(context, community, recruitment, mortality, growth, interaction, soil);
+      community.updateCommunityStateVariables(parameter);
+      community.updateCommunityStateVariablesForOutput(parameter);
+
+      run.meanNumberOfCohorts += community.allPlants.size();
+      run.meanNumberOfPlants += community.totalNumberOfPlantsInCommunity;
+      for (int pft = 0; pft < parameter.pftCount; pft++)
+      {
+         run.meanShootBiomass += community.shootBiomassOfPlantsPerPFT[pft];
+         run.meanRootBiomass += community.rootBiomassOfPlantsPerPFT[pft];
+      }
+   }
+
+   auto stopTime = std::chrono::steady_clock::now();
+   int days = parameter.simulationTimeInDays;
+
+   run.secondsPerDay = std::chrono::duration<double>(stopTime - startTime).count() / days;
+   run.meanNumberOfCohorts /= days;
+   run.finalNumberOfCohorts = community.allPlants.size();
+   run.meanNumberOfPlants /= days;
+   run.meanShootBiomass /= days;
+   run.meanRootBiomass /= days;
+   return run;
+}
+
+double relativeError(double value, double reference)
+{
+   return (reference != 0.0) ? std::fabs(value - reference) / std::fabs(reference) : std::fabs(value);
+}
+
+/**
+ * @brief Benchmark of the accuracy-versus-speed tradeoff of cohort fusion.
+ *
+ * Runs the simulation of the given configuration once without cohort fusion (reference)
+ * and then with cohort fusion at multiples of the configured tolerances and with a
+ * maximum number of cohorts. For every run, the runtime per simulated day, the number of
+ * cohorts and the relative errors of the time-averaged number of plants and shoot and root
+ * biomass against the reference are printed as a tab-separated table.
+ *
+ * Note that the random numbers of stochastic events depend on the cohort ids, so that the
+ * errors also contain the stochastic differences between the trajectories.
+ *
+ * Usage: GRASSMIND3_BENCH_FUSION <configuration file>
+ */
+int main(int argc, char *argv[])
+{
+   if (argc < 2)
+   {
+      std::cerr << "Usage: GRASSMIND3_BENCH_FUSION <configuration file>" << std::endl;
+      return 1;
+   }
+   std::string path = argv[1];
+
+   FUSIONRUN reference = runSimulation(path, false, 1.0, 0);
+
+   struct SETTING
+   {
+      std::string name;
+      bool fusionActivated;
+      double toleranceFactor;
+      int maximumNumberOfCohorts;
+   };
+   std::vector<SETTING> settings = {
+       {"reference", false, 1.0, 0},
+       {"tolerance_x0.5", true, 0.5, 0},
+       {"tolerance_x1", true, 1.0, 0},
+       {"tolerance_x2", true, 2.0, 0},
+       {"tolerance_x4", true, 4.0, 0},
+       {"tolerance_x1_max10", true, 1.0, 10},
+   };
+
+   std::cout << "setting\tseconds_per_day\tspeedup\tmean_cohorts\tfinal_cohorts\terror_plants\terror_shoot_biomass\terror_root_biomass" << std::endl;
+   for (const SETTING &setting : settings)
+   {
+      FUSIONRUN run = setting.fusionActivated ? runSimulation(path, true, setting.toleranceFactor, setting.maximumNumberOfCohorts) : reference;
+      std::cout << setting.name << "\t" << run.secondsPerDay << "\t" << reference.secondsPerDay / run.secondsPerDay << "\t";
+      std::cout << run.meanNumberOfCohorts << "\t" << run.finalNumberOfCohorts << "\t";
+      std::cout << relativeError(run.meanNumberOfPlants, reference.meanNumberOfPlants) << "\t";
+      std::cout << relativeError(run.meanShootBiomass, reference.meanShootBiomass) << "\t";
+      std::cout << relativeError(run.meanRootBiomass, reference.meanRootBiomass) << std::endl;
+   }
+
+   return 0;
+}
\ No newline at end of file
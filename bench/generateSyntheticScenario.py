@@ -0,0 +1,169 @@
+"""
+Generator of synthetic but valid input files of a GRASSMIND3 simulation.
+
+Writes a configuration file, a plant traits file and weather, soil and management files
+of a synthetic site with the given number of PFTs, simulation years, external seed influx
+and mowing frequency. The configuration and plant traits files are derived from the files
+of the repository (simulations/project1, parameters/BioDT-generic); the traits of the
+three generic PFTs are repeated for all PFTs. Weather is a smooth seasonal cycle with
+random daily precipitation, the soil has uniform layers.
+
+The files are written below the root directory in the folder structure expected by the model
+(simulations/synthetic, scenarios/<site>, parameters/synthetic). As the model separates folders
+by backslashes, the folders are real directories on Windows and part of the file names otherwise,
+i.e. the model has to be run from the output directory with the printed configuration path.
+
+Usage: python generateSyntheticScenario.py <output directory> [--pfts 3] [--years 3] [--seed-influx 1] [--mowing 2] [--seed 10]
+"""
+
+import argparse
+import datetime
+import math
+import os
+import random
+
+REPOSITORY = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..")
+CONFIGURATION_TEMPLATE = os.path.join(REPOSITORY, "simulations", "project1", "lat51.391900_lon11.878700__2013-01-01_2023-12-31__configuration__generic_v1.txt")
+PLANT_TRAITS_TEMPLATE = os.path.join(REPOSITORY, "parameters", "BioDT-generic", "plant_traits__generic_v1.txt")
+
+ROOT = "grassmind"
+LATITUDE = "50.000000"
+LONGITUDE = "10.000000"
+FIRST_YEAR = 2001
+
+
+def writeInputFile(outputDirectory, folders, fileName, lines):
+    """Writes a file to the folder given as backslash-separated path as read by the model."""
+    if os.name == "nt":
+        filePath = os.path.join(outputDirectory, *folders, fileName)
+    else:
+        filePath = os.path.join(outputDirectory, "\\".join(folders) + "\\" + fileName)
+    os.makedirs(os.path.dirname(filePath), exist_ok=True)
+    with open(filePath, "w", encoding="utf-8", newline="\n") as inputFile:
+        inputFile.write("\n".join(lines) + "\n")
+
+
+def createPlantTraits(pftCount, seedInflux, firstYear):
+    """Repeats the traits of the generic PFTs for all PFTs and sets the external seed influx."""
+    with open(PLANT_TRAITS_TEMPLATE, "r", encoding="utf-8") as templateFile:
+        lines = templateFile.read().splitlines()
+
+    for i, line in enumerate(lines):
+        words = line.split()
+        if not words or line.startswith("#") or line.startswith("\\"):
+            continue
+        dataType = next((l for l in lines[i + 1 : i + 3] if l.startswith("\\datatype:")), "")
+        if words[0] == "pftCount":
+            lines[i] = f"pftCount\t{pftCount}"
+        elif words[0] == "dayOfExternalSeedInfluxStart":
+            lines[i] = f"dayOfExternalSeedInfluxStart\t{firstYear}-05-01"
+        elif words[0] == "externalSeedInfluxNumber":
+            lines[i] = "externalSeedInfluxNumber\t" + "\t".join([str(seedInflux)] * pftCount)
+        elif dataType.endswith("-array"):
+            values = words[1:]
+            lines[i] = words[0] + "\t" + "\t".join(values[pft % len(values)] for pft in range(pftCount))
+    return lines
+
+
+def createWeather(firstYear, lastYear, random):
+    """Creates a seasonal weather time series with random precipitation (latitude 50 degrees)."""
+    lines = ["Date\tPrecipitation[mm]\tTemperature[degC]\tTemperature_Daylight[degC]\tPAR[µmolm-2s-1]\tDaylength[h]\tPET[mm]"]
+    date = datetime.date(firstYear, 1, 1)
+    while date.year <= lastYear:
+        dayOfYear = date.timetuple().tm_yday
+        season = math.sin(2.0 * math.pi * (dayOfYear - 110) / 365.0)
+        declination = 23.44 * math.sin(2.0 * math.pi * (dayOfYear - 81) / 365.0)
+        dayLength = 24.0 / math.pi * math.acos(-math.tan(math.radians(float(LATITUDE))) * math.tan(math.radians(declination)))
+        temperature = 9.0 + 9.0 * season + random.gauss(0.0, 2.0)
+        precipitation = random.expovariate(0.3) if random.random() < 0.5 else 0.0
+        par = max(20.0, 300.0 + 250.0 * season + random.gauss(0.0, 60.0))
+        pet = max(0.0, 1.8 + 1.7 * season + random.gauss(0.0, 0.3))
+        lines.append(f"{date.isoformat()}\t{precipitation:.6f}\t{temperature:.6f}\t{temperature + 1.0:.6f}\t{par:.6f}\t{dayLength:.6f}\t{pet:.6f}")
+        date += datetime.timedelta(days=1)
+    return lines
+
+
+def createSoil():
+    """Creates a loamy soil of 20 uniform layers."""
+    lines = ["Silt\tClay\tSand", "0.4000\t0.2000\t0.4000", "", "Layer\tFC[V%]\tPWP[V%]\tPOR[V%]\tKS[mm/d]"]
+    for layer in range(1, 21):
+        lines.append(f"{layer:.4f}\t40.0000\t15.0000\t45.0000\t100.0000")
+    return lines
+
+
+def createManagement(firstYear, lastYear, pftCount, mowingsPerYear):
+    """Creates a yearly fertilization in April and mowing events evenly spaced from mid-May to September."""
+    seeds = "\t".join(["NaN"] * pftCount)
+    lines = ["Date\tMowHeight[m]\tFertilizer[gm-2]\tIrrigation[mm]\t" + "\t".join(f"Seeds_PFT{pft + 1}" for pft in range(pftCount)) + "\tData source"]
+    for year in range(firstYear, lastYear + 1):
+        lines.append(f"{year}-04-01\tNaN\t5.5\tNaN\t{seeds}\tsynthetic")
+        start = datetime.date(year, 5, 15)
+        interval = (datetime.date(year, 9, 30) - start).days / max(mowingsPerYear - 1, 1)
+        for mowing in range(mowingsPerYear):
+            date = start + datetime.timedelta(days=round(mowing * interval))
+            lines.append(f"{date.isoformat()}\t0.05\tNaN\tNaN\t{seeds}\tsynthetic")
+    return lines
+
+
+def createConfiguration(values):
+    """Replaces the values of the given keywords in the configuration file of project1."""
+    with open(CONFIGURATION_TEMPLATE, "r", encoding="utf-8") as templateFile:
+        lines = templateFile.read().splitlines()
+    for i, line in enumerate(lines):
+        words = line.split()
+        if words and words[0] in values:
+            lines[i] = f"{words[0]}\t{values[words[0]]}"
+    return lines
+
+
+def generateSyntheticScenario(outputDirectory, pftCount=3, years=3, seedInflux=1, mowingsPerYear=2, seed=10):
+    """Writes all input files of a synthetic scenario and returns the configuration path to be passed to the model."""
+    firstYear = FIRST_YEAR
+    lastYear = FIRST_YEAR + years - 1
+    site = f"lat{LATITUDE}_lon{LONGITUDE}"
+    period = f"{firstYear}-01-01_{lastYear}-12-31"
+    name = f"pft{pftCount}-influx{seedInflux}-mowing{mowingsPerYear}"
+
+    weatherFile = f"{site}__{period}__weather.txt"
+    soilFile = f"{site}__soil.txt"
+    managementFile = f"{site}__{period}__management__mowing{mowingsPerYear}.txt"
+    plantTraitsFile = f"synthetic/plant_traits__synthetic_{name}.txt"
+    configurationFile = f"{site}__{period}__configuration__synthetic_{name}.txt"
+
+    writeInputFile(outputDirectory, [ROOT, "scenarios", site, "weather"], weatherFile, createWeather(firstYear, lastYear, random.Random(seed)))
+    writeInputFile(outputDirectory, [ROOT, "scenarios", site, "soil"], soilFile, createSoil())
+    writeInputFile(outputDirectory, [ROOT, "scenarios", site, "management"], managementFile, createManagement(firstYear, lastYear, pftCount, mowingsPerYear))
+    writeInputFile(outputDirectory, [ROOT, "parameters"], plantTraitsFile, createPlantTraits(pftCount, seedInflux, firstYear))
+    writeInputFile(
+        outputDirectory,
+        [ROOT, "simulations", "synthetic"],
+        configurationFile,
+        createConfiguration(
+            {
+                "deimsID": "NaN",
+                "latitude": LATITUDE,
+                "longitude": LONGITUDE,
+                "firstYear": firstYear,
+                "lastYear": lastYear,
+                "weatherFile": weatherFile,
+                "soilFile": soilFile,
+                "managementFile": managementFile,
+                "plantTraitsFile": plantTraitsFile,
+                "outputWritingDatesFile": "NaN",
+                "randomNumberGeneratorSeed": seed,
+            }
+        ),
+    )
+    return "\\".join([ROOT, "simulations", "synthetic", configurationFile])
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Writes the input files of a synthetic GRASSMIND3 scenario.")
+    parser.add_argument("outputDirectory", help="directory the model is run from")
+    parser.add_argument("--pfts", type=int, default=3, help="number of plant functional types")
+    parser.add_argument("--years", type=int, default=3, help="number of simulated years")
+    parser.add_argument("--seed-influx", type=int, default=1, help="external seed influx per PFT (seeds per cm2 and day)")
+    parser.add_argument("--mowing", type=int, default=2, help="number of mowing events per year")
+    parser.add_argument("--seed", type=int, default=10, help="seed of the random number generators")
+    arguments = parser.parse_args()
+    print(generateSyntheticScenario(arguments.outputDirectory, arguments.pfts, arguments.years, arguments.seed_influx, arguments.mowing, arguments.seed))
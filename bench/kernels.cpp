@@ -0,0 +1,220 @@
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "../src/module_input/input.h"
+#include "../src/module_output/output.h"
+#include "../src/module_parameter/parameter.h"
+#include "../src/module_weather/weather.h"
+#include "../src/module_soil/soil.h"
+#include "../src/module_management/management.h"
+#include "../src/module_init/init.h"
+#include "../src/module_step/step.h"
+#include "../src/module_context/context.h"
+#include "../src/module_plant/community.h"
+#include "../src/module_interaction/interaction.h"
+#include "../src/utils/utils.h"
+
+/**
+ * @brief State of the simulation at the benchmarked day, restored before every repetition.
+ */
+struct KERNELSTATE
+{
+   COMMUNITY community;
+   RECRUITMENT recruitment;
+   MORTALITY mortality;
+   GROWTH growth;
+   SOIL soil;
+   INTERACTION interaction;
+};
+
+/**
+ * @brief Measured runtimes of one kernel (in ns per cohort and day, one value per repetition).
+ */
+struct KERNELTIMES
+{
+   std::string name;
+   std::vector<double> nsPerCohortPerDay;
+};
+
+/**
+ * @brief Replicates the cohorts of a spun-up community until it contains the given number of cohorts.
+ *
+ * Replicated cohorts get new cohort ids, i.e. their own random number streams.
+ */
+COMMUNITY createSyntheticCommunity(const COMMUNITY &spunUpCommunity, const PARAMETER &parameter, int numberOfCohorts)
+{
+   COMMUNITY community = spunUpCommunity;
+   community.allPlants.clear();
+   community.allPlants.reserve(numberOfCohorts);
+   for (int cohortIndex = 0; cohortIndex < numberOfCohorts; cohortIndex++)
+   {
+      community.allPlants.addCohort(spunUpCommunity.allPlants.getCohort(cohortIndex % spunUpCommunity.allPlants.size()));
+   }
+   community.totalNumberOfCohortsInCommunity = community.allPlants.size();
+   community.updateCommunityStateVariables(parameter);
+   community.updateCommunityStateVariablesForOutput(parameter);
+   return community;
+}
+
+/**
+ * @brief Times one call of a kernel and adds the runtime per cohort to its measurements.
+ */
+void timeKernel(KERNELTIMES &times, int numberOfCohorts, const std::function<void()> &kernel)
+{
+   auto startTime = std::chrono::steady_clock::now();
+   kernel();
+   auto stopTime = std::chrono::steady_clock::now();
+   times.nsPerCohortPerDay.push_back(std::chrono::duration<double, std::nano>(stopTime - startTime).count() / numberOfCohorts);
+}
+
+/**
+ * @brief Microbenchmark of the kernels of the day step on synthetic communities.
+ *
+ * Reads the input data of a simulation run like the model executable and simulates the
+ * days before the first mowing event of the management (or the first 180 days) to get a
+ * realistic community. Its cohorts are replicated to synthetic communities of 10 to
+ * 100,000 cohorts. For every community size, the day of the first mowing event is simulated
+ * repeatedly from the same state, and every kernel of the day step is timed separately:
+ *
+ * - recruitment: RECRUITMENT::doPlantRecruitment
+ * - mortality: MORTALITY::doPlantMortality
+ * - light: INTERACTION::calculateLightAttenuationAndAvailabilityForPlants
+ * - growth: GROWTH::doPlantGrowth, i.e. the sum of its sub-steps growth_photosynthesis,
+ *   growth_respiration, growth_npp, growth_allocation_rates, growth_allocation and growth_size_and_aging
+ * - management: MANAGEMENT::applyManagementRegime
+ * - community_aggregation: COMMUNITY::updateCommunityStateVariables and updateCommunityStateVariablesForOutput
+ * - output_buffer: STEP::saveSimulationResultsToBuffer (daily output)
+ *
+ * Cohort fusion is applied as in the simulation but not timed.
+ * Console messages of the model are written to stderr and should be redirected (e.g. `2>/dev/null`).
+ *
+ * Usage: GRASSMIND3_BENCH_KERNELS <configuration file> [maximum number of cohorts]
+ *
+ * The results are printed as a tab-separated table with one line per kernel and community
+ * size; runtimes are given in ns per cohort and simulated day (median and minimum over all
+ * repetitions), so that they can be compared across releases.
+ */
+int main(int argc, char *argv[])
+{
+   if (argc < 2)
+   {
+      std::cerr << "Usage: GRASSMIND3_BENCH_KERNELS <configuration file> [maximum number of cohorts]" << std::endl;
+      return 1;
+   }
+   std::string path = argv[1];
+   int maximumNumberOfCohorts = (argc > 2) ? std::atoi(argv[2]) : 100000;
+
+   INPUT input;
+   OUTPUT output;
+   UTILS utils;
+   PARAMETER parameter;
+   WEATHER weather;
+   SOIL soil;
+   MANAGEMENT management;
+   ALLOMETRY allometry;
+   INIT init;
+   STEP step;
+   KERNELSTATE spunUp;
+
+   input.getInputData(path, utils, parameter, weather, soil, management);
+   output.formatter.prepareOutputFormatter(utils, parameter);
+   output.outputWritingDatesFileOpened = false; // daily results are stored in the output buffers
+   spunUp.soil = soil;
+   init.initModelSimulation(parameter, spunUp.community, spunUp.recruitment, spunUp.soil, spunUp.interaction);
+
+   /* spin-up until the day before the first mowing event */
+   int benchmarkDay = std::min(180, parameter.simulationTimeInDays);
+   for (const MANAGEMENTEVENT &event : management.timeline.events)
+   {
+      if (event.action == MANAGEMENTACTION::mowing && event.day > 1 && event.day <= parameter.simulationTimeInDays)
+      {
+         benchmarkDay = event.day;
+         break;
+      }
+   }
+
+   SIMULATIONCONTEXT context(utils, parameter, weather, management, allometry);
+   for (int day = 1; day < benchmarkDay; day++)
+   {
+      parameter.day = day;
+      step.simulateDay(context, init, spunUp.community, spunUp.recruitment, spunUp.mortality, spunUp.growth, spunUp.soil, spunUp.interaction);
+   }
+   if (spunUp.community.allPlants.size() == 0)
+   {
+      std::cerr << "The community of the configuration has no cohorts at day " << benchmarkDay << "." << std::endl;
+      return 1;
+   }
+
+   std::cout << "kernel\tcohorts\tday\trepetitions\tns_per_cohort_per_day_median\tns_per_cohort_per_day_min" << std::endl;
+
+   for (int numberOfCohorts = 10; numberOfCohorts <= maximumNumberOfCohorts; numberOfCohorts *= 10)
+   {
+      KERNELSTATE initialState = spunUp;
+      initialState.community = createSyntheticCommunity(spunUp.community, parameter, numberOfCohorts);
+      int repetitions = std::max(5, std::min(1000, 1000000 / numberOfCohorts));
+
+      std::vector<KERNELTIMES> kernels = {{"recruitment", {}}, {"mortality", {}}, {"light", {}}, {"growth", {}}, {"growth_photosynthesis", {}}, {"growth_respiration", {}}, {"growth_npp", {}}, {"growth_allocation_rates", {}}, {"growth_allocation", {}}, {"growth_size_and_aging", {}}, {"management", {}}, {"community_aggregation", {}}, {"output_buffer", {}}};
+
+      for (int repetition = 0; repetition < repetitions; repetition++)
+      {
+         KERNELSTATE state = initialState;
+         COMMUNITY &community = state.community;
+         parameter.day = benchmarkDay;
+         init.initAndResetProcessVariables(parameter, state.recruitment, community);
+         state.interaction.getEnvironmentalConditionsOfDay(weather, state.soil, management, parameter.day);
+
+         timeKernel(kernels[0], numberOfCohorts, [&]()
+                    { state.recruitment.doPlantRecruitment(utils, parameter, allometry, community, management, state.soil); });
+         timeKernel(kernels[1], numberOfCohorts, [&]()
+                    { state.mortality.doPlantMortality(utils, parameter, community, allometry, state.interaction, state.soil); });
+         step.fusion.doCohortFusion(utils, parameter, community);
+         timeKernel(kernels[2], numberOfCohorts, [&]()
+                    { state.interaction.calculateLightAttenuationAndAvailabilityForPlants(utils, parameter, community, state.interaction.fullSunLight); });
+
+         /* sub-steps in the order of GROWTH::doPlantGrowth */
+         timeKernel(kernels[4], numberOfCohorts, [&]()
+                    { state.growth.doPlantPhotosynthesis(parameter, community, state.interaction); });
+         timeKernel(kernels[5], numberOfCohorts, [&]()
+                    { state.growth.doPlantRespiration(community, parameter, state.interaction); });
+         timeKernel(kernels[6], numberOfCohorts, [&]()
+                    { state.growth.calculatePlantNPPFromGPPAndRespiration(community, parameter); });
+         timeKernel(kernels[7], numberOfCohorts, [&]()
+                    { state.growth.adjustAllocationRates(utils, parameter, community); });
+         timeKernel(kernels[8], numberOfCohorts, [&]()
+                    { state.growth.doPlantNPPAllocation(utils, parameter, community, state.soil); });
+         timeKernel(kernels[9], numberOfCohorts, [&]()
+                    { state.growth.doPlantGrowthInSizeAndAging(utils, parameter, community, allometry); });
+         double growthTime = 0.0;
+         for (int subStep = 4; subStep <= 9; subStep++)
+         {
+            growthTime += kernels[subStep].nsPerCohortPerDay.back();
+         }
+         kernels[3].nsPerCohortPerDay.push_back(growthTime);
+
+         timeKernel(kernels[10], numberOfCohorts, [&]()
+                    { management.applyManagementRegime(utils, community, allometry, parameter); });
+         timeKernel(kernels[11], numberOfCohorts, [&]()
+                    { community.updateCommunityStateVariables(parameter);
+                      community.updateCommunityStateVariablesForOutput(parameter); });
+         timeKernel(kernels[12], numberOfCohorts, [&]()
+                    { step.saveSimulationResultsToBuffer(context, community, output); });
+         output.bufferCommunity.clear();
+         output.bufferPFTPopulation.clear();
+         output.bufferPlant.clear();
+      }
+
+      for (auto &kernel : kernels)
+      {
+         std::vector<double> &times = kernel.nsPerCohortPerDay;
+         std::sort(times.begin(), times.end());
+         std::cout << kernel.name << "\t" << numberOfCohorts << "\t" << benchmarkDay << "\t" << repetitions << "\t" << times[times.size() / 2] << "\t" << times.front() << std::endl;
+      }
+   }
+
+   return 0;
+}
@@ -0,0 +1,120 @@
+"""
+End-to-end scaling benchmark of GRASSMIND3 on synthetic scenarios.
+
+Generates synthetic scenarios (see generateSyntheticScenario.py) for every combination of the
+given numbers of PFTs, simulation years, external seed influxes and mowing frequencies, runs
+the model executable on each of them and reports per run:
+
+- wall_seconds: wall-clock time of the model run
+- peak_rss_mb: peak resident set size of the model process (only on Linux/macOS)
+- output_bytes: size of all output files of the run
+- max_cohorts: maximum number of plant cohorts of a day
+- cohorts_end_of_year: number of plant cohorts on December 31 of every simulated year
+
+The results are printed as a tab-separated table and optionally written as JSON file. Output
+files are removed after each run unless --keep-output is given.
+
+Usage: python scalingBenchmark.py <GRASSMIND3 executable> <work directory> [--pfts 3,12,48] [--years 1,5,20] [--seed-influx 1,10] [--mowing 2] [--json results.json]
+"""
+
+import argparse
+import itertools
+import json
+import os
+import subprocess
+import sys
+import time
+
+from generateSyntheticScenario import generateSyntheticScenario
+
+
+def runModel(executable, workDirectory, configurationPath):
+    """Runs the model and returns its wall time (in s) and peak RSS (in MB, NaN if not available)."""
+    startTime = time.perf_counter()
+    process = subprocess.Popen([executable, configurationPath], cwd=workDirectory, stdout=subprocess.DEVNULL, stderr=subprocess.DEVNULL)
+    if hasattr(os, "wait4"):
+        _, status, usage = os.wait4(process.pid, 0)
+        process.returncode = os.waitstatus_to_exitcode(status)
+        peakRss = usage.ru_maxrss / (1024.0 * 1024.0 if sys.platform == "darwin" else 1024.0)
+    else:
+        process.wait()
+        peakRss = float("nan")
+    wallTime = time.perf_counter() - startTime
+    if process.returncode != 0:
+        raise RuntimeError(f"{executable} {configurationPath} failed with exit code {process.returncode}")
+    return wallTime, peakRss
+
+
+def findOutputFiles(workDirectory, configurationPath):
+    """Returns the output files of a run, named by the simulation period and the plant traits file of the configuration."""
+    folders, configurationFile = configurationPath.rsplit("\\", 1)
+    period = configurationFile.split("__")[1]
+    ending = "synthetic_" + configurationFile.split("__configuration__synthetic_")[1]
+    outputFolder = folders + "\\output"
+    if os.name == "nt":
+        directory, prefix = os.path.join(workDirectory, *outputFolder.split("\\")), ""
+    else:
+        directory, prefix = workDirectory, outputFolder + "\\"
+    return [os.path.join(directory, name) for name in os.listdir(directory) if name.startswith(prefix) and f"__{period}__" in name and "__output" in name and name.endswith(ending)]
+
+
+def countCohortsPerDay(plantOutputFile):
+    """Counts the rows (plant cohorts) per date of the plant output file."""
+    cohortsPerDate = {}
+    with open(plantOutputFile, "r", encoding="utf-8") as outputFile:
+        next(outputFile, None)  # skip header line
+        for line in outputFile:
+            date = line[: line.find("\t")]
+            cohortsPerDate[date] = cohortsPerDate.get(date, 0) + 1
+    return cohortsPerDate
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description="Runs GRASSMIND3 on a grid of synthetic scenarios and reports runtime, memory, cohorts and output size.")
+    parser.add_argument("executable", help="GRASSMIND3 executable")
+    parser.add_argument("workDirectory", help="directory of the generated input and output files")
+    parser.add_argument("--pfts", default="3,12,48", help="comma-separated numbers of PFTs")
+    parser.add_argument("--years", default="1,5,20", help="comma-separated numbers of simulated years")
+    parser.add_argument("--seed-influx", default="1,10", help="comma-separated external seed influxes")
+    parser.add_argument("--mowing", default="2", help="comma-separated numbers of mowing events per year")
+    parser.add_argument("--seed", type=int, default=10, help="seed of the random number generators")
+    parser.add_argument("--json", help="file the results are written to as JSON")
+    parser.add_argument("--keep-output", action="store_true", help="keep the output files of the runs")
+    arguments = parser.parse_args()
+
+    executable = os.path.abspath(arguments.executable)
+    os.makedirs(arguments.workDirectory, exist_ok=True)
+    grid = itertools.product(*[[int(value) for value in values.split(",")] for values in (arguments.pfts, arguments.years, arguments.seed_influx, arguments.mowing)])
+
+    results = []
+    print("pfts\tyears\tseed_influx\tmowing\twall_seconds\tpeak_rss_mb\toutput_bytes\tmax_cohorts\tcohorts_end_of_year", flush=True)
+    for pftCount, years, seedInflux, mowingsPerYear in grid:
+        configurationPath = generateSyntheticScenario(arguments.workDirectory, pftCount, years, seedInflux, mowingsPerYear, arguments.seed)
+        wallTime, peakRss = runModel(executable, arguments.workDirectory, configurationPath)
+
+        outputFiles = findOutputFiles(arguments.workDirectory, configurationPath)
+        outputBytes = sum(os.path.getsize(outputFile) for outputFile in outputFiles)
+        plantOutputFile = next(outputFile for outputFile in outputFiles if "__outputPlant__" in outputFile)
+        cohortsPerDate = countCohortsPerDay(plantOutputFile)
+        cohortsEndOfYear = [cohorts for date, cohorts in cohortsPerDate.items() if date.endswith("-12-31")]
+        if not arguments.keep_output:
+            for outputFile in outputFiles:
+                os.remove(outputFile)
+
+        result = {
+            "pfts": pftCount,
+            "years": years,
+            "seed_influx": seedInflux,
+            "mowing": mowingsPerYear,
+            "wall_seconds": wallTime,
+            "peak_rss_mb": peakRss,
+            "output_bytes": outputBytes,
+            "max_cohorts": max(cohortsPerDate.values(), default=0),
+            "cohorts_end_of_year": cohortsEndOfYear,
+        }
+        results.append(result)
+        print(f"{pftCount}\t{years}\t{seedInflux}\t{mowingsPerYear}\t{wallTime:.3f}\t{peakRss:.1f}\t{outputBytes}\t{result['max_cohorts']}\t{','.join(map(str, cohortsEndOfYear))}", flush=True)
+
+    if arguments.json:
+        with open(arguments.json, "w", encoding="utf-8") as jsonFile:
+            json.dump(results, jsonFile, indent=2)
@@ -0,0 +1,72 @@
+#include <iostream>
+#include <string>
+
+#include "../src/module_input/input.h"
+#include "../src/module_parameter/parameter.h"
+#include "../src/module_weather/weather.h"
+#include "../src/module_soil/soil.h"
+#include "../src/module_management/management.h"
+#include "../src/module_simulation/simulation.h"
+#include "../src/utils/utils.h"
+
+/**
+ * @brief Example of the library interface: a simulation driven step-wise from in-memory inputs.
+ *
+ * The parameters, soil and management are read once from the files of a configuration like the
+ * model executable. The weather is then copied into a new `WEATHER` object that only holds the
+ * daily weather data (without daily driver table), as filled by a program that gets the weather
+ * from elsewhere. The simulation is stepped year by year and the shoot biomass per PFT is printed.
+ *
+ * Console messages of the model are written to stderr and should be redirected (e.g. `2>/dev/null`).
+ *
+ * Usage: GRASSMIND3_EXAMPLE_SIMULATION <configuration file> [days per step]
+ */
+int main(int argc, char *argv[])
+{
+   if (argc < 2)
+   {
+      std::cerr << "Usage: GRASSMIND3_EXAMPLE_SIMULATION <configuration file> [days per step]" << std::endl;
+      return 1;
+   }
+   std::string path = argv[1];
+   int daysPerStep = (argc > 2) ? std::stoi(argv[2]) : 365;
+
+   INPUT input;
+   UTILS utils;
+   PARAMETER parameter;
+   WEATHER weatherFromFiles;
+   SOIL soil;
+   MANAGEMENT management;
+   input.getInputData(path, utils, parameter, weatherFromFiles, soil, management);
+
+   /* in-memory weather data */
+   WEATHER weather;
+   weather.weatherDates = weatherFromFiles.weatherDates;
+   weather.precipitation = weatherFromFiles.precipitation;
+   weather.fullDayAirTemperature = weatherFromFiles.fullDayAirTemperature;
+   weather.dayTimeAirTemperature = weatherFromFiles.dayTimeAirTemperature;
+   weather.photosyntheticPhotonFluxDensity = weatherFromFiles.photosyntheticPhotonFluxDensity;
+   weather.potEvapoTranspiration = weatherFromFiles.potEvapoTranspiration;
+   weather.dayLength = weatherFromFiles.dayLength;
+
+   SIMULATION simulation(parameter, weather, soil, management);
+   std::cout << "Day\tNumberCohorts";
+   for (int pft = 0; pft < parameter.pftCount; pft++)
+   {
+      std::cout << "\tShootBiomassPFT" << pft;
+   }
+   std::cout << std::endl;
+
+   while (!simulation.isFinished())
+   {
+      simulation.step(daysPerStep);
+      const COMMUNITY &community = simulation.getCommunity();
+      std::cout << simulation.getDay() << "\t" << simulation.getCohorts().size();
+      for (int pft = 0; pft < parameter.pftCount; pft++)
+      {
+         std::cout << "\t" << community.shootBiomassOfPlantsPerPFT[pft];
+      }
+      std::cout << std::endl;
+   }
+   return 0;
+}
@@ -0,0 +1,269 @@
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <charconv>
+#include <cstdlib>
+#include <cstring>
+
+#include "module_output/columnarbuffer.h"
+#include "module_output/columnarreader.h"
+#include "module_output/outputformatter.h"
+#include "module_output/output.h"
+
+/**
+ * @brief Splits a line of a text output file into its tab-separated fields.
+ */
+static void splitLine(const std::string &line, std::vector<std::string> &fields)
+{
+   fields.clear();
+   std::size_t begin = 0;
+   std::size_t end = line.find('\t');
+   while (end != std::string::npos)
+   {
+      fields.push_back(line.substr(begin, end - begin));
+      begin = end + 1;
+      end = line.find('\t', begin);
+   }
+   fields.push_back(line.substr(begin));
+}
+
+/**
+ * @brief Checks if a field of a text output file is an integral number fitting into `int32`.
+ */
+static bool isIntegral(const std::string &field)
+{
+   std::int32_t value;
+   auto result = std::from_chars(field.data(), field.data() + field.size(), value);
+   return result.ec == std::errc() && result.ptr == field.data() + field.size();
+}
+
+/**
+ * @brief Reads the next line of a text output file without the line ending.
+ */
+static bool readLine(std::ifstream &file, std::string &line)
+{
+   if (!std::getline(file, line))
+   {
+      return false;
+   }
+   if (!line.empty() && line.back() == '\r')
+   {
+      line.pop_back();
+   }
+   return true;
+}
+
+/**
+ * @brief Returns the output level (community, PFT or plant) of an output file named by the model, empty otherwise.
+ */
+static std::string getLevelOfOutputFile(const std::string &fileName)
+{
+   if (fileName.find("__outputCommunity__") != std::string::npos)
+   {
+      return "community";
+   }
+   if (fileName.find("__outputPFT__") != std::string::npos)
+   {
+      return "PFT";
+   }
+   if (fileName.find("__outputPlant__") != std::string::npos)
+   {
+      return "plant";
+   }
+   return "";
+}
+
+/**
+ * @brief Converts a text output file into a columnar output file.
+ *
+ * The types of the columns are those of the columnar output files written by the model for
+ * the output level (see `OUTPUT::getColumnTypesOfOutputFile()`), so that converted and native
+ * files have the same schema. The values are stored in blocks of `blockSizeInBytes`.
+ *
+ * @param level Output level of the file (community, PFT or plant).
+ * @return 0 on success, 1 otherwise.
+ */
+static int convertTextToColumnar(const std::string &inputFile, const std::string &outputFile, const std::string &level, std::size_t blockSizeInBytes)
+{
+   std::ifstream input(inputFile);
+   std::string line;
+   if (!input.is_open() || !readLine(input, line) || line.rfind("Date\tDayCount", 0) != 0)
+   {
+      std::cerr << "The file " << inputFile << " is not a text output file of the model (header Date, DayCount, ...)." << std::endl;
+      return 1;
+   }
+   if (level != "community" && level != "PFT" && level != "plant")
+   {
+      std::cerr << "The output level of " << inputFile << " is unknown. Keep the file name of the model or give the level with --level community, PFT or plant." << std::endl;
+      return 1;
+   }
+   COLUMNARBUFFER columns;
+   columns.setColumnNames(line);
+   const std::vector<COLUMNTYPE> columnTypes = OUTPUT::getColumnTypesOfOutputFile(level, columns.columnNames);
+   const std::size_t numberOfFields = columns.columnNames.size() + 1;
+
+   std::ofstream output(outputFile, std::ios::binary);
+   if (!output.is_open())
+   {
+      std::cerr << "The file " << outputFile << " cannot be written." << std::endl;
+      return 1;
+   }
+   std::string buffer;
+   columns.appendFileHeader(buffer);
+
+   std::vector<std::string> fields;
+   std::uint64_t lineNumber = 1;
+   while (readLine(input, line))
+   {
+      lineNumber++;
+      splitLine(line, fields);
+      if (fields.size() != numberOfFields)
+      {
+         std::cerr << "Line " << lineNumber << " of " << inputFile << " has " << fields.size() << " instead of " << numberOfFields << " fields." << std::endl;
+         return 1;
+      }
+      columns.beginRow(fields[0], std::atoi(fields[1].c_str()));
+      for (std::size_t column = 0; column < columnTypes.size(); column++)
+      {
+         const std::string &field = fields[column + 1];
+         if (columnTypes[column] == COLUMNTYPE::int32)
+         {
+            if (!isIntegral(field))
+            {
+               std::cerr << "The value " << field << " of the integral column " << columns.columnNames[column] << " in line " << lineNumber << " of " << inputFile << " is not an integral number." << std::endl;
+               return 1;
+            }
+            columns.appendValue(column, static_cast<std::int32_t>(std::atol(field.c_str())));
+         }
+         else
+         {
+            columns.appendValue(column, std::strtod(field.c_str(), nullptr));
+         }
+      }
+      if (columns.size() >= blockSizeInBytes)
+      {
+         columns.moveBlockToBuffer(buffer);
+         output.write(buffer.data(), buffer.size());
+         buffer.clear();
+      }
+   }
+   columns.moveBlockToBuffer(buffer);
+   output.write(buffer.data(), buffer.size());
+   return output.good() ? 0 : 1;
+}
+
+/**
+ * @brief Converts a columnar output file into a text output file.
+ *
+ * Floating point values are written with `significantDigits` significant digits, so that the
+ * text output file of a run is reproduced from its columnar output file.
+ *
+ * @return 0 on success, 1 otherwise.
+ */
+static int convertColumnarToText(const std::string &inputFile, const std::string &outputFile, int significantDigits)
+{
+   COLUMNARREADER reader;
+   if (!reader.open(inputFile))
+   {
+      std::cerr << reader.errorMessage << std::endl;
+      return 1;
+   }
+   std::ofstream output(outputFile, std::ios::binary);
+   if (!output.is_open())
+   {
+      std::cerr << "The file " << outputFile << " cannot be written." << std::endl;
+      return 1;
+   }
+
+   OUTPUTFORMATTER formatter;
+   formatter.significantDigits = significantDigits;
+   std::string buffer = "Date";
+   for (const auto &name : reader.getColumnNames())
+   {
+      buffer += "\t" + name;
+   }
+   buffer += "\n";
+
+   const std::size_t numberOfColumns = reader.getColumnNames().size();
+   for (const auto &block : reader.getBlocks())
+   {
+      std::uint32_t day = 0;
+      for (std::uint32_t row = 0; row < block.numberOfRows; row++)
+      {
+         while (day + 1 < block.numberOfDays && block.dayIndex[day + 1].firstRow <= row)
+         {
+            day++;
+         }
+         buffer.append(block.dayIndex[day].date, strnlen(block.dayIndex[day].date, sizeof(block.dayIndex[day].date)));
+         for (std::size_t column = 0; column < numberOfColumns; column++)
+         {
+            buffer.push_back('\t');
+            if (block.columnTypes[column] == COLUMNTYPE::int32)
+            {
+               formatter.appendValue(buffer, reinterpret_cast<const std::int32_t *>(block.columnValues[column])[row]);
+            }
+            else
+            {
+               formatter.appendValue(buffer, reinterpret_cast<const double *>(block.columnValues[column])[row]);
+            }
+         }
+         buffer.push_back('\n');
+      }
+      output.write(buffer.data(), buffer.size());
+      buffer.clear();
+   }
+   output.write(buffer.data(), buffer.size());
+   return output.good() ? 0 : 1;
+}
+
+/**
+ * @brief Converts output files of the model between the text and the columnar format.
+ *
+ * Usage: `GRASSMIND3_CONVERT <input file> <output file> [--digits <n>] [--block-size <kB>] [--level <level>]`
+ *
+ * Columnar output files (see module_output/columnarformat.h) are converted to text output files
+ * with `--digits` significant digits (default 6, see `outputSignificantDigits`). Text output files
+ * (community, PFT or plant level) are converted to columnar output files with blocks of
+ * `--block-size` kB (default 1024). The output level, which determines the types of the columns,
+ * is taken from the file name given by the model or from `--level` (community, PFT or plant).
+ *
+ * @return 0 on success, 1 otherwise.
+ */
+int main(int argc, char *argv[])
+{
+   std::vector<std::string> arguments(argv + 1, argv + argc);
+   if (arguments.size() < 2)
+   {
+      std::cerr << "Usage: GRASSMIND3_CONVERT <input file> <output file> [--digits <n>] [--block-size <kB>] [--level <level>]" << std::endl;
+      return 1;
+   }
+   int significantDigits = 6;
+   std::size_t blockSizeInBytes = 1024 * 1024;
+   std::string level = getLevelOfOutputFile(arguments[0]);
+   for (std::size_t it = 2; it + 1 < arguments.size(); it += 2)
+   {
+      if (arguments[it] == "--digits")
+      {
+         significantDigits = std::atoi(arguments[it + 1].c_str());
+      }
+      else if (arguments[it] == "--block-size")
+      {
+         blockSizeInBytes = static_cast<std::size_t>(std::atol(arguments[it + 1].c_str())) * 1024;
+      }
+      else if (arguments[it] == "--level")
+      {
+         level = arguments[it + 1];
+      }
+   }
+
+   std::ifstream input(arguments[0], std::ios::binary);
+   char magic[sizeof(COLUMNARFORMAT::fileMagic)] = {};
+   input.read(magic, sizeof(magic));
+   input.close();
+   if (std::memcmp(magic, COLUMNARFORMAT::fileMagic, sizeof(magic)) == 0)
+   {
+      return convertColumnarToText(arguments[0], arguments[1], significantDigits);
+   }
+   return convertTextToColumnar(arguments[0], arguments[1], level, blockSizeInBytes);
+}
@@ -10,8 +10,13 @@
 #include "module_management/management.h"
 #include "module_init/init.h"
 #include "module_step/step.h"
+#include "module_context/context.h"
 #include "module_plant/community.h"
 #include "module_interaction/interaction.h"
+#include "module_ensemble/ensemble.h"
+#include "module_batch/batch.h"
+#include "module_fork/fork.h"
+#include "module_profile/trace.h"
 #include "utils/utils.h"
 
 #include "module_recruitment/recruitment.h"
@@ -37,6 +42,16 @@
  *  - Running the simulation for each day.
  *  - Writing the results to output files.
  *  - Closing output files and printing runtime information.
+ *
+ * With the option `--seeds <list>` (and optionally `--threads <n>`), replicated simulations
+ * with the given seeds are run in-process on shared inputs (see `ENSEMBLE`). With the option
+ * `--batch <manifest file>`, the jobs of several sites listed in the manifest file are run
+ * on a work-stealing pool of worker threads (see `BATCH`). With the option `--resume <snapshot file>`,
+ * a single run continues from a snapshot of its simulation state (see `CHECKPOINT`). With the options
+ * `--branch-date <date> --branches <management files>`, several management scenarios branch from one
+ * shared spin-up simulation (see `FORK`). With the option `--profile [report file]`, the runtimes of
+ * the phases of a single run are reported (see `PROFILER`). With the option `--trace <file>`, a timeline
+ * of the phases of all runs is written in the Chrome trace format (see `TRACE`).
  */
 int main(int argc, char *argv[])
 {
@@ -73,48 +88,137 @@ int main(int argc, char *argv[])
    MORTALITY mortality;
    GROWTH growth;
    INTERACTION interaction;
+   ENSEMBLE ensemble;
+   BATCH batch;
+   FORK fork;
 
    /**
-    * @brief Reads data from input files (weather, soil, management, plant traits).
-    *
-    * @param path The path to the input data files.
-    * @param utils Utility class for helper functions.
-    * @param parameter Contains the parameters for the simulation.
-    * @param weather Weather data required for the simulation.
-    * @param soil Soil data for the simulation.
-    * @param management Management actions to be simulated.
-    */
-   input.getInputData(path, utils, parameter, weather, soil, management);
-
-   /**
-    * @brief Initializes variables and sets up initial conditions for the simulation.
-    */
-   init.initModelSimulation(parameter, community, recruitment, soil, interaction);
-
-   /**
-    * @brief Prepares output files for writing simulation results.
+    * @brief Reads the ensemble, batch, fork, resume, profile and trace options (--seeds, --batch, --branches, --branch-date, --threads, --resume, --profile, --trace) from the command line.
     */
-   output.prepareModelOutput(path, utils, parameter);
-
-   /**
-    * @brief Prints a summary of the simulation settings to the console.
-    */
-   output.printSimulationSettingsToConsole(parameter, input);
-
-   /**
-    * @brief Runs the model simulation for each day.
-    */
-   step.runModelSimulation(utils, parameter, init, allometry, community, recruitment, mortality, growth, management, soil, weather, interaction, output);
+   if (!ensemble.readCommandLineOptions(commandLineInput, utils) || !batch.readCommandLineOptions(commandLineInput, utils) || !fork.readCommandLineOptions(commandLineInput, utils) || !step.checkpoint.readCommandLineOptions(commandLineInput, utils) || !step.profiler.readCommandLineOptions(commandLineInput, utils) || !TRACE::readCommandLineOptions(commandLineInput, utils))
+   {
+      return 1;
+   }
+   if (step.checkpoint.resumeFile != "" && (ensemble.ensembleActivated || batch.batchActivated || fork.forkActivated))
+   {
+      utils.handleError("The --resume option can only be used for single simulation runs.");
+      return 1;
+   }
+   if (step.profiler.profilingActivated && (ensemble.ensembleActivated || batch.batchActivated || fork.forkActivated))
+   {
+      utils.handleError("The --profile option can only be used for single simulation runs.");
+      return 1;
+   }
+   if (fork.forkActivated && (ensemble.ensembleActivated || batch.batchActivated))
+   {
+      utils.handleError("The --branches option cannot be combined with the --seeds or --batch option.");
+      return 1;
+   }
 
-   /**
-    * @brief Writes the daily simulation results to output files.
-    */
-   output.writeSimulationResultsToOutputFiles(utils);
+   if (batch.batchActivated)
+   {
+      /**
+       * @brief Runs the jobs of the manifest file, each job reading its own input data.
+       */
+      batch.runBatch(utils);
+   }
+   else
+   {
+      /**
+       * @brief Reads data from input files (weather, soil, management, plant traits).
+       *
+       * @param path The path to the input data files.
+       * @param utils Utility class for helper functions.
+       * @param parameter Contains the parameters for the simulation.
+       * @param weather Weather data required for the simulation.
+       * @param soil Soil data for the simulation.
+       * @param management Management actions to be simulated.
+       */
+      {
+         SCOPEDTIMER timer(step.profiler, PHASE::input);
+         input.getInputData(path, utils, parameter, weather, soil, management);
+      }
+
+      if (ensemble.ensembleActivated)
+      {
+         /**
+          * @brief Runs the replicates of the ensemble on the inputs read once, each writing its own output files.
+          */
+         output.openAndReadOutputWritingDates(path, utils, parameter);
+         output.printSimulationSettingsToConsole(parameter, input);
+         ensemble.runEnsemble(path, utils, parameter, weather, soil, management, allometry, output);
+      }
+      else if (fork.forkActivated)
+      {
+         /**
+          * @brief Simulates the spin-up once and the management branches from its final state, each writing its own output files.
+          */
+         output.openAndReadOutputWritingDates(path, utils, parameter);
+         output.printSimulationSettingsToConsole(parameter, input);
+         fork.runFork(path, utils, parameter, weather, soil, management, allometry, output);
+      }
+      else
+      {
+         /**
+          * @brief Initializes variables and sets up initial conditions for the simulation.
+          */
+         init.initModelSimulation(parameter, community, recruitment, soil, interaction);
+
+         /**
+          * @brief Restores the simulation state of a snapshot (--resume option).
+          */
+         if (step.checkpoint.resumeFile != "" && !step.checkpoint.loadSnapshot(utils, parameter, community, recruitment, soil, output))
+         {
+            return 1;
+         }
+
+         /**
+          * @brief Prepares output files for writing simulation results.
+          */
+         if (!output.prepareModelOutput(path, utils, parameter))
+         {
+            return 1;
+         }
+
+         /**
+          * @brief Prints a summary of the simulation settings to the console.
+          */
+         output.printSimulationSettingsToConsole(parameter, input);
+
+         /**
+          * @brief Bundles the read-only inputs of the simulation run, passed by const reference through all day steps.
+          */
+         SIMULATIONCONTEXT context(utils, parameter, weather, management, allometry);
+
+         /**
+          * @brief Runs the model simulation for each day.
+          */
+         step.runModelSimulation(context, parameter, init, community, recruitment, mortality, growth, soil, interaction, output);
+
+         /**
+          * @brief Writes the daily simulation results to output files and closes them.
+          */
+         {
+            SCOPEDTIMER timer(step.profiler, PHASE::outputWriting);
+            output.writeSimulationResultsToOutputFiles(utils);
+            output.closeOutputFiles(utils);
+         }
+
+         /**
+          * @brief Reports the runtimes of the phases of the run (--profile option).
+          */
+         if (step.profiler.profilingActivated)
+         {
+            step.profiler.printReportToConsole();
+            step.profiler.writeJsonReport((step.profiler.reportFile != "") ? step.profiler.reportFile : output.profileFile, utils);
+         }
+      }
+   }
 
    /**
-    * @brief Closes the output files after writing the results.
+    * @brief Writes the timeline of the simulation phases (--trace option).
     */
-   output.closeOutputFiles(utils);
+   TRACE::writeTraceFile(utils);
 
    /**
     * @brief Stops tracking the computational runtime.
@@ -143,5 +247,5 @@ int main(int argc, char *argv[])
    std::cout << std::endl;
    std::cout << "********************************************" << std::endl;
 
-   return 0;
+   return (batch.numberOfFailedTasks > 0 || !ensemble.failedReplicates.empty() || !fork.failedBranches.empty()) ? 1 : 0;
 }
\ No newline at end of file
@@ -0,0 +1,245 @@
+#include "batch.h"
+#include "../module_ensemble/workerpool.h"
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <set>
+#include <thread>
+
+BATCH::BATCH()
+{
+   batchActivated = false;
+   numberOfThreads = 0;
+   numberOfFailedTasks = 0;
+};
+
+BATCH::~BATCH() {};
+
+/**
+ * @brief Reads the batch options `--batch <manifest file>` and `--threads <n>` from the command line.
+ *
+ * @param commandLineInput Command line arguments.
+ * @param utils Utility functions for error handling.
+ * @return False if an option is invalid.
+ */
+bool BATCH::readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils)
+{
+   if (commandLineInput.size() < 2 || commandLineInput[1] != "--batch")
+   {
+      return true;
+   }
+   if (commandLineInput.size() < 3)
+   {
+      utils.handleError("The --batch option requires a manifest file.");
+      return false;
+   }
+   batchActivated = true;
+   manifestFile = commandLineInput[2];
+
+   for (std::size_t it = 3; it < commandLineInput.size(); it++)
+   {
+      if (commandLineInput[it] == "--threads" && it + 1 < commandLineInput.size())
+      {
+         if (!WORKERPOOL::readNumberOfThreads(commandLineInput[++it], utils, numberOfThreads))
+         {
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
+/**
+ * @brief Reads the jobs from the manifest file.
+ *
+ * @param utils Utility functions for splitting strings and error handling.
+ * @return False if the manifest file cannot be opened or contains an invalid job.
+ */
+bool BATCH::openAndReadManifestFile(UTILS utils)
+{
+   std::ifstream file(manifestFile);
+   if (!file.is_open())
+   {
+      utils.handleError("The manifest file " + manifestFile + " cannot be opened.");
+      return false;
+   }
+
+   /* configuration files are given relative to the directory of the manifest file */
+   std::string manifestDirectory = "";
+   utils.strings.clear();
+   utils.splitString(manifestFile, '\\');
+   for (int it = 0; it < (int)utils.strings.size() - 1; it++)
+   {
+      manifestDirectory = manifestDirectory + utils.strings.at(it) + "\\";
+   }
+
+   const std::vector<std::string> overriddenParameters = {"firstYear", "lastYear", "managementFile", "plantTraitsFile"};
+   std::string line;
+   int m = 0; // current line number in parser
+   jobs.clear();
+   while (std::getline(file, line))
+   {
+      m++;
+      if (!line.empty() && line.back() == '\r')
+      {
+         line.pop_back();
+      }
+      if (m == 1 || line.empty())
+      { // skip header line and empty lines
+         continue;
+      }
+
+      utils.strings.clear();
+      utils.splitString(line, '\t');
+      if (utils.strings.size() != 6)
+      {
+         utils.handleError("Line " + std::to_string(m) + " of the manifest file does not contain the 6 columns configurationFile, firstYear, lastYear, managementFile, plantTraitsFile and seeds.");
+         return false;
+      }
+
+      BATCHJOB &job = jobs.emplace_back();
+      job.configurationFile = manifestDirectory + utils.strings.at(0);
+      for (std::size_t column = 0; column < overriddenParameters.size(); column++)
+      {
+         const std::string &value = utils.strings.at(column + 1);
+         if (value != "NaN")
+         {
+            job.parameterOverrides.push_back({overriddenParameters[column], value});
+         }
+      }
+      job.seedList = utils.strings.at(5);
+      if (job.seedList != "NaN" && !job.replicates.parseSeedList(job.seedList))
+      {
+         utils.handleError("The seeds " + job.seedList + " in line " + std::to_string(m) + " of the manifest file are invalid (e.g. 0-10 or 1,3,5-8).");
+         return false;
+      }
+   }
+   return !jobs.empty();
+}
+
+/**
+ * @brief Reads the input data of all jobs (in parallel, one job per task).
+ *
+ * @param utils Utility functions shared by all jobs.
+ */
+void BATCH::readInputDataOfJobs(const UTILS &utils)
+{
+   std::vector<std::function<void()>> tasks;
+   for (auto &job : jobs)
+   {
+      tasks.push_back([&job, &utils]()
+                      {
+                         job.input.parameterOverrides = job.parameterOverrides;
+                         job.input.getInputData(job.configurationFile, utils, job.parameter, job.weather, job.soil, job.management);
+                         job.output.openAndReadOutputWritingDates(job.configurationFile, utils, job.parameter);
+                         for (const auto &parameterOverride : job.parameterOverrides)
+                         {
+                            if (parameterOverride.first == "managementFile")
+                            { /* output files named after the management scenario as fork branches */
+                               job.output.scenarioName = OUTPUT::getScenarioName(job.parameter.managementFile);
+                            }
+                         }
+                         if (job.seedList == "NaN")
+                         {
+                            job.replicates.seeds = {job.parameter.randomNumberGeneratorSeed};
+                         } });
+   }
+   WORKERPOOL pool;
+   pool.run(tasks, numberOfThreads);
+}
+
+/**
+ * @brief Runs all replicates of all jobs of the manifest file.
+ *
+ * @param utils Utility functions shared by all jobs.
+ */
+void BATCH::runBatch(const UTILS &utils)
+{
+   if (!openAndReadManifestFile(utils))
+   {
+      utils.handleError("No batch simulation is possible. Please check the manifest file " + manifestFile + ".");
+      numberOfFailedTasks = 1;
+      return;
+   }
+   numberOfThreads = WORKERPOOL::getNumberOfThreads(numberOfThreads);
+
+   readInputDataOfJobs(utils);
+
+   /* one task per replicate; replicates writing the same output files are simulated only once */
+   struct REPLICATETASK
+   {
+      BATCHJOB *job;
+      int jobNumber;
+      unsigned int seed;
+   };
+   std::vector<REPLICATETASK> replicateTasks;
+   std::set<std::string> outputFiles;
+   int jobNumber = 0;
+   for (auto &job : jobs)
+   {
+      jobNumber++;
+      for (auto seed : job.replicates.seeds)
+      {
+         std::string outputFile = job.configurationFile.substr(0, job.configurationFile.find_last_of('\\') + 1) + "lat" + job.parameter.latitude + "_lon" + job.parameter.longitude + "_" + std::to_string(job.parameter.firstYear) + "_" + std::to_string(job.parameter.lastYear) + "_" + std::to_string(seed) + "_" + job.output.scenarioName + "_" + job.parameter.plantTraitsFile;
+         if (!outputFiles.insert(outputFile).second)
+         {
+            utils.handleError("Job " + std::to_string(jobNumber) + " with seed " + std::to_string(seed) + " would overwrite the output files of a previous job and is skipped.");
+            continue;
+         }
+         replicateTasks.push_back({&job, jobNumber, seed});
+      }
+   }
+
+   /* longest job first: tasks sorted by decreasing simulation length */
+   std::stable_sort(replicateTasks.begin(), replicateTasks.end(), [](const REPLICATETASK &a, const REPLICATETASK &b)
+                    { return a.job->parameter.simulationTimeInDays > b.job->parameter.simulationTimeInDays; });
+
+   std::cout << "******* Batch simulation *********" << std::endl
+             << std::endl;
+   std::cout << "Manifest file: " << manifestFile << std::endl;
+   std::cout << "Number of jobs: " << jobs.size() << std::endl;
+   std::cout << "Number of replicates: " << replicateTasks.size() << std::endl;
+   std::cout << "Worker threads: " << std::min(numberOfThreads, std::max(1, (int)replicateTasks.size())) << std::endl
+             << std::endl;
+
+   int numberOfFinishedTasks = 0;
+   numberOfFailedTasks = 0;
+   std::vector<std::function<void()>> tasks;
+   for (const auto &replicateTask : replicateTasks)
+   {
+      tasks.push_back([this, &replicateTask, &utils, &numberOfFinishedTasks, &replicateTasks]()
+                      {
+                         const BATCHJOB &job = *replicateTask.job;
+                         auto startTime = std::chrono::steady_clock::now();
+                         std::string failure = "";
+                         try
+                         {
+                            job.replicates.runReplicate(replicateTask.seed, job.configurationFile, utils, job.parameter, job.weather, job.soil, job.management, job.allometry, job.output);
+                         }
+                         catch (const std::exception &e)
+                         {
+                            failure = e.what();
+                         }
+                         double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+
+                         std::lock_guard<std::mutex> lock(consoleMutex);
+                         numberOfFinishedTasks++;
+                         if (failure != "")
+                         {
+                            numberOfFailedTasks++;
+                            utils.handleError("Job " + std::to_string(replicateTask.jobNumber) + " with seed " + std::to_string(replicateTask.seed) + " failed: " + failure);
+                         }
+                         std::cout << "[" << numberOfFinishedTasks << "/" << replicateTasks.size() << "] Job " << replicateTask.jobNumber << " (" << job.configurationFile << ", "
+                                   << job.parameter.firstYear << "-" << job.parameter.lastYear << ", seed " << replicateTask.seed << ") "
+                                   << (failure == "" ? "finished" : "failed") << " in " << seconds << " s" << std::endl; });
+   }
+
+   WORKERPOOL pool;
+   pool.run(tasks, numberOfThreads);
+
+   std::cout << std::endl
+             << "Replicates taken over by idle workers (work stealing): " << pool.numberOfStolenTasks << std::endl
+             << std::endl;
+}
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+#include "../module_input/input.h"
+#include "../module_parameter/parameter.h"
+#include "../module_weather/weather.h"
+#include "../module_soil/soil.h"
+#include "../module_management/management.h"
+#include "../module_plant/allometry.h"
+#include "../module_output/output.h"
+#include "../module_ensemble/ensemble.h"
+#include "../utils/utils.h"
+#include <deque>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Job of a batch: one configuration (site) with its overridden settings and seeds.
+ *
+ * The input data of a job are read once and shared by all replicates (seeds) of the job.
+ */
+struct BATCHJOB
+{
+   std::string configurationFile;                                      /// Path of the configuration file (the site is given by its name)
+   std::vector<std::pair<std::string, std::string>> parameterOverrides; /// Parameters of the configuration file replaced by the manifest
+   std::string seedList;                                               /// Seeds of the replicates ("NaN" = seed of the configuration file)
+   ENSEMBLE replicates;                                                /// Seeds of the replicates of the job
+
+   INPUT input;
+   PARAMETER parameter;
+   WEATHER weather;
+   SOIL soil;
+   MANAGEMENT management;
+   ALLOMETRY allometry;
+   OUTPUT output; /// Output settings of the job (output writing dates)
+};
+
+/**
+ * @brief Runs a batch of simulation jobs of several sites listed in a manifest file.
+ *
+ * Each line of the tab-separated manifest file (first line is a header) defines a job:
+ *
+ * configurationFile  firstYear  lastYear  managementFile  plantTraitsFile  seeds
+ *
+ * The configuration file is given relative to the directory of the manifest file; the site
+ * (scenarios/<site>/) is derived from its name as in single runs. Columns with the value NaN
+ * keep the value of the configuration file. Seeds are given as list and ranges (e.g. 0-10 or 1,3,5-8).
+ *
+ * The input data of all jobs are read first. Afterwards every replicate (job and seed) is one
+ * task; tasks are sorted by decreasing simulation length (longest job first) and run on a
+ * work-stealing pool of worker threads (see `WORKERPOOL`). Each replicate streams its output
+ * files as a single run does, and its completion is reported on the console. Jobs overriding the
+ * management file name their output files after the management scenario (e.g. `__GER_Schwieder`).
+ *
+ * Command line: `GRASSMIND3 --batch <manifest file> [--threads 4]`
+ */
+class BATCH
+{
+public:
+   BATCH();
+   ~BATCH();
+
+   bool batchActivated;        /// Batch mode is selected (--batch option given)
+   std::string manifestFile;   /// Path of the manifest file
+   int numberOfThreads;        /// Number of worker threads (0 = number of hardware threads)
+   std::deque<BATCHJOB> jobs;  /// Jobs listed in the manifest file
+   int numberOfFailedTasks;    /// Replicates that could not be simulated
+
+   bool readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils);
+   bool openAndReadManifestFile(UTILS utils);
+   void readInputDataOfJobs(const UTILS &utils);
+   void runBatch(const UTILS &utils);
+
+private:
+   std::mutex consoleMutex; /// Serializes the progress messages of the workers
+};
\ No newline at end of file
@@ -0,0 +1,191 @@
+#include "checkpoint.h"
+#include <filesystem>
+
+CHECKPOINT::CHECKPOINT()
+{
+   numberOfSavedSnapshots = 0;
+};
+
+CHECKPOINT::~CHECKPOINT() {};
+
+/**
+ * @brief Reads the option `--resume <snapshot file>` from the command line.
+ *
+ * @param commandLineInput Command line arguments.
+ * @param utils Utility functions for error handling.
+ * @return False if the option is incomplete.
+ */
+bool CHECKPOINT::readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils)
+{
+   for (std::size_t it = 2; it < commandLineInput.size(); it++)
+   {
+      if (commandLineInput[it] == "--resume")
+      {
+         if (it + 1 >= commandLineInput.size())
+         {
+            utils.handleError("The --resume option requires a snapshot file.");
+            return false;
+         }
+         resumeFile = commandLineInput[++it];
+      }
+   }
+   return true;
+}
+
+/**
+ * @brief Checks if a snapshot is due at the end of the current day.
+ *
+ * No snapshot is written at the last day, since the run is complete then.
+ */
+bool CHECKPOINT::isCheckpointDay(const PARAMETER &parameter) const
+{
+   return parameter.checkpointInterval > 0 && parameter.day % parameter.checkpointInterval == 0 && parameter.day < parameter.simulationTimeInDays;
+}
+
+/**
+ * @brief Writes or reads the complete simulation state in a fixed order.
+ *
+ * Used by `saveSnapshot()` with a `SNAPSHOTWRITER` and by `loadSnapshot()` with a
+ * `SNAPSHOTREADER`. New state variables have to be added here (and `snapshotVersion` increased).
+ */
+template <typename ARCHIVE>
+void CHECKPOINT::transferSimulationState(ARCHIVE &archive, PARAMETER &parameter, COMMUNITY &community, RECRUITMENT &recruitment, SOIL &soil, OUTPUT &output, std::vector<std::uint64_t> &outputFileSizes)
+{
+   /* time and random number generator */
+   archive.transfer(parameter.day);
+   archive.transfer(parameter.randomNumberGeneratorSeed);
+
+   /* plant cohorts */
+   archive.transfer(community.allPlants.nextCohortId);
+   community.allPlants.forEachColumn([&archive](auto &column)
+                                     { archive.transfer(column); });
+   archive.transfer(community.totalNumberOfCohortsInCommunity);
+
+   /* seed bank */
+   std::uint64_t numberOfSeedPools = recruitment.seedPool.size();
+   archive.transfer(numberOfSeedPools);
+   recruitment.seedPool.resize(numberOfSeedPools);
+   recruitment.seedGerminationTimeCounter.resize(numberOfSeedPools);
+   for (std::uint64_t pft = 0; pft < numberOfSeedPools; pft++)
+   {
+      archive.transfer(recruitment.seedPool[pft]);
+      archive.transfer(recruitment.seedGerminationTimeCounter[pft]);
+   }
+
+   /* litter and soil organic matter pools */
+   for (double *pool : {&soil.greenCarbonSurfaceLitter, &soil.brownCarbonSurfaceLitter, &soil.rootCarbonSoilLitter, &soil.seedCarbonSoilLitter,
+                        &soil.greenNitrogenSurfaceLitter, &soil.brownNitrogenSurfaceLitter, &soil.rootNitrogenSoilLitter, &soil.seedNitrogenSoilLitter,
+                        &soil.CPool_Soil_passive, &soil.CPool_Soil_slow, &soil.CPool_Soil_active, &soil.CPool_Soil_microbes,
+                        &soil.CPool_Soil_litter_met, &soil.CPool_Surface_litter_met, &soil.CPool_Soil_litter_struc, &soil.CPool_Surface_litter_struc,
+                        &soil.NPool_Soil_passive, &soil.NPool_Soil_slow, &soil.NPool_Soil_active, &soil.NPool_Soil_microbes,
+                        &soil.NPool_Soil_litter_met, &soil.NPool_Surface_litter_met, &soil.NPool_Soil_litter_struc, &soil.NPool_Surface_litter_struc,
+                        &soil.snowContent, &soil.soilTemperature})
+   {
+      archive.transfer(*pool);
+   }
+
+   /* statistics of the aggregated output fields of the current cadence period */
+   for (OUTPUTAGGREGATOR *aggregator : {&output.aggregatorCommunity, &output.aggregatorPFTPopulation})
+   {
+      archive.transfer(aggregator->statistics);
+      archive.transfer(aggregator->numberOfDaysInWindow);
+   }
+
+   /* output written so far */
+   archive.transfer(outputFileSizes);
+}
+
+/**
+ * @brief Saves the state at the end of the current day to the snapshot file of the run.
+ *
+ * All buffered output is written to the output files first. The snapshot is written to a
+ * temporary file, which then replaces the previous snapshot.
+ *
+ * @return False if the snapshot could not be written.
+ */
+bool CHECKPOINT::saveSnapshot(const UTILS &utils, PARAMETER &parameter, COMMUNITY &community, RECRUITMENT &recruitment, SOIL &soil, OUTPUT &output)
+{
+   std::vector<std::uint64_t> outputFileSizes = output.flushOutputFiles();
+
+   std::string temporaryFile = output.checkpointFile + ".tmp";
+   SNAPSHOTWRITER writer;
+   writer.file.open(temporaryFile, std::ios::binary | std::ios::trunc);
+   if (!writer.file.is_open())
+   {
+      utils.handleError("The snapshot file " + temporaryFile + " cannot be written.");
+      return false;
+   }
+
+   std::uint32_t magicNumber = snapshotMagicNumber;
+   std::uint32_t version = snapshotVersion;
+   writer.transfer(magicNumber);
+   writer.transfer(version);
+   writer.transfer(parameter.firstYear);
+   writer.transfer(parameter.lastYear);
+   writer.transfer(parameter.pftCount);
+   transferSimulationState(writer, parameter, community, recruitment, soil, output, outputFileSizes);
+   writer.file.close();
+
+   std::error_code error;
+   std::filesystem::rename(temporaryFile, output.checkpointFile, error);
+   if (writer.file.fail() || error)
+   {
+      utils.handleError("The snapshot file " + output.checkpointFile + " cannot be written.");
+      return false;
+   }
+   numberOfSavedSnapshots++;
+   return true;
+}
+
+/**
+ * @brief Restores the state of a run from the snapshot given by `--resume`.
+ *
+ * Has to be called after the initialization of the simulation and before the output files
+ * are opened. The simulation continues with the day following the day of the snapshot.
+ *
+ * @return False if the snapshot cannot be read or does not belong to the configuration.
+ */
+bool CHECKPOINT::loadSnapshot(const UTILS &utils, PARAMETER &parameter, COMMUNITY &community, RECRUITMENT &recruitment, SOIL &soil, OUTPUT &output)
+{
+   SNAPSHOTREADER reader;
+   reader.file.open(resumeFile, std::ios::binary);
+   if (!reader.file.is_open())
+   {
+      utils.handleError("The snapshot file " + resumeFile + " cannot be opened.");
+      return false;
+   }
+
+   std::uint32_t magicNumber = 0;
+   std::uint32_t version = 0;
+   reader.transfer(magicNumber);
+   reader.transfer(version);
+   if (!reader.file || magicNumber != snapshotMagicNumber || version != snapshotVersion)
+   {
+      utils.handleError("The file " + resumeFile + " is not a snapshot of version " + std::to_string(snapshotVersion) + ".");
+      return false;
+   }
+
+   int firstYear = 0;
+   int lastYear = 0;
+   int pftCount = 0;
+   reader.transfer(firstYear);
+   reader.transfer(lastYear);
+   reader.transfer(pftCount);
+   if (firstYear != parameter.firstYear || lastYear != parameter.lastYear || pftCount != parameter.pftCount)
+   {
+      utils.handleError("The snapshot " + resumeFile + " does not match the simulation period or the number of PFTs of the configuration.");
+      return false;
+   }
+
+   std::vector<std::uint64_t> outputFileSizes;
+   transferSimulationState(reader, parameter, community, recruitment, soil, output, outputFileSizes);
+   if (!reader.file || reader.file.peek() != std::char_traits<char>::eof())
+   {
+      utils.handleError("The snapshot " + resumeFile + " is incomplete or corrupted.");
+      return false;
+   }
+
+   output.resumedFileSizes = outputFileSizes;
+   parameter.day++; // continue with the day after the snapshot
+   return true;
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+#pragma once
+#include "../module_parameter/parameter.h"
+#include "../module_plant/community.h"
+#include "../module_recruitment/recruitment.h"
+#include "../module_soil/soil.h"
+#include "../module_output/output.h"
+#include "../utils/utils.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Writes values of the simulation state to a binary snapshot file.
+ *
+ * Values are written in their native binary representation, vectors are preceded by
+ * their length. Counterpart of `SNAPSHOTREADER`, both are used by the same transfer
+ * function of `CHECKPOINT`, so that the order of values cannot differ between them.
+ */
+class SNAPSHOTWRITER
+{
+public:
+   std::ofstream file;
+
+   template <typename VALUE>
+   void transfer(VALUE &value)
+   {
+      static_assert(std::is_arithmetic_v<VALUE>, "Only arithmetic values can be written to a snapshot.");
+      file.write(reinterpret_cast<const char *>(&value), sizeof(VALUE));
+   }
+
+   template <typename VALUE>
+   void transfer(std::vector<VALUE> &values)
+   {
+      std::uint64_t size = values.size();
+      transfer(size);
+      if constexpr (std::is_arithmetic_v<VALUE> && !std::is_same_v<VALUE, bool>)
+      {
+         file.write(reinterpret_cast<const char *>(values.data()), sizeof(VALUE) * values.size());
+      }
+      else
+      {
+         for (std::size_t it = 0; it < values.size(); it++)
+         {
+            VALUE value = values[it];
+            transfer(value);
+         }
+      }
+   }
+};
+
+/**
+ * @brief Reads values of the simulation state from a binary snapshot file.
+ */
+class SNAPSHOTREADER
+{
+public:
+   std::ifstream file;
+
+   template <typename VALUE>
+   void transfer(VALUE &value)
+   {
+      static_assert(std::is_arithmetic_v<VALUE>, "Only arithmetic values can be read from a snapshot.");
+      file.read(reinterpret_cast<char *>(&value), sizeof(VALUE));
+   }
+
+   template <typename VALUE>
+   void transfer(std::vector<VALUE> &values)
+   {
+      std::uint64_t size = 0;
+      transfer(size);
+      if (!file || size > maximumVectorSize)
+      {
+         file.setstate(std::ios::failbit);
+         return;
+      }
+      values.resize(size);
+      if constexpr (std::is_arithmetic_v<VALUE> && !std::is_same_v<VALUE, bool>)
+      {
+         file.read(reinterpret_cast<char *>(values.data()), sizeof(VALUE) * values.size());
+      }
+      else
+      {
+         for (std::size_t it = 0; it < values.size(); it++)
+         {
+            VALUE value{};
+            transfer(value);
+            values[it] = value;
+         }
+      }
+   }
+
+private:
+   const std::uint64_t maximumVectorSize = std::uint64_t(1) << 32; /// Guards against corrupted lengths
+};
+
+/**
+ * @brief Saves the complete state of a simulation run to a binary snapshot and resumes runs from it.
+ *
+ * A snapshot is written at the end of every `checkpointInterval`-th day (configuration file)
+ * and replaces the previous snapshot of the run atomically, so that a preempted run can be
+ * resumed with `GRASSMIND3 <configuration file> --resume <snapshot file>`. It holds:
+ *
+ * - the current day and the seed of the random number generator (`PARAMETER`),
+ * - all plant cohorts incl. the next cohort id (`COMMUNITY::allPlants`),
+ * - the seed pool and germination time counters (`RECRUITMENT`),
+ * - the litter and soil organic matter pools (`SOIL`),
+ * - the statistics of the aggregated output fields of the current cadence period (`OUTPUTAGGREGATOR`),
+ * - the sizes of the output files written so far (`OUTPUT`).
+ *
+ * Random numbers are counter-based and only depend on the seed, the day and the cohort id
+ * (see module_random/random.h), i.e. there is no generator state besides these values.
+ * Output files are truncated to the saved sizes and continued, so that a resumed run
+ * produces output files identical to an uninterrupted run.
+ *
+ * The snapshot starts with a magic number and the format version `snapshotVersion`, which
+ * has to be increased whenever the content of the snapshot changes.
+ */
+class CHECKPOINT
+{
+public:
+   CHECKPOINT();
+   ~CHECKPOINT();
+
+   static constexpr std::uint32_t snapshotMagicNumber = 0x334d4753; /// "SGM3" in the first bytes of each snapshot
+   static constexpr std::uint32_t snapshotVersion = 2;             /// Version of the snapshot format
+
+   std::string resumeFile;    /// Snapshot to resume the simulation from (--resume option)
+   int numberOfSavedSnapshots; /// Snapshots written during the run
+
+   bool readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils);
+   bool isCheckpointDay(const PARAMETER &parameter) const;
+   bool saveSnapshot(const UTILS &utils, PARAMETER &parameter, COMMUNITY &community, RECRUITMENT &recruitment, SOIL &soil, OUTPUT &output);
+   bool loadSnapshot(const UTILS &utils, PARAMETER &parameter, COMMUNITY &community, RECRUITMENT &recruitment, SOIL &soil, OUTPUT &output);
+
+private:
+   template <typename ARCHIVE>
+   void transferSimulationState(ARCHIVE &archive, PARAMETER &parameter, COMMUNITY &community, RECRUITMENT &recruitment, SOIL &soil, OUTPUT &output, std::vector<std::uint64_t> &outputFileSizes);
+};
\ No newline at end of file
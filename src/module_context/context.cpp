@@ -0,0 +1,5 @@
+#include "context.h"
+
+SIMULATIONCONTEXT::SIMULATIONCONTEXT(const UTILS &utils, const PARAMETER &parameter, const WEATHER &weather, const MANAGEMENT &management, const ALLOMETRY &allometry)
+    : utils(utils), parameter(parameter), weather(weather), management(management), allometry(allometry) {};
+SIMULATIONCONTEXT::~SIMULATIONCONTEXT() {};
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+#include "../module_parameter/parameter.h"
+#include "../module_weather/weather.h"
+#include "../module_management/management.h"
+#include "../module_plant/allometry.h"
+#include "../utils/utils.h"
+
+/**
+ * @brief Read-only view on all inputs of a simulation run.
+ *
+ * The `SIMULATIONCONTEXT` class bundles the objects that are set up once before the
+ * simulation starts (parameters, weather and management time series, allometric
+ * relationships and utility functions) and are only read during the day steps.
+ * It is built once in `main()` and passed as a const reference through the whole
+ * day step, so that none of these objects is copied per call.
+ *
+ * The mutable state of the simulation (`COMMUNITY`, `RECRUITMENT`, `SOIL`, `INTERACTION`
+ * and `OUTPUT`) is kept separate and passed by non-const reference.
+ *
+ * @note The context only references the objects, it does not own them. The current
+ *       simulation day is still advanced by `STEP` in the underlying `PARAMETER` object
+ *       and is therefore visible via `context.parameter.day`.
+ */
+class SIMULATIONCONTEXT
+{
+public:
+   SIMULATIONCONTEXT(const UTILS &utils, const PARAMETER &parameter, const WEATHER &weather, const MANAGEMENT &management, const ALLOMETRY &allometry);
+   ~SIMULATIONCONTEXT();
+
+   const UTILS &utils;           /// Utility functions for error handling and date calculations
+   const PARAMETER &parameter;   /// Simulation settings, configuration parameters and plant traits
+   const WEATHER &weather;       /// Daily weather time series
+   const MANAGEMENT &management; /// Management events (mowing, fertilization, irrigation, sowing)
+   const ALLOMETRY &allometry;   /// Allometric relationships of plants
+};
\ No newline at end of file
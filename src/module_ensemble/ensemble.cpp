@@ -0,0 +1,218 @@
+#include "ensemble.h"
+#include "workerpool.h"
+#include "../module_profile/trace.h"
+#include "../module_context/context.h"
+#include "../module_init/init.h"
+#include "../module_step/step.h"
+#include "../module_plant/community.h"
+#include "../module_recruitment/recruitment.h"
+#include "../module_mortality/mortality.h"
+#include "../module_growth/growth.h"
+#include "../module_interaction/interaction.h"
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <iostream>
+#include <mutex>
+#include <thread>
+
+ENSEMBLE::ENSEMBLE()
+{
+   ensembleActivated = false;
+   numberOfThreads = 0;
+};
+
+ENSEMBLE::~ENSEMBLE() {};
+
+/**
+ * @brief Reads the ensemble options `--seeds` and `--threads` from the command line.
+ *
+ * @param commandLineInput Command line arguments (the configuration file is the first argument).
+ * @param utils Utility functions for error handling.
+ * @return False if an option is invalid.
+ */
+bool ENSEMBLE::readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils)
+{
+   for (std::size_t it = 2; it < commandLineInput.size(); it++)
+   {
+      const std::string &option = commandLineInput[it];
+      if (option == "--seeds" && it + 1 < commandLineInput.size())
+      {
+         if (!parseSeedList(commandLineInput[++it]))
+         {
+            utils.handleError("The seed list " + commandLineInput[it] + " of the --seeds option is invalid (e.g. 0-10 or 1,3,5-8).");
+            return false;
+         }
+         ensembleActivated = true;
+      }
+      else if (option == "--threads" && it + 1 < commandLineInput.size())
+      {
+         if (!WORKERPOOL::readNumberOfThreads(commandLineInput[++it], utils, numberOfThreads))
+         {
+            return false;
+         }
+      }
+   }
+   return true;
+}
+
+/**
+ * @brief Parses a comma-separated list of seeds and seed ranges (e.g. `1,3,5-8`).
+ *
+ * @param seedList List of seeds.
+ * @return False if the list contains an invalid entry.
+ */
+bool ENSEMBLE::parseSeedList(const std::string &seedList)
+{
+   seeds.clear();
+   std::size_t start = 0;
+   while (start <= seedList.size())
+   {
+      std::size_t end = seedList.find(',', start);
+      if (end == std::string::npos)
+      {
+         end = seedList.size();
+      }
+      std::string entry = seedList.substr(start, end - start);
+      std::size_t dash = entry.find('-', 1);
+
+      try
+      {
+         std::size_t length = 0;
+         long long first = std::stoll(entry.substr(0, dash), &length);
+         long long last = first;
+         if (length != entry.substr(0, dash).size())
+         {
+            return false;
+         }
+         if (dash != std::string::npos)
+         {
+            last = std::stoll(entry.substr(dash + 1), &length);
+            if (length != entry.size() - dash - 1)
+            {
+               return false;
+            }
+         }
+         if (first < 0 || last < first || last > std::numeric_limits<unsigned int>::max())
+         {
+            return false;
+         }
+         for (long long seed = first; seed <= last; seed++)
+         {
+            seeds.push_back(static_cast<unsigned int>(seed));
+         }
+      }
+      catch (const std::exception &)
+      {
+         return false;
+      }
+      start = end + 1;
+   }
+   return !seeds.empty();
+}
+
+/**
+ * @brief Prints the seeds and the number of worker threads of the ensemble to the console.
+ */
+void ENSEMBLE::printEnsembleSettingsToConsole() const
+{
+   std::cout << "******* Ensemble of replicated simulations *********" << std::endl
+             << std::endl;
+   std::cout << "Number of replicates: " << seeds.size() << std::endl;
+   std::cout << "Seeds of random number generator:";
+   for (auto seed : seeds)
+   {
+      std::cout << " " << seed;
+   }
+   std::cout << std::endl;
+   std::cout << "Worker threads: " << numberOfThreads << std::endl
+             << std::endl;
+}
+
+/**
+ * @brief Simulates all replicates of the ensemble on a pool of worker threads.
+ *
+ * Idle worker threads take over replicates queued for other threads, so that replicates
+ * of different runtimes are balanced over the threads.
+ *
+ * @param path Path of the configuration file (location of the output folder).
+ * @param utils Utility functions shared by all replicates.
+ * @param parameter Parameters read from the input files, copied for each replicate.
+ * @param weather Weather data and daily drivers shared by all replicates.
+ * @param soil Soil data, copied for each replicate.
+ * @param management Management data shared by all replicates.
+ * @param allometry Allometric relationships shared by all replicates.
+ * @param sharedOutput Output settings read once (output writing dates).
+ */
+void ENSEMBLE::runEnsemble(const std::string &path, const UTILS &utils, const PARAMETER &parameter, const WEATHER &weather, const SOIL &soil, const MANAGEMENT &management, const ALLOMETRY &allometry, const OUTPUT &sharedOutput)
+{
+   numberOfThreads = WORKERPOOL::getNumberOfThreads(numberOfThreads);
+   numberOfThreads = std::min(numberOfThreads, static_cast<int>(seeds.size()));
+
+   printEnsembleSettingsToConsole();
+
+   std::mutex failureMutex;
+   failedReplicates.clear();
+
+   std::vector<std::function<void()>> tasks;
+   for (auto seed : seeds)
+   {
+      tasks.push_back([&, seed]()
+                      {
+                         try
+                         {
+                            runReplicate(seed, path, utils, parameter, weather, soil, management, allometry, sharedOutput);
+                         }
+                         catch (const std::exception &e)
+                         {
+                            std::lock_guard<std::mutex> lock(failureMutex);
+                            failedReplicates.push_back("Replicate with seed " + std::to_string(seed) + " failed: " + e.what());
+                         } });
+   }
+   WORKERPOOL pool;
+   pool.run(tasks, numberOfThreads);
+
+   for (const auto &failure : failedReplicates)
+   {
+      utils.handleError(failure);
+   }
+}
+
+/**
+ * @brief Simulates one replicate with its own copy of the mutable simulation state.
+ *
+ * @param seed Random number generator seed of the replicate.
+ * @param path, utils, sharedParameter, weather, sharedSoil, management, allometry, sharedOutput
+ *        Shared inputs of the ensemble (see `runEnsemble()`).
+ */
+void ENSEMBLE::runReplicate(unsigned int seed, const std::string &path, const UTILS &utils, const PARAMETER &sharedParameter, const WEATHER &weather, const SOIL &sharedSoil, const MANAGEMENT &management, const ALLOMETRY &allometry, const OUTPUT &sharedOutput) const
+{
+   TRACESCOPE traceScope("replicate", "seed", seed);
+   PARAMETER parameter = sharedParameter;
+   parameter.randomNumberGeneratorSeed = seed;
+   SOIL soil = sharedSoil;
+
+   INIT init;
+   STEP step;
+   COMMUNITY community;
+   RECRUITMENT recruitment;
+   MORTALITY mortality;
+   GROWTH growth;
+   INTERACTION interaction;
+   OUTPUT output;
+
+   init.initModelSimulation(parameter, community, recruitment, soil, interaction);
+
+   /* output files of the replicate; the output writing dates are read only once */
+   output.useSharedSettings(sharedOutput, sharedOutput.scenarioName);
+   output.createOutputFolder(path, utils);
+   output.createAndOpenOutputFiles(parameter, utils);
+   output.writeHeaderInOutputFiles(utils);
+   output.formatter.prepareOutputFormatter(utils, parameter);
+
+   SIMULATIONCONTEXT context(utils, parameter, weather, management, allometry);
+   step.runModelSimulation(context, parameter, init, community, recruitment, mortality, growth, soil, interaction, output);
+
+   output.writeSimulationResultsToOutputFiles(utils);
+   output.closeOutputFiles(utils);
+}
\ No newline at end of file
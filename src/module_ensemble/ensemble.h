@@ -0,0 +1,45 @@
+#pragma once
+#include "../module_parameter/parameter.h"
+#include "../module_weather/weather.h"
+#include "../module_soil/soil.h"
+#include "../module_management/management.h"
+#include "../module_plant/allometry.h"
+#include "../module_output/output.h"
+#include "../utils/utils.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runs replicated simulations of one site with different random number generator seeds.
+ *
+ * The `ENSEMBLE` class replaces repeated calls of the executable with modified seeds
+ * (see simulations/runReplicatedSimulations.py). All input files are read once; parameters,
+ * weather, soil, management and allometry are shared read-only by all replicates. Each
+ * replicate runs on its own copy of the mutable state (parameters incl. the current day,
+ * soil, community, recruitment, interaction and output) and writes its own set of output
+ * files, named by its seed as in single runs.
+ *
+ * Replicates are distributed over a work-stealing pool of worker threads (see `WORKERPOOL`). Since the random
+ * numbers of a replicate only depend on its seed (see module_random/random.h), the output
+ * of each replicate is identical to a single run with the same seed.
+ *
+ * Command line: `GRASSMIND3 <configuration file> --seeds 0-10 [--threads 4]`, seeds are
+ * given as a comma-separated list of single seeds and ranges (e.g. `1,3,5-8`).
+ */
+class ENSEMBLE
+{
+public:
+   ENSEMBLE();
+   ~ENSEMBLE();
+
+   bool ensembleActivated;                     /// Replicates are simulated (--seeds option given)
+   std::vector<unsigned int> seeds;            /// Random number generator seeds of the replicates
+   int numberOfThreads;                        /// Number of worker threads (0 = number of hardware threads)
+   std::vector<std::string> failedReplicates;  /// Error messages of replicates that could not be simulated
+
+   bool readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils);
+   bool parseSeedList(const std::string &seedList);
+   void printEnsembleSettingsToConsole() const;
+   void runEnsemble(const std::string &path, const UTILS &utils, const PARAMETER &parameter, const WEATHER &weather, const SOIL &soil, const MANAGEMENT &management, const ALLOMETRY &allometry, const OUTPUT &sharedOutput);
+   void runReplicate(unsigned int seed, const std::string &path, const UTILS &utils, const PARAMETER &sharedParameter, const WEATHER &weather, const SOIL &sharedSoil, const MANAGEMENT &management, const ALLOMETRY &allometry, const OUTPUT &sharedOutput) const;
+};
\ No newline at end of file
@@ -0,0 +1,142 @@
+#include "workerpool.h"
+#include "../module_profile/trace.h"
+#include <algorithm>
+#include <thread>
+
+WORKERPOOL::WORKERPOOL()
+{
+   numberOfStolenTasks = 0;
+};
+
+WORKERPOOL::~WORKERPOOL() {};
+
+/**
+ * @brief Reads the number of worker threads given by the `--threads` option.
+ *
+ * @param value Value of the `--threads` option.
+ * @param utils Utility functions for error handling.
+ * @param numberOfThreads Number of worker threads (0 = number of hardware threads).
+ * @return False if the value is not a non-negative number.
+ */
+bool WORKERPOOL::readNumberOfThreads(const std::string &value, const UTILS &utils, int &numberOfThreads)
+{
+   try
+   {
+      numberOfThreads = std::stoi(value);
+   }
+   catch (const std::exception &)
+   {
+      numberOfThreads = -1;
+   }
+   if (numberOfThreads < 0)
+   {
+      utils.handleError("The number of threads " + value + " of the --threads option is invalid.");
+      return false;
+   }
+   return true;
+}
+
+/**
+ * @brief Returns the number of worker threads to be used (the number of hardware threads for 0).
+ */
+int WORKERPOOL::getNumberOfThreads(int numberOfThreads)
+{
+   if (numberOfThreads == 0)
+   {
+      return std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+   }
+   return numberOfThreads;
+}
+
+/**
+ * @brief Runs all tasks on the given number of worker threads.
+ *
+ * @param tasks Tasks in the order of priority (e.g. sorted by decreasing simulation length).
+ * @param numberOfThreads Number of worker threads including the calling thread.
+ */
+void WORKERPOOL::run(const std::vector<std::function<void()>> &tasks, int numberOfThreads)
+{
+   numberOfThreads = std::max(1, std::min(numberOfThreads, static_cast<int>(tasks.size())));
+   numberOfStolenTasks = 0;
+
+   queues.clear();
+   queues.resize(numberOfThreads);
+   for (std::size_t task = 0; task < tasks.size(); task++)
+   {
+      queues[task % numberOfThreads].tasks.push_back(task);
+   }
+
+   std::vector<std::thread> workers;
+   for (int worker = 1; worker < numberOfThreads; worker++)
+   {
+      workers.emplace_back(&WORKERPOOL::runWorker, this, worker, std::cref(tasks));
+   }
+   runWorker(0, tasks);
+   for (auto &thread : workers)
+   {
+      thread.join();
+   }
+}
+
+/**
+ * @brief Takes the next (longest) task from the front of the own queue.
+ */
+bool WORKERPOOL::takeOwnTask(int worker, std::size_t &task)
+{
+   std::lock_guard<std::mutex> lock(queues[worker].mutex);
+   if (queues[worker].tasks.empty())
+   {
+      return false;
+   }
+   task = queues[worker].tasks.front();
+   queues[worker].tasks.pop_front();
+   return true;
+}
+
+/**
+ * @brief Steals the last (shortest) task from the back of the queue of another worker.
+ */
+bool WORKERPOOL::stealTask(int worker, std::size_t &task)
+{
+   int numberOfWorkers = static_cast<int>(queues.size());
+   for (int offset = 1; offset < numberOfWorkers; offset++)
+   {
+      TASKQUEUE &victim = queues[(worker + offset) % numberOfWorkers];
+      std::lock_guard<std::mutex> lock(victim.mutex);
+      if (!victim.tasks.empty())
+      {
+         task = victim.tasks.back();
+         victim.tasks.pop_back();
+         return true;
+      }
+   }
+   return false;
+}
+
+/**
+ * @brief Main loop of a worker: runs own tasks, then stolen tasks, until all queues are empty.
+ *
+ * Tasks are never added during a run, so a worker that finds all queues empty is done.
+ */
+void WORKERPOOL::runWorker(int worker, const std::vector<std::function<void()>> &tasks)
+{
+   std::size_t task = 0;
+   int stolenTasks = 0; // counted locally to touch the shared counter only once
+   if (worker > 0)
+   {
+      TRACE::setThreadName("worker " + std::to_string(worker));
+   }
+   while (true)
+   {
+      if (!takeOwnTask(worker, task))
+      {
+         if (!stealTask(worker, task))
+         {
+            break;
+         }
+         stolenTasks++;
+      }
+      tasks[task]();
+   }
+   numberOfStolenTasks += stolenTasks;
+}
\ No newline at end of file
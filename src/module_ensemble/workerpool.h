@@ -0,0 +1,50 @@
+#pragma once
+#include "../utils/utils.h"
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/**
+ * @brief Work-stealing pool of worker threads for independent simulation tasks.
+ *
+ * Tasks are dealt out round-robin to one queue per worker in the given order, so that
+ * tasks sorted by decreasing length (longest job first) are spread evenly over the
+ * workers. Each worker takes the tasks of its own queue from the front (longest first);
+ * a worker whose queue is empty steals the last (shortest) task from the queue of another
+ * worker. Short tasks therefore fill the gaps at the end of the run.
+ *
+ * The calling thread is one of the workers; `run()` returns when all tasks are done.
+ *
+ * The number of worker threads of ensembles, batches and forks is read from the `--threads`
+ * option by `readNumberOfThreads()` (0 = number of hardware threads, see `getNumberOfThreads()`).
+ */
+class WORKERPOOL
+{
+public:
+   WORKERPOOL();
+   ~WORKERPOOL();
+
+   std::atomic<int> numberOfStolenTasks; /// Tasks taken from the queue of another worker during the last run
+
+   void run(const std::vector<std::function<void()>> &tasks, int numberOfThreads);
+   static bool readNumberOfThreads(const std::string &value, const UTILS &utils, int &numberOfThreads);
+   static int getNumberOfThreads(int numberOfThreads);
+
+private:
+   /**
+    * @brief Queue of task indices of one worker.
+    */
+   struct TASKQUEUE
+   {
+      std::mutex mutex;
+      std::deque<std::size_t> tasks;
+   };
+
+   std::deque<TASKQUEUE> queues; /// One queue per worker
+
+   bool takeOwnTask(int worker, std::size_t &task);
+   bool stealTask(int worker, std::size_t &task);
+   void runWorker(int worker, const std::vector<std::function<void()>> &tasks);
+};
\ No newline at end of file
@@ -0,0 +1,255 @@
+#include "fork.h"
+#include "../module_ensemble/workerpool.h"
+#include "../module_profile/trace.h"
+#include "../module_input/input.h"
+#include "../module_context/context.h"
+#include "../module_init/init.h"
+#include "../module_step/step.h"
+#include "../module_plant/community.h"
+#include "../module_recruitment/recruitment.h"
+#include "../module_mortality/mortality.h"
+#include "../module_growth/growth.h"
+#include "../module_interaction/interaction.h"
+#include <algorithm>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+FORK::FORK()
+{
+   forkActivated = false;
+   numberOfThreads = 0;
+};
+
+FORK::~FORK() {};
+
+/**
+ * @brief Reads the fork options `--branch-date`, `--branches` and `--threads` from the command line.
+ *
+ * @param commandLineInput Command line arguments (the configuration file is the first argument).
+ * @param utils Utility functions for error handling.
+ * @return False if an option is invalid or missing.
+ */
+bool FORK::readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils)
+{
+   UTILS fileUtils = utils;
+   for (std::size_t it = 2; it < commandLineInput.size(); it++)
+   {
+      const std::string &option = commandLineInput[it];
+      if (option == "--branch-date" && it + 1 < commandLineInput.size())
+      {
+         branchDate = commandLineInput[++it];
+      }
+      else if (option == "--branches" && it + 1 < commandLineInput.size())
+      {
+         std::string branchList = commandLineInput[++it];
+         std::size_t start = 0;
+         while (start <= branchList.size())
+         {
+            std::size_t end = std::min(branchList.find(',', start), branchList.size());
+            std::string managementFile = branchList.substr(start, end - start);
+            if (managementFile != "")
+            {
+               managementFiles.push_back(fileUtils.getFileEnding(managementFile) == "txt" ? managementFile : managementFile + ".txt");
+            }
+            start = end + 1;
+         }
+         forkActivated = true;
+      }
+      else if (option == "--threads" && it + 1 < commandLineInput.size())
+      {
+         if (!WORKERPOOL::readNumberOfThreads(commandLineInput[++it], utils, numberOfThreads))
+         {
+            return false;
+         }
+      }
+   }
+
+   if (forkActivated && (managementFiles.empty() || branchDate == ""))
+   {
+      utils.handleError("The --branches option requires at least one management file and the --branch-date option.");
+      return false;
+   }
+   if (!forkActivated && branchDate != "")
+   {
+      utils.handleError("The --branch-date option requires the --branches option.");
+      return false;
+   }
+   return true;
+}
+
+/**
+ * @brief Prints the branch date, the management files and the number of worker threads to the console.
+ *
+ * @param branchDay Day count of the branch date from the first simulated day.
+ */
+void FORK::printForkSettingsToConsole(int branchDay) const
+{
+   std::cout << "******* Management branches of a spin-up *********" << std::endl
+             << std::endl;
+   std::cout << "Branch date: " << branchDate << " (day " << branchDay << ")" << std::endl;
+   std::cout << "Number of branches: " << managementFiles.size() << std::endl;
+   for (const auto &managementFile : managementFiles)
+   {
+      std::cout << "   " << managementFile << std::endl;
+   }
+   std::cout << "Worker threads: " << numberOfThreads << std::endl
+             << std::endl;
+}
+
+/**
+ * @brief Simulates the spin-up period once and all branches from its final state.
+ *
+ * The management files of all branches are read before the spin-up. The output files of the
+ * spin-up are written to temporary files (scenario name `spinup`), copied as beginning of the
+ * output files of each branch and removed after all branches are simulated.
+ *
+ * @param path Path of the configuration file (location of the output folder and the site).
+ * @param utils Utility functions shared by all branches.
+ * @param parameter Parameters read from the input files, copied for the spin-up.
+ * @param weather Weather data and daily drivers shared by the spin-up and all branches.
+ * @param soil Soil data, copied for the spin-up.
+ * @param management Management of the configuration file, applied in the spin-up.
+ * @param allometry Allometric relationships shared by the spin-up and all branches.
+ * @param sharedOutput Output settings read once (output writing dates).
+ */
+void FORK::runFork(const std::string &path, const UTILS &utils, const PARAMETER &parameter, const WEATHER &weather, const SOIL &soil, const MANAGEMENT &management, const ALLOMETRY &allometry, const OUTPUT &sharedOutput)
+{
+   /* day of the branch date */
+   INPUT input;
+   UTILS dateUtils = utils;
+   int branchDay = 0;
+   try
+   {
+      branchDay = input.convertDateToDayCount(dateUtils, "--branch-date", branchDate, parameter);
+   }
+   catch (const std::exception &)
+   {
+      branchDay = 0;
+   }
+   if (branchDay < 2 || branchDay > parameter.simulationTimeInDays)
+   {
+      utils.handleError("The branch date " + branchDate + " is invalid. It has to be a date (YYYY-MM-DD) after the first and within the last simulated year.");
+      failedBranches.push_back("Invalid branch date " + branchDate);
+      return;
+   }
+
+   /* management of the branches */
+   std::deque<MANAGEMENT> branchManagements(managementFiles.size());
+   for (std::size_t branch = 0; branch < managementFiles.size(); branch++)
+   {
+      INPUT branchInput;
+      PARAMETER branchParameter = parameter;
+      branchParameter.managementFile = managementFiles[branch];
+      branchInput.openAndReadManagementFile(path, utils, branchParameter, branchManagements[branch]);
+      if (!branchInput.managementFileOpened)
+      {
+         utils.handleError("The management file " + managementFiles[branch] + " of a branch cannot be opened.");
+         failedBranches.push_back("Missing management file " + managementFiles[branch]);
+         return;
+      }
+   }
+
+   numberOfThreads = WORKERPOOL::getNumberOfThreads(numberOfThreads);
+   numberOfThreads = std::min(numberOfThreads, static_cast<int>(managementFiles.size()));
+
+   printForkSettingsToConsole(branchDay);
+
+   /* spin-up until the day before the branch date */
+   TRACESCOPE spinupScope("spinup");
+   PARAMETER spinupParameter = parameter;
+   SOIL spinupSoil = soil;
+   INIT init;
+   STEP step;
+   COMMUNITY community;
+   RECRUITMENT recruitment;
+   MORTALITY mortality;
+   GROWTH growth;
+   INTERACTION interaction;
+   OUTPUT spinupOutput;
+
+   init.initModelSimulation(spinupParameter, community, recruitment, spinupSoil, interaction);
+
+   spinupOutput.useSharedSettings(sharedOutput, "spinup");
+   spinupOutput.createOutputFolder(path, utils);
+   spinupOutput.createAndOpenOutputFiles(spinupParameter, utils);
+   spinupOutput.writeHeaderInOutputFiles(utils);
+   spinupOutput.formatter.prepareOutputFormatter(utils, spinupParameter);
+
+   SIMULATIONCONTEXT spinupContext(utils, spinupParameter, weather, management, allometry);
+   step.runModelSimulationUntilDay(branchDay - 1, spinupContext, spinupParameter, init, community, recruitment, mortality, growth, spinupSoil, interaction, spinupOutput);
+
+   spinupOutput.writeSimulationResultsToOutputFiles(utils);
+   spinupOutput.closeOutputFiles(utils);
+   const std::vector<std::string> spinupFileNames = spinupOutput.outputFileNames;
+
+   /* branches continuing from the state of the spin-up */
+   std::mutex failureMutex;
+   failedBranches.clear();
+
+   std::vector<std::function<void()>> tasks;
+   for (std::size_t branch = 0; branch < managementFiles.size(); branch++)
+   {
+      tasks.push_back([&, branch]()
+                      {
+                         try
+                         {
+                            TRACESCOPE traceScope("branch", "branch", static_cast<long long>(branch));
+                            PARAMETER branchParameter = spinupParameter;
+                            branchParameter.day = branchDay;
+                            branchParameter.managementFile = managementFiles[branch];
+                            COMMUNITY branchCommunity = community;
+                            RECRUITMENT branchRecruitment = recruitment;
+                            SOIL branchSoil = spinupSoil;
+                            INTERACTION branchInteraction = interaction;
+
+                            INIT branchInit;
+                            STEP branchStep;
+                            MORTALITY branchMortality;
+                            GROWTH branchGrowth;
+                            OUTPUT branchOutput;
+
+                            /* output files of the branch start with the results of the spin-up */
+                            branchOutput.useSharedSettings(sharedOutput, OUTPUT::getScenarioName(managementFiles[branch]));
+                            branchOutput.aggregatorCommunity = spinupOutput.aggregatorCommunity;
+                            branchOutput.aggregatorPFTPopulation = spinupOutput.aggregatorPFTPopulation;
+                            branchOutput.createOutputFolder(path, utils);
+                            branchOutput.createOutputFileNames(branchParameter, utils);
+                            for (std::size_t file = 0; file < spinupFileNames.size(); file++)
+                            {
+                               std::filesystem::copy_file(spinupFileNames[file], branchOutput.outputFileNames[file], std::filesystem::copy_options::overwrite_existing);
+                               branchOutput.resumedFileSizes.push_back(std::filesystem::file_size(spinupFileNames[file]));
+                            }
+                            branchOutput.createAndOpenOutputFiles(branchParameter, utils);
+                            branchOutput.writeHeaderInOutputFiles(utils); // only selects the fields (files contain the header)
+                            branchOutput.formatter.prepareOutputFormatter(utils, branchParameter);
+
+                            SIMULATIONCONTEXT branchContext(utils, branchParameter, weather, branchManagements[branch], allometry);
+                            branchStep.runModelSimulation(branchContext, branchParameter, branchInit, branchCommunity, branchRecruitment, branchMortality, branchGrowth, branchSoil, branchInteraction, branchOutput);
+
+                            branchOutput.writeSimulationResultsToOutputFiles(utils);
+                            branchOutput.closeOutputFiles(utils);
+                         }
+                         catch (const std::exception &e)
+                         {
+                            std::lock_guard<std::mutex> lock(failureMutex);
+                            failedBranches.push_back("Branch " + managementFiles[branch] + " failed: " + e.what());
+                         } });
+   }
+   WORKERPOOL pool;
+   pool.run(tasks, numberOfThreads);
+
+   for (const auto &spinupFileName : spinupFileNames)
+   {
+      std::error_code error;
+      std::filesystem::remove(spinupFileName, error);
+   }
+
+   for (const auto &failure : failedBranches)
+   {
+      utils.handleError(failure);
+   }
+}
@@ -0,0 +1,48 @@
+#pragma once
+#include "../module_parameter/parameter.h"
+#include "../module_weather/weather.h"
+#include "../module_soil/soil.h"
+#include "../module_management/management.h"
+#include "../module_plant/allometry.h"
+#include "../module_output/output.h"
+#include "../utils/utils.h"
+#include <deque>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runs several management scenarios that branch from one shared spin-up simulation.
+ *
+ * The spin-up period from the first simulated day up to the day before the branch date is
+ * simulated only once with the management of the configuration file. At the branch date, the
+ * mutable simulation state (parameters incl. the current day, community, recruitment, soil and
+ * interaction) is copied into one branch per management file. Weather, plant traits and
+ * allometry are not copied but shared read-only by all branches. The branches are simulated
+ * on a work-stealing pool of worker threads (see `WORKERPOOL`).
+ *
+ * Each branch writes its own output files, named as a single run with the management scenario
+ * appended (e.g. `__GER_Lange`). They contain the results of the spin-up period followed by the
+ * results of the branch, i.e. a branch is identical to a single run with its management file if
+ * its management has no events before the branch date.
+ *
+ * Command line: `GRASSMIND3 <configuration file> --branch-date 2016-01-01 --branches <management file>,<management file> [--threads 4]`,
+ * management files are given by their names in scenarios/<site>/management/.
+ */
+class FORK
+{
+public:
+   FORK();
+   ~FORK();
+
+   bool forkActivated;                       /// Branches are simulated (--branches option given)
+   std::string branchDate;                   /// Date of the first simulated day of the branches (YYYY-MM-DD)
+   std::vector<std::string> managementFiles; /// Management files of the branches
+   int numberOfThreads;                      /// Number of worker threads (0 = number of hardware threads)
+   std::vector<std::string> failedBranches;  /// Error messages of branches that could not be simulated
+
+   bool readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils);
+   void runFork(const std::string &path, const UTILS &utils, const PARAMETER &parameter, const WEATHER &weather, const SOIL &soil, const MANAGEMENT &management, const ALLOMETRY &allometry, const OUTPUT &sharedOutput);
+
+private:
+   void printForkSettingsToConsole(int branchDay) const;
+};
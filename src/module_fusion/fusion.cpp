@@ -0,0 +1,193 @@
+#include "fusion.h"
+#include "../module_init/constants.h"
+#include <algorithm>
+#include <cmath>
+#include <type_traits>
+
+FUSION::FUSION() {};
+FUSION::~FUSION() {};
+
+/**
+ * @brief Performs the daily cohort fusion of the community.
+ *
+ * If cohort fusion is activated, similar cohorts are merged with the configured tolerances.
+ * If the number of cohorts afterwards still exceeds `parameter.maximumNumberOfCohorts` (0 = no limit),
+ * the tolerances are doubled and the fusion is repeated until the limit is met.
+ *
+ * @param utils Const reference to a `UTILS` object used for error handling.
+ * @param parameter Const reference to a `PARAMETER` object holding the fusion settings.
+ * @param community Reference to a `COMMUNITY` object whose cohorts are merged.
+ */
+void FUSION::doCohortFusion(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community)
+{
+   toleranceScale = 1.0;
+   numberOfFusedCohorts = 0;
+
+   if (!parameter.cohortFusionActivated)
+   {
+      return;
+   }
+
+   numberOfFusedCohorts += fuseSimilarCohorts(parameter, community, toleranceScale);
+
+   if (parameter.maximumNumberOfCohorts > 0)
+   {
+      int numberOfDoublings = 0;
+      while (community.allPlants.size() > parameter.maximumNumberOfCohorts && numberOfDoublings < maximumToleranceDoublings)
+      {
+         toleranceScale *= 2.0;
+         numberOfDoublings++;
+         numberOfFusedCohorts += fuseSimilarCohorts(parameter, community, toleranceScale);
+      }
+
+      if (community.allPlants.size() > parameter.maximumNumberOfCohorts)
+      {
+         utils.handleWarning("Warning (cohort fusion): the maximum number of cohorts is exceeded even after widening the fusion tolerances.");
+      }
+   }
+
+   community.totalNumberOfCohortsInCommunity = community.allPlants.size();
+}
+
+/**
+ * @brief Merges all cohorts that are similar to a preceding cohort of the same PFT.
+ *
+ * The cohorts are sorted by PFT, age and height. Each cohort not yet merged becomes a target,
+ * and all following cohorts of the same PFT within the age tolerance are merged into it if
+ * their height and plant biomass are within the relative tolerances. The merged cohorts are
+ * removed from the community table afterwards, keeping the order of the remaining cohorts.
+ *
+ * @param parameter Const reference to a `PARAMETER` object holding the fusion tolerances.
+ * @param community Reference to a `COMMUNITY` object whose cohorts are merged.
+ * @param scale Factor applied to all tolerances.
+ * @return Number of cohorts merged into other cohorts.
+ */
+int FUSION::fuseSimilarCohorts(const PARAMETER &parameter, COMMUNITY &community, double scale)
+{
+   COHORTTABLE &allPlants = community.allPlants;
+   int numberOfCohorts = allPlants.size();
+   int numberOfMergedCohorts = 0;
+
+   if (numberOfCohorts < 2)
+   {
+      return numberOfMergedCohorts;
+   }
+
+   cohortOrder.resize(numberOfCohorts);
+   for (int cohortIndex = 0; cohortIndex < numberOfCohorts; cohortIndex++)
+   {
+      cohortOrder[cohortIndex] = cohortIndex;
+   }
+   std::sort(cohortOrder.begin(), cohortOrder.end(), [&allPlants](int a, int b)
+             {
+                if (allPlants.pft[a] != allPlants.pft[b])
+                {
+                   return allPlants.pft[a] < allPlants.pft[b];
+                }
+                if (allPlants.age[a] != allPlants.age[b])
+                {
+                   return allPlants.age[a] < allPlants.age[b];
+                }
+                if (allPlants.height[a] != allPlants.height[b])
+                {
+                   return allPlants.height[a] < allPlants.height[b];
+                }
+                return a < b; });
+
+   cohortIsFused.assign(numberOfCohorts, false);
+   double ageTolerance = parameter.cohortFusionAgeTolerance * scale;
+
+   for (int i = 0; i < numberOfCohorts; i++)
+   {
+      int targetIndex = cohortOrder[i];
+      if (cohortIsFused[targetIndex] || allPlants.amount[targetIndex] <= 0)
+      {
+         continue;
+      }
+
+      for (int j = i + 1; j < numberOfCohorts; j++)
+      {
+         int sourceIndex = cohortOrder[j];
+         if (allPlants.pft[sourceIndex] != allPlants.pft[targetIndex] || allPlants.age[sourceIndex] - allPlants.age[targetIndex] > ageTolerance)
+         {
+            break; // sorted order: no further cohort of this PFT within the age tolerance
+         }
+         if (cohortIsFused[sourceIndex] || allPlants.amount[sourceIndex] <= 0)
+         {
+            continue;
+         }
+         if (cohortsAreSimilar(parameter, community, targetIndex, sourceIndex, scale))
+         {
+            mergeCohorts(community, targetIndex, sourceIndex);
+            cohortIsFused[sourceIndex] = true;
+            numberOfMergedCohorts++;
+         }
+      }
+   }
+
+   if (numberOfMergedCohorts > 0)
+   {
+      allPlants.removeCohorts(cohortIsFused);
+   }
+
+   return numberOfMergedCohorts;
+}
+
+/**
+ * @brief Checks whether the height and plant biomass of two cohorts are within the relative tolerances.
+ *
+ * The differences are related to the larger of both values, so that the check is symmetric.
+ *
+ * @param parameter Const reference to a `PARAMETER` object holding the fusion tolerances.
+ * @param community Const reference to a `COMMUNITY` object holding the cohorts.
+ * @param targetIndex Index of the first cohort.
+ * @param sourceIndex Index of the second cohort.
+ * @param scale Factor applied to the tolerances.
+ * @return True if both cohorts may be merged.
+ */
+bool FUSION::cohortsAreSimilar(const PARAMETER &parameter, const COMMUNITY &community, int targetIndex, int sourceIndex, double scale)
+{
+   const COHORTTABLE &allPlants = community.allPlants;
+
+   double heightDifference = std::fabs(allPlants.height[targetIndex] - allPlants.height[sourceIndex]);
+   double heightReference = std::max(allPlants.height[targetIndex], allPlants.height[sourceIndex]);
+   if (heightDifference > parameter.cohortFusionHeightTolerance * scale * heightReference)
+   {
+      return false;
+   }
+
+   double biomassDifference = std::fabs(allPlants.plantBiomass[targetIndex] - allPlants.plantBiomass[sourceIndex]);
+   double biomassReference = std::max(allPlants.plantBiomass[targetIndex], allPlants.plantBiomass[sourceIndex]);
+   return biomassDifference <= parameter.cohortFusionBiomassTolerance * scale * biomassReference;
+}
+
+/**
+ * @brief Merges the source cohort into the target cohort.
+ *
+ * All per-plant state variables become the amount-weighted mean of both cohorts, so that the
+ * total biomass, carbon and nitrogen mass (amount times per-plant value) is conserved. The
+ * amounts are added up, and the merged cohort keeps the PFT and cohort id of the target.
+ *
+ * @param community Reference to a `COMMUNITY` object holding the cohorts.
+ * @param targetIndex Index of the cohort that remains.
+ * @param sourceIndex Index of the cohort merged into the target.
+ */
+void FUSION::mergeCohorts(COMMUNITY &community, int targetIndex, int sourceIndex)
+{
+   COHORTTABLE &allPlants = community.allPlants;
+
+   double targetAmount = allPlants.amount[targetIndex];
+   double sourceAmount = allPlants.amount[sourceIndex];
+   double totalAmount = targetAmount + sourceAmount;
+
+   allPlants.forEachColumn([&](auto &column)
+                           {
+                              using VALUE = typename std::decay_t<decltype(column)>::value_type;
+                              if constexpr (std::is_same<VALUE, double>::value)
+                              {
+                                 column[targetIndex] = (column[targetIndex] * targetAmount + column[sourceIndex] * sourceAmount) / totalAmount;
+                              } });
+
+   allPlants.amount[targetIndex] += allPlants.amount[sourceIndex];
+   allPlants.numberOfSoilLayersRooting[targetIndex] = std::ceil(allPlants.rootingDepth[targetIndex] / soilLayerWidth);
+}
\ No newline at end of file
@@ -0,0 +1,38 @@
+#pragma once
+#include "../module_plant/community.h"
+#include "../module_parameter/parameter.h"
+#include "../utils/utils.h"
+#include <vector>
+
+/**
+ * @class FUSION
+ * @brief Merges similar plant cohorts to bound the number of cohorts in the community.
+ *
+ * With a continuous seed influx, every day adds new cohorts to the community, so that the
+ * number of cohorts (and thereby the computational costs of a day step) grows over time.
+ * The FUSION class merges cohorts of the same plant functional type (PFT) whose age, height
+ * and plant biomass differ by less than the configured tolerances into one cohort. The amount
+ * of plants as well as the biomass, carbon and nitrogen mass of the community are conserved.
+ *
+ * If a maximum number of cohorts is configured and still exceeded after fusion, the tolerances
+ * are doubled until the number of cohorts falls below the limit.
+ */
+class FUSION
+{
+public:
+   FUSION();
+   ~FUSION();
+
+   double toleranceScale;    /// Factor applied to the tolerances in the last fusion pass of the day
+   int numberOfFusedCohorts; /// Number of cohorts merged into other cohorts during the current day
+
+   void doCohortFusion(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community);
+   int fuseSimilarCohorts(const PARAMETER &parameter, COMMUNITY &community, double scale);
+   bool cohortsAreSimilar(const PARAMETER &parameter, const COMMUNITY &community, int targetIndex, int sourceIndex, double scale);
+   void mergeCohorts(COMMUNITY &community, int targetIndex, int sourceIndex);
+
+private:
+   std::vector<int> cohortOrder;             /// Cohort indices sorted by PFT, age and height
+   std::vector<bool> cohortIsFused;          /// Flags of cohorts merged into another cohort
+   const int maximumToleranceDoublings = 16; /// Upper limit of tolerance doublings to reach the maximum number of cohorts
+};
\ No newline at end of file
@@ -8,7 +8,7 @@ GROWTH::~GROWTH() {};
  * @cite Concept of plant NPP based on the carbon balance of photosynthesis and respiration
  *       based on the forest model FORMIND (www.formind.org)
  */
-void GROWTH::doPlantGrowth(UTILS utils, PARAMETER parameter, COMMUNITY &community, INTERACTION interaction, ALLOMETRY allometry, SOIL &soil)
+void GROWTH::doPlantGrowth(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const INTERACTION &interaction, const ALLOMETRY &allometry, SOIL &soil)
 {
    /* Plant GPP (gross primary productivity) */
    doPlantPhotosynthesis(parameter, community, interaction);
@@ -49,21 +49,21 @@ void GROWTH::doPlantGrowth(UTILS utils, PARAMETER parameter, COMMUNITY &communit
  * @param interaction   Struct holding current environmental conditions such as radiation, air temperature, and day length, potentially modified through plant interactions.
  *
  * @see calculateGPPOfPlant()
- * @see calculateEffectOfAirTemperatureOnGPP()
+ * @see DAILYDRIVERTABLE::calculateEffectOfAirTemperatureOnGPP()
  * @cite Concept of plant photosynthesis is based on the forest model FORMIND (www.formind.org)
  */
-void GROWTH::doPlantPhotosynthesis(PARAMETER parameter, COMMUNITY &community, INTERACTION interaction)
+void GROWTH::doPlantPhotosynthesis(const PARAMETER &parameter, COMMUNITY &community, const INTERACTION &interaction)
 {
    for (int cohortindex = 0; cohortindex < community.totalNumberOfCohortsInCommunity; cohortindex++)
    {
-      int pft = community.allPlants.at(cohortindex)->pft;
-      double plantLAI = community.allPlants.at(cohortindex)->laiGreen;
-      double plantCoveredArea = community.allPlants.at(cohortindex)->coveredArea;
+      int pft = community.allPlants.pft[cohortindex];
+      double plantLAI = community.allPlants.laiGreen[cohortindex];
+      double plantCoveredArea = community.allPlants.coveredArea[cohortindex];
 
-      double plantRadiation = (24.0 / interaction.dayLength) * community.allPlants.at(cohortindex)->availableRadiation; // correct mean daily radiation by daylength hours for photosynthesis
-      double effectOfDayTimeTemperature = calculateEffectOfAirTemperatureOnGPP(interaction.dayTimeAirTemperature);
+      double plantRadiation = interaction.radiationCorrectionForDayLength * community.allPlants.availableRadiation[cohortindex]; // correct mean daily radiation by daylength hours for photosynthesis
+      double effectOfDayTimeTemperature = interaction.effectOfDayTimeAirTemperatureOnGpp;
 
-      community.allPlants.at(cohortindex)->gpp = effectOfDayTimeTemperature * calculateGPPOfPlant(parameter, pft, plantLAI, plantCoveredArea, plantRadiation, interaction.dayLength);
+      community.allPlants.gpp[cohortindex] = effectOfDayTimeTemperature * calculateGPPOfPlant(parameter, pft, plantLAI, plantCoveredArea, plantRadiation, interaction.secondsOfDaylight);
    }
 }
 
@@ -87,14 +87,14 @@ void GROWTH::doPlantPhotosynthesis(PARAMETER parameter, COMMUNITY &community, IN
  * @param plantLAI              Leaf area index of the plant.
  * @param plantCoveredArea      Ground area covered by the plant (in cm²).
  * @param plantRadiation        Available radiation for the plant (in µmol(photons)/m²).
- * @param dayLength             Length of the day in hours.
+ * @param secondsOfDaylight     Duration of daylight in seconds (see DAILYDRIVERTABLE).
  *
  * @return Gross primary productivity (GPP) in grams of organic dry matter (ODM) per day.
  *
  * @see calculateCO2UptakePerSecondAndSquareMeter()
  * @cite Concept of plant photosynthesis is based on the forest model FORMIND (www.formind.org)
  */
-double GROWTH::calculateGPPOfPlant(PARAMETER parameter, int pft, double plantLAI, double plantCoveredArea, double plantRadiation, double dayLength)
+double GROWTH::calculateGPPOfPlant(const PARAMETER &parameter, int pft, double plantLAI, double plantCoveredArea, double plantRadiation, double secondsOfDaylight)
 {
    if (plantRadiation == 0)
    {
@@ -105,8 +105,7 @@ double GROWTH::calculateGPPOfPlant(PARAMETER parameter, int pft, double plantLAI
       double CO2UptakePerSecondAndSquareMeter = calculateCO2UptakePerSecondAndSquareMeter(parameter, pft, plantRadiation, plantLAI);
       double OdmUptakePerSecondAndSquareMeter = CO2UptakePerSecondAndSquareMeter * CO2ConversionToOdm * molarMassOfCO2; // conversion from CO2 to Odm
       double OdmUptakePerSecondAndSquareCentimeter = OdmUptakePerSecondAndSquareMeter / (100.0 * 100.0);
-      double secondsPerDay = dayLength * 60 * 60;                                                                  // scaling from seconds to day
-      double plantPhotosynthesisPerDay = OdmUptakePerSecondAndSquareCentimeter * secondsPerDay * plantCoveredArea; // scaling to plant
+      double plantPhotosynthesisPerDay = OdmUptakePerSecondAndSquareCentimeter * secondsOfDaylight * plantCoveredArea; // scaling from seconds to day and to plant
 
       return plantPhotosynthesisPerDay; // g ODM per day and plant
    }
@@ -135,7 +134,7 @@ double GROWTH::calculateGPPOfPlant(PARAMETER parameter, int pft, double plantLAI
  * @return CO₂ uptake rate in mol CO₂ per second per square meter of leaf area.
  * @cite Concept of plant CO2 uptake is based on the forest model FORMIND (www.formind.org)
  */
-double GROWTH::calculateCO2UptakePerSecondAndSquareMeter(PARAMETER parameter, int pft, double plantRadiation, double plantLAI)
+double GROWTH::calculateCO2UptakePerSecondAndSquareMeter(const PARAMETER &parameter, int pft, double plantRadiation, double plantLAI)
 {
    const double alpha = parameter.initialSlopeOfLightResponseCurve.at(pft);
    const double k = parameter.lightExtinctionCoefficients.at(pft);
@@ -148,53 +147,6 @@ double GROWTH::calculateCO2UptakePerSecondAndSquareMeter(PARAMETER parameter, in
    return (CO2UptakePerSecondsAndSquareMeter);
 }
 
-/**
- * @brief Calculates the temperature-based reduction factor for gross primary productivity (GPP).
- *
- * This function determines how daytime air temperature influences the plant's ability
- * to photosynthesize. It returns a dimensionless reduction factor between 0 and 1
- * that scales GPP accordingly.
- *
- * The relationship is piecewise linear and defined as follows:
- * - **For temperatures ≤ -5°C**:      no photosynthesis (factor = 0)
- * - **Between -5°C and 2°C**:         linear increase from 0 to ~0.2
- * - **Between 2°C and 10°C**:         linear increase from ~0.2 to 1.0
- * - **Above 10°C**:                   no limitation (factor = 1.0)
- *
- * @param dayTimeAirTemperature  Daytime air temperature in degrees Celsius.
- *
- * @return Reduction factor (0.0 – 1.0) for GPP based on air temperature.
- * @cite Temperature effects are based on publication:
- *       Schippers & Kropff 2001, Functional Ecology 15, 155–164
- */
-double GROWTH::calculateEffectOfAirTemperatureOnGPP(double dayTimeAirTemperature)
-{
-   double reductionFactor = 0;
-   int day;
-
-   if (dayTimeAirTemperature <= -5)
-   {
-      reductionFactor = 0;
-   }
-
-   if (dayTimeAirTemperature > -5 && dayTimeAirTemperature <= 2)
-   {
-      reductionFactor = (0.02857 * dayTimeAirTemperature + 0.142);
-   }
-
-   if (dayTimeAirTemperature > 2 && dayTimeAirTemperature <= 10)
-   {
-      reductionFactor = (0.1 * dayTimeAirTemperature);
-   }
-
-   if (dayTimeAirTemperature > 10)
-   {
-      reductionFactor = 1.0;
-   }
-
-   return reductionFactor;
-}
-
 /**
  * @brief Calculates maintenance respiration for all plant cohorts in the community.
  *
@@ -205,7 +157,7 @@ double GROWTH::calculateEffectOfAirTemperatureOnGPP(double dayTimeAirTemperature
  * - The sum of green shoot and root biomass,
  * - A PFT-specific base respiration rate,
  * - A temperature-dependent correction factor from
- *   `calculateEffectOfAirTemperatureOnRespiration()`.
+ *   `DAILYDRIVERTABLE::calculateEffectOfAirTemperatureOnRespiration()`, precomputed per day.
  *
  * @note Here, only maintenance respiration is considered. Growth respiration is calculated later on.
  *
@@ -213,55 +165,18 @@ double GROWTH::calculateEffectOfAirTemperatureOnGPP(double dayTimeAirTemperature
  * @param parameter   Struct with physiological parameters, including respiration rates per PFT.
  * @param interaction Struct holding environmental data, such as full-day air temperature.
  *
- * @see calculateEffectOfAirTemperatureOnRespiration()
+ * @see DAILYDRIVERTABLE::calculateEffectOfAirTemperatureOnRespiration()
  */
-void GROWTH::doPlantRespiration(COMMUNITY &community, PARAMETER parameter, INTERACTION interaction)
+void GROWTH::doPlantRespiration(COMMUNITY &community, const PARAMETER &parameter, const INTERACTION &interaction)
 {
    for (int cohortindex = 0; cohortindex < community.totalNumberOfCohortsInCommunity; cohortindex++)
    {
-      int pft = community.allPlants.at(cohortindex)->pft;
-      double greenShootBiomass = community.allPlants.at(cohortindex)->shootBiomassGreenLeaves;
-      double rootBiomass = community.allPlants.at(cohortindex)->rootBiomass;
-      double effectOfTemperature = calculateEffectOfAirTemperatureOnRespiration(parameter, interaction.fullDayAirTemperature);
-      community.allPlants.at(cohortindex)->maintenanceRespiration = effectOfTemperature * parameter.maintenanceRespirationRate * (greenShootBiomass + rootBiomass);
-   }
-}
-
-/**
- * @brief Calculates a temperature-dependent scaling factor for plant respiration.
- *
- * This function estimates how air temperature affects the rate of maintenance
- * respiration using a Q₁₀ temperature response model. The result is a dimensionless
- * factor used to scale base respiration rates.
- *
- * The temperature response is modeled as follows:
- * - **For T > 15°C**: Q₁₀ model is applied where `Q10` is the base rate and `T_ref` is the reference temperature.
- * - **For T ≤ 0°C**: Respiration is fully suppressed (factor = 0).
- * - **For 0°C < T ≤ 15°C**: A linear interpolation from 0 to ~0.5.
- *
- * @param parameter      Struct containing plant functional type-specific parameters,
- *                       including `plantResponseToTemperatureQ10Base` and reference temperature.
- * @param airTemperature Full-day mean air temperature in degrees Celsius.
- *
- * @return Temperature-dependent reduction factor for maintenance respiration (unitless).
- * @cite Temperature effect is based on publication:
- *       Schippers & Kropff 2001, Functional Ecology 15, 155–164
- */
-double GROWTH::calculateEffectOfAirTemperatureOnRespiration(PARAMETER parameter, double airTemperature)
-{
-   double reductionFactor = 0;
-
-   if (airTemperature > 15)
-   {
-      double tExponent = (airTemperature - parameter.plantResponseToTemperatureQ10Reference) / 10.0;
-      reductionFactor = std::pow(parameter.plantResponseToTemperatureQ10Base, tExponent);
+      int pft = community.allPlants.pft[cohortindex];
+      double greenShootBiomass = community.allPlants.shootBiomassGreenLeaves[cohortindex];
+      double rootBiomass = community.allPlants.rootBiomass[cohortindex];
+      double effectOfTemperature = interaction.effectOfFullDayAirTemperatureOnRespiration;
+      community.allPlants.maintenanceRespiration[cohortindex] = effectOfTemperature * parameter.maintenanceRespirationRate * (greenShootBiomass + rootBiomass);
    }
-   else if (airTemperature <= 0)
-      reductionFactor = 0;
-   else
-      reductionFactor = 0.03333 * airTemperature;
-
-   return reductionFactor;
 }
 
 /**
@@ -281,42 +196,42 @@ double GROWTH::calculateEffectOfAirTemperatureOnRespiration(PARAMETER parameter,
  * @cite Concept of plant NPP based on the carbon balance of photosynthesis and respiration including buffer is
  *       based on the forest model FORMIND (www.formind.org)
  */
-void GROWTH::calculatePlantNPPFromGPPAndRespiration(COMMUNITY &community, PARAMETER parameter)
+void GROWTH::calculatePlantNPPFromGPPAndRespiration(COMMUNITY &community, const PARAMETER &parameter)
 {
    for (int cohortindex = 0; cohortindex < community.totalNumberOfCohortsInCommunity; cohortindex++)
    {
-      int pft = community.allPlants.at(cohortindex)->pft;
-      double plantGPP = community.allPlants.at(cohortindex)->gpp;
-      double maintenanceRespiration = community.allPlants.at(cohortindex)->maintenanceRespiration;
+      int pft = community.allPlants.pft[cohortindex];
+      double plantGPP = community.allPlants.gpp[cohortindex];
+      double maintenanceRespiration = community.allPlants.maintenanceRespiration[cohortindex];
       double growthRespiration = 0;
 
       if (plantGPP > maintenanceRespiration)
       {
          growthRespiration = parameter.growthRespirationFraction * (plantGPP - maintenanceRespiration);
-         community.allPlants.at(cohortindex)->growthRespiration = growthRespiration;
+         community.allPlants.growthRespiration[cohortindex] = growthRespiration;
       }
       else
       {
          growthRespiration = 0;
-         community.allPlants.at(cohortindex)->growthRespiration = 0;
+         community.allPlants.growthRespiration[cohortindex] = 0;
       }
 
-      community.allPlants.at(cohortindex)->totalRespiration = maintenanceRespiration + growthRespiration;
+      community.allPlants.totalRespiration[cohortindex] = maintenanceRespiration + growthRespiration;
 
-      double biomassIncrement = plantGPP - community.allPlants.at(cohortindex)->totalRespiration + community.allPlants.at(cohortindex)->nppBuffer;
+      double biomassIncrement = plantGPP - community.allPlants.totalRespiration[cohortindex] + community.allPlants.nppBuffer[cohortindex];
 
       // ==== reset buffer for next year ====
-      community.allPlants.at(cohortindex)->nppBuffer = 0.0; // reset for current year
+      community.allPlants.nppBuffer[cohortindex] = 0.0; // reset for current year
       if (biomassIncrement < 0)
       {
-         community.allPlants.at(cohortindex)->nppBuffer = biomassIncrement;      // add negative NPP to buffer and adjust balance
-         community.allPlants.at(cohortindex)->maintenanceRespiration = plantGPP; // all GPP is used for respiration
-         community.allPlants.at(cohortindex)->growthRespiration = 0;
-         community.allPlants.at(cohortindex)->totalRespiration = maintenanceRespiration;
+         community.allPlants.nppBuffer[cohortindex] = biomassIncrement;      // add negative NPP to buffer and adjust balance
+         community.allPlants.maintenanceRespiration[cohortindex] = plantGPP; // all GPP is used for respiration
+         community.allPlants.growthRespiration[cohortindex] = 0;
+         community.allPlants.totalRespiration[cohortindex] = maintenanceRespiration;
          biomassIncrement = 0;
       }
 
-      community.allPlants.at(cohortindex)->npp = biomassIncrement;
+      community.allPlants.npp[cohortindex] = biomassIncrement;
    }
 }
 
@@ -347,85 +262,85 @@ void GROWTH::calculatePlantNPPFromGPPAndRespiration(COMMUNITY &community, PARAME
  * @throws std::runtime_error if the sum of green and brown biomass fractions
  *         does not equal 1, indicating an inconsistency in biomass allocation.
  */
-void GROWTH::doPlantNPPAllocation(UTILS utils, PARAMETER parameter, COMMUNITY &community, SOIL &soil)
+void GROWTH::doPlantNPPAllocation(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, SOIL &soil)
 {
    for (int cohortindex = 0; cohortindex < community.totalNumberOfCohortsInCommunity; cohortindex++)
    {
-      int pft = community.allPlants.at(cohortindex)->pft;
-      double biomassIncrementForAllocation = community.allPlants.at(cohortindex)->npp;
+      int pft = community.allPlants.pft[cohortindex];
+      double biomassIncrementForAllocation = community.allPlants.npp[cohortindex];
 
       if (biomassIncrementForAllocation > 0)
       {
          /// aboveground shoot allocation
-         community.allPlants.at(cohortindex)->shootBiomassGreenLeaves += biomassIncrementForAllocation * community.allPlants.at(cohortindex)->nppAllocationShoot;
-         community.allPlants.at(cohortindex)->shootBiomass = community.allPlants.at(cohortindex)->shootBiomassGreenLeaves + community.allPlants.at(cohortindex)->shootBiomassBrownLeaves;
-         community.allPlants.at(cohortindex)->shootCarbonGreenLeaves = community.allPlants.at(cohortindex)->shootBiomassGreenLeaves * carbonContentOdm;
-         community.allPlants.at(cohortindex)->shootCarbon = community.allPlants.at(cohortindex)->shootBiomass * carbonContentOdm;
-         community.allPlants.at(cohortindex)->shootNitrogenGreenLeaves = community.allPlants.at(cohortindex)->shootBiomassGreenLeaves / parameter.plantCNRatioGreenLeaves[pft];
-         community.allPlants.at(cohortindex)->shootNitrogen = community.allPlants.at(cohortindex)->shootNitrogenGreenLeaves + community.allPlants.at(cohortindex)->shootNitrogenBrownLeaves;
+         community.allPlants.shootBiomassGreenLeaves[cohortindex] += biomassIncrementForAllocation * community.allPlants.nppAllocationShoot[cohortindex];
+         community.allPlants.shootBiomass[cohortindex] = community.allPlants.shootBiomassGreenLeaves[cohortindex] + community.allPlants.shootBiomassBrownLeaves[cohortindex];
+         community.allPlants.shootCarbonGreenLeaves[cohortindex] = community.allPlants.shootBiomassGreenLeaves[cohortindex] * carbonContentOdm;
+         community.allPlants.shootCarbon[cohortindex] = community.allPlants.shootBiomass[cohortindex] * carbonContentOdm;
+         community.allPlants.shootNitrogenGreenLeaves[cohortindex] = community.allPlants.shootBiomassGreenLeaves[cohortindex] / parameter.plantCNRatioGreenLeaves[pft];
+         community.allPlants.shootNitrogen[cohortindex] = community.allPlants.shootNitrogenGreenLeaves[cohortindex] + community.allPlants.shootNitrogenBrownLeaves[cohortindex];
 
          /// belowground root allocation
-         community.allPlants.at(cohortindex)->rootBiomass += biomassIncrementForAllocation * community.allPlants.at(cohortindex)->nppAllocationRoot;
-         community.allPlants.at(cohortindex)->rootCarbon = community.allPlants.at(cohortindex)->rootBiomass * carbonContentOdm;
-         community.allPlants.at(cohortindex)->rootNitrogen = community.allPlants.at(cohortindex)->rootCarbon / parameter.plantCNRatioRoots[pft];
+         community.allPlants.rootBiomass[cohortindex] += biomassIncrementForAllocation * community.allPlants.nppAllocationRoot[cohortindex];
+         community.allPlants.rootCarbon[cohortindex] = community.allPlants.rootBiomass[cohortindex] * carbonContentOdm;
+         community.allPlants.rootNitrogen[cohortindex] = community.allPlants.rootCarbon[cohortindex] / parameter.plantCNRatioRoots[pft];
 
          /// plant biomass update
-         community.allPlants.at(cohortindex)->plantBiomass = community.allPlants.at(cohortindex)->shootBiomass + community.allPlants.at(cohortindex)->rootBiomass;
-         community.allPlants.at(cohortindex)->plantCarbon = community.allPlants.at(cohortindex)->plantBiomass * carbonContentOdm;
-         community.allPlants.at(cohortindex)->plantNitrogen = community.allPlants.at(cohortindex)->shootNitrogen + community.allPlants.at(cohortindex)->rootNitrogen;
+         community.allPlants.plantBiomass[cohortindex] = community.allPlants.shootBiomass[cohortindex] + community.allPlants.rootBiomass[cohortindex];
+         community.allPlants.plantCarbon[cohortindex] = community.allPlants.plantBiomass[cohortindex] * carbonContentOdm;
+         community.allPlants.plantNitrogen[cohortindex] = community.allPlants.shootNitrogen[cohortindex] + community.allPlants.rootNitrogen[cohortindex];
 
          /// allocation to recruitment biomass pool for seed production
-         community.allPlants.at(cohortindex)->recruitmentBiomass += biomassIncrementForAllocation * community.allPlants.at(cohortindex)->nppAllocationRecruitment;
-         community.allPlants.at(cohortindex)->recruitmentCarbon = community.allPlants.at(cohortindex)->recruitmentBiomass * carbonContentOdm;
-         community.allPlants.at(cohortindex)->recruitmentNitrogen = community.allPlants.at(cohortindex)->recruitmentCarbon / parameter.plantCNRatioSeeds[pft];
+         community.allPlants.recruitmentBiomass[cohortindex] += biomassIncrementForAllocation * community.allPlants.nppAllocationRecruitment[cohortindex];
+         community.allPlants.recruitmentCarbon[cohortindex] = community.allPlants.recruitmentBiomass[cohortindex] * carbonContentOdm;
+         community.allPlants.recruitmentNitrogen[cohortindex] = community.allPlants.recruitmentCarbon[cohortindex] / parameter.plantCNRatioSeeds[pft];
 
          /// allocation to exudates
-         community.allPlants.at(cohortindex)->exudationBiomass = biomassIncrementForAllocation * community.allPlants.at(cohortindex)->nppAllocationExudation;
-         community.allPlants.at(cohortindex)->exudationCarbon = community.allPlants.at(cohortindex)->exudationBiomass * carbonContentOdm;
-         community.allPlants.at(cohortindex)->exudationNitrogen = community.allPlants.at(cohortindex)->exudationCarbon / parameter.plantCNRatioExudates[pft];
+         community.allPlants.exudationBiomass[cohortindex] = biomassIncrementForAllocation * community.allPlants.nppAllocationExudation[cohortindex];
+         community.allPlants.exudationCarbon[cohortindex] = community.allPlants.exudationBiomass[cohortindex] * carbonContentOdm;
+         community.allPlants.exudationNitrogen[cohortindex] = community.allPlants.exudationCarbon[cohortindex] / parameter.plantCNRatioExudates[pft];
 
          // to be added: transfer exudation biomass to soil pool
-         // soil.CPool_Soil_active += community.allPlants.at(cohortindex)->amount * community.allPlants.at(cohortindex)->exudationBiomass;
-         // community.allPlants.at(cohortindex)->exudationBiomass = 0;
+         // soil.CPool_Soil_active += community.allPlants.amount[cohortindex] * community.allPlants.exudationBiomass[cohortindex];
+         // community.allPlants.exudationBiomass[cohortindex] = 0;
       }
    }
 }
 
-void GROWTH::doPlantGrowthInSizeAndAging(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry)
+void GROWTH::doPlantGrowthInSizeAndAging(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry)
 {
    for (int cohortindex = 0; cohortindex < community.totalNumberOfCohortsInCommunity; cohortindex++)
    {
-      int pft = community.allPlants.at(cohortindex)->pft;
-      community.allPlants.at(cohortindex)->age += 1;
+      int pft = community.allPlants.pft[cohortindex];
+      community.allPlants.age[cohortindex] += 1;
 
-      double heightBeforeGrowth = community.allPlants.at(cohortindex)->height; // possibly not matching widthBeforeGrowth in case of mowing
-      double widthBeforeGrowth = community.allPlants.at(cohortindex)->width;
+      double heightBeforeGrowth = community.allPlants.height[cohortindex]; // possibly not matching widthBeforeGrowth in case of mowing
+      double widthBeforeGrowth = community.allPlants.width[cohortindex];
       double heightMatchingWidthByRatio = allometry.heightFromWidthByRatio(widthBeforeGrowth, parameter.plantHeightToWidthRatio[pft]);
 
       if (heightBeforeGrowth < heightMatchingWidthByRatio)
       { /// regrowing (e.g. after mowing): all biomass increment is put only into height growth, until height-width-ratio is reached again
-         double newHeightByGrowthOnlyInHeight = allometry.heightFromShootBiomassWidthShootCorrection(utils, community.allPlants.at(cohortindex)->shootBiomass, widthBeforeGrowth, parameter.plantShootCorrectionFactor[pft]);
+         double newHeightByGrowthOnlyInHeight = allometry.heightFromShootBiomassWidthShootCorrection(utils, community.allPlants.shootBiomass[cohortindex], widthBeforeGrowth, parameter.plantShootCorrectionFactor[pft]);
          /// update new height based on biomass increment
-         community.allPlants.at(cohortindex)->height = newHeightByGrowthOnlyInHeight;
+         community.allPlants.height[cohortindex] = newHeightByGrowthOnlyInHeight;
       }
       else
       { /// normal geometry calculation can be used again: growth in width and height proportionally
-         double newWidthByGrowthInHeightAndWidth = allometry.widthFromShootBiomassByRatioAndShootCorrection(utils, community.allPlants.at(cohortindex)->shootBiomass, parameter.plantHeightToWidthRatio[pft], parameter.plantShootCorrectionFactor[pft]);
+         double newWidthByGrowthInHeightAndWidth = allometry.widthFromShootBiomassByRatioAndShootCorrection(utils, community.allPlants.shootBiomass[cohortindex], parameter.plantHeightToWidthRatio[pft], parameter.plantShootCorrectionFactor[pft]);
          double newHeightByGrowthInHeightAndWidth = allometry.heightFromWidthByRatio(newWidthByGrowthInHeightAndWidth, parameter.plantHeightToWidthRatio[pft]);
 
-         community.allPlants.at(cohortindex)->width = newWidthByGrowthInHeightAndWidth;
-         community.allPlants.at(cohortindex)->height = newHeightByGrowthInHeightAndWidth;
-         community.allPlants.at(cohortindex)->coveredArea = allometry.areaFromWidth(newWidthByGrowthInHeightAndWidth);
+         community.allPlants.width[cohortindex] = newWidthByGrowthInHeightAndWidth;
+         community.allPlants.height[cohortindex] = newHeightByGrowthInHeightAndWidth;
+         community.allPlants.coveredArea[cohortindex] = allometry.areaFromWidth(newWidthByGrowthInHeightAndWidth);
       }
 
       /// update all other geometric size variables of the plants
-      community.allPlants.at(cohortindex)->rootingDepth = allometry.rootDepthFromRootBiomassParametersRatioAndShootCorrection(utils, community.allPlants.at(cohortindex)->rootBiomass, parameter.plantRootDepthParamIntercept[pft], parameter.plantRootDepthParamExponent[pft], parameter.plantShootRootRatio[pft], parameter.plantShootCorrectionFactor[pft]);
-      community.allPlants.at(cohortindex)->numberOfSoilLayersRooting = std::ceil(community.allPlants.at(cohortindex)->rootingDepth / soilLayerWidth);
-      community.allPlants.at(cohortindex)->laiGreen =
-          allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.at(cohortindex)->shootBiomassGreenLeaves, community.allPlants.at(cohortindex)->coveredArea, parameter.plantSpecificLeafArea[pft]);
-      community.allPlants.at(cohortindex)->laiBrown =
-          allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.at(cohortindex)->shootBiomassBrownLeaves, community.allPlants.at(cohortindex)->coveredArea, parameter.plantSpecificLeafArea[pft]);
-      community.allPlants.at(cohortindex)->lai = community.allPlants.at(cohortindex)->laiBrown + community.allPlants.at(cohortindex)->laiGreen;
+      community.allPlants.rootingDepth[cohortindex] = allometry.rootDepthFromRootBiomassParametersRatioAndShootCorrection(utils, community.allPlants.rootBiomass[cohortindex], parameter.plantRootDepthParamIntercept[pft], parameter.plantRootDepthParamExponent[pft], parameter.plantShootRootRatio[pft], parameter.plantShootCorrectionFactor[pft]);
+      community.allPlants.numberOfSoilLayersRooting[cohortindex] = std::ceil(community.allPlants.rootingDepth[cohortindex] / soilLayerWidth);
+      community.allPlants.laiGreen[cohortindex] =
+          allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.shootBiomassGreenLeaves[cohortindex], community.allPlants.coveredArea[cohortindex], parameter.plantSpecificLeafArea[pft]);
+      community.allPlants.laiBrown[cohortindex] =
+          allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.shootBiomassBrownLeaves[cohortindex], community.allPlants.coveredArea[cohortindex], parameter.plantSpecificLeafArea[pft]);
+      community.allPlants.lai[cohortindex] = community.allPlants.laiBrown[cohortindex] + community.allPlants.laiGreen[cohortindex];
    }
 }
 
@@ -456,16 +371,16 @@ void GROWTH::doPlantGrowthInSizeAndAging(UTILS utils, PARAMETER parameter, COMMU
  * @throws std::runtime_error if the sum of allocation rates does not equal 1,
  *         indicating an inconsistency in allocation rates.
  */
-void GROWTH::adjustAllocationRates(UTILS utils, PARAMETER parameter, COMMUNITY &community)
+void GROWTH::adjustAllocationRates(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community)
 {
    double proportionOfNppAllocationToPlantGrowthToShoot;
    for (int cohortindex = 0; cohortindex < community.totalNumberOfCohortsInCommunity; cohortindex++)
    {
-      int pft = community.allPlants.at(cohortindex)->pft;
+      int pft = community.allPlants.pft[cohortindex];
       proportionOfNppAllocationToPlantGrowthToShoot = calculateProportionalityFactorForAllocationDistributionToPlantParts(parameter, community, cohortindex, pft);
 
       // adjusting allocations depending on plant height, possibly changing back and forth due to mowing
-      if (community.allPlants.at(cohortindex)->height >= parameter.maturityHeights[pft])
+      if (community.allPlants.height[cohortindex] >= parameter.maturityHeights[pft])
       {
          adjustAllocationRatesForMaturePlants(parameter, community, cohortindex, pft, proportionOfNppAllocationToPlantGrowthToShoot);
       }
@@ -474,8 +389,8 @@ void GROWTH::adjustAllocationRates(UTILS utils, PARAMETER parameter, COMMUNITY &
          adjustAllocationRatesForRegrowingPlants(parameter, community, cohortindex, pft, proportionOfNppAllocationToPlantGrowthToShoot);
       }
 
-      if (abs(community.allPlants.at(cohortindex)->nppAllocationShoot + community.allPlants.at(cohortindex)->nppAllocationRoot + community.allPlants.at(cohortindex)->nppAllocationRecruitment +
-              community.allPlants.at(cohortindex)->nppAllocationExudation - 1) > tolerance)
+      if (abs(community.allPlants.nppAllocationShoot[cohortindex] + community.allPlants.nppAllocationRoot[cohortindex] + community.allPlants.nppAllocationRecruitment[cohortindex] +
+              community.allPlants.nppAllocationExudation[cohortindex] - 1) > tolerance)
       {
          utils.handleError("Sum of alloction rates (shoot, root, recruitment, exudates does not equal one as required!");
       }
@@ -509,10 +424,10 @@ void GROWTH::adjustAllocationRates(UTILS utils, PARAMETER parameter, COMMUNITY &
  *       the dynamic allocation based on the current GPP and the existing
  *       biomass of shoots and roots.
  */
-double GROWTH::calculateProportionalityFactorForAllocationDistributionToPlantParts(PARAMETER parameter, COMMUNITY &community, int cohortindex, int pft)
+double GROWTH::calculateProportionalityFactorForAllocationDistributionToPlantParts(const PARAMETER &parameter, COMMUNITY &community, int cohortindex, int pft)
 {
    double shootRootRatio = parameter.plantShootRootRatio[pft];
-   double gpp = community.allPlants.at(cohortindex)->gpp;
+   double gpp = community.allPlants.gpp[cohortindex];
 
    if (parameter.useStaticShootRootAllocationRates)
    {
@@ -524,7 +439,7 @@ double GROWTH::calculateProportionalityFactorForAllocationDistributionToPlantPar
       // distribute gpp such that actual shoot_root ratio converge towards par value
       // calc proportion of Gpp that must go into Shoot in order to restore shoot-root ratio
       // use proportionOfGppToShoot as proportionOfNppAllocationToPlantGrowthToShoot
-      double proportionOfGppToShoot = (shootRootRatio * (community.allPlants.at(cohortindex)->rootBiomass + gpp) - community.allPlants.at(cohortindex)->shootBiomass) / ((1 + shootRootRatio) * gpp);
+      double proportionOfGppToShoot = (shootRootRatio * (community.allPlants.rootBiomass[cohortindex] + gpp) - community.allPlants.shootBiomass[cohortindex]) / ((1 + shootRootRatio) * gpp);
       (proportionOfGppToShoot > 1) ? (proportionOfGppToShoot = 1) : ((proportionOfGppToShoot < 0) ? (proportionOfGppToShoot = 0) : (proportionOfGppToShoot = proportionOfGppToShoot));
       return (proportionOfGppToShoot);
    }
@@ -559,15 +474,15 @@ double GROWTH::calculateProportionalityFactorForAllocationDistributionToPlantPar
  * - Calculates the recruitment allocation as the remaining NPP after
  *   allocating to growth and exudation.
  */
-void GROWTH::adjustAllocationRatesForMaturePlants(PARAMETER parameter, COMMUNITY &community, int cohortindex, int pft, double proportionOfNppAllocationToPlantGrowthToShoot)
+void GROWTH::adjustAllocationRatesForMaturePlants(const PARAMETER &parameter, COMMUNITY &community, int cohortindex, int pft, double proportionOfNppAllocationToPlantGrowthToShoot)
 {
    /// NPP distributed to shoot, root, exudates with remaining part allocated to seed production
-   community.allPlants.at(cohortindex)->nppAllocationShoot =
+   community.allPlants.nppAllocationShoot[cohortindex] =
        parameter.plantNppAllocationGrowth[pft] * proportionOfNppAllocationToPlantGrowthToShoot;
-   community.allPlants.at(cohortindex)->nppAllocationRoot =
+   community.allPlants.nppAllocationRoot[cohortindex] =
        parameter.plantNppAllocationGrowth[pft] * (1 - proportionOfNppAllocationToPlantGrowthToShoot);
-   community.allPlants.at(cohortindex)->nppAllocationExudation = parameter.plantNppAllocationExudation[pft];
-   community.allPlants.at(cohortindex)->nppAllocationRecruitment =
+   community.allPlants.nppAllocationExudation[cohortindex] = parameter.plantNppAllocationExudation[pft];
+   community.allPlants.nppAllocationRecruitment[cohortindex] =
        1 - parameter.plantNppAllocationGrowth[pft] - parameter.plantNppAllocationExudation[pft];
 }
 
@@ -601,13 +516,13 @@ void GROWTH::adjustAllocationRatesForMaturePlants(PARAMETER parameter, COMMUNITY
  * - Sets the recruitment allocation to zero, as no recruitment is possible
  *   during the regrowing phase.
  */
-void GROWTH::adjustAllocationRatesForRegrowingPlants(PARAMETER parameter, COMMUNITY &community, int cohortindex, int pft, double proportionOfNppAllocationToPlantGrowthToShoot)
+void GROWTH::adjustAllocationRatesForRegrowingPlants(const PARAMETER &parameter, COMMUNITY &community, int cohortindex, int pft, double proportionOfNppAllocationToPlantGrowthToShoot)
 {
    /// NPP distributed to shoot, root and exudates (no recruitment possible)
-   community.allPlants.at(cohortindex)->nppAllocationShoot =
+   community.allPlants.nppAllocationShoot[cohortindex] =
        (1 - parameter.plantNppAllocationExudation[pft]) * proportionOfNppAllocationToPlantGrowthToShoot;
-   community.allPlants.at(cohortindex)->nppAllocationRoot =
+   community.allPlants.nppAllocationRoot[cohortindex] =
        (1 - parameter.plantNppAllocationExudation[pft]) * (1 - proportionOfNppAllocationToPlantGrowthToShoot);
-   community.allPlants.at(cohortindex)->nppAllocationRecruitment = 0;
-   community.allPlants.at(cohortindex)->nppAllocationExudation = parameter.plantNppAllocationExudation[pft];
+   community.allPlants.nppAllocationRecruitment[cohortindex] = 0;
+   community.allPlants.nppAllocationExudation[cohortindex] = parameter.plantNppAllocationExudation[pft];
 }
\ No newline at end of file
@@ -12,20 +12,18 @@ public:
    GROWTH();
    ~GROWTH();
 
-   void doPlantGrowth(UTILS utils, PARAMETER parameter, COMMUNITY &community, INTERACTION interaction, ALLOMETRY allometry, SOIL &soil);
+   void doPlantGrowth(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const INTERACTION &interaction, const ALLOMETRY &allometry, SOIL &soil);
 
-   void doPlantPhotosynthesis(PARAMETER parameter, COMMUNITY &community, INTERACTION interaction);
-   double calculateGPPOfPlant(PARAMETER parameter, int pft, double plantLAI, double plantCoveredAre, double plantRadiation, double dayLength);
-   double calculateCO2UptakePerSecondAndSquareMeter(PARAMETER parameter, int pft, double plantRadiation, double plantLAI);
+   void doPlantPhotosynthesis(const PARAMETER &parameter, COMMUNITY &community, const INTERACTION &interaction);
+   double calculateGPPOfPlant(const PARAMETER &parameter, int pft, double plantLAI, double plantCoveredAre, double plantRadiation, double secondsOfDaylight);
+   double calculateCO2UptakePerSecondAndSquareMeter(const PARAMETER &parameter, int pft, double plantRadiation, double plantLAI);
 
-   void doPlantRespiration(COMMUNITY &community, PARAMETER parameter, INTERACTION interaction);
-   void calculatePlantNPPFromGPPAndRespiration(COMMUNITY &community, PARAMETER parameter);
-   double calculateEffectOfAirTemperatureOnGPP(double dayTimeAirTemperature);
-   double calculateEffectOfAirTemperatureOnRespiration(PARAMETER parameter, double airTemperature);
-   void adjustAllocationRates(UTILS utils, PARAMETER parameter, COMMUNITY &community);
-   void doPlantNPPAllocation(UTILS utils, PARAMETER parameter, COMMUNITY &community, SOIL &soil);
-   double calculateProportionalityFactorForAllocationDistributionToPlantParts(PARAMETER parameter, COMMUNITY &community, int cohortindex, int pft);
-   void adjustAllocationRatesForMaturePlants(PARAMETER parameter, COMMUNITY &community, int cohortindex, int pft, double proportionOfNppAllocationToPlantGrowthToShoot);
-   void adjustAllocationRatesForRegrowingPlants(PARAMETER parameter, COMMUNITY &community, int cohortindex, int pft, double proportionOfNppAllocationToPlantGrowthToShoot);
-   void doPlantGrowthInSizeAndAging(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry);
+   void doPlantRespiration(COMMUNITY &community, const PARAMETER &parameter, const INTERACTION &interaction);
+   void calculatePlantNPPFromGPPAndRespiration(COMMUNITY &community, const PARAMETER &parameter);
+   void adjustAllocationRates(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community);
+   void doPlantNPPAllocation(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, SOIL &soil);
+   double calculateProportionalityFactorForAllocationDistributionToPlantParts(const PARAMETER &parameter, COMMUNITY &community, int cohortindex, int pft);
+   void adjustAllocationRatesForMaturePlants(const PARAMETER &parameter, COMMUNITY &community, int cohortindex, int pft, double proportionOfNppAllocationToPlantGrowthToShoot);
+   void adjustAllocationRatesForRegrowingPlants(const PARAMETER &parameter, COMMUNITY &community, int cohortindex, int pft, double proportionOfNppAllocationToPlantGrowthToShoot);
+   void doPlantGrowthInSizeAndAging(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry);
 };
\ No newline at end of file
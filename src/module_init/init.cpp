@@ -10,13 +10,16 @@ void INIT::initModelSimulation(PARAMETER &parameter, COMMUNITY &community, RECRU
    initTimeVariables(parameter);
 
    /* init random number generator seed */
-   initRandomNumberGeneratorSeed(parameter, community);
+   initRandomNumberGeneratorSeed(parameter);
 
    /* init state variables of community */
    initStateVariables(community, parameter, recruitment, soil);
 
+   /* init height layers of the canopy */
+   interaction.initHeightLayers();
+
    /* init process-specific state variables */
-   initAndResetProcessVariables(parameter, recruitment, community, interaction);
+   initAndResetProcessVariables(parameter, recruitment, community);
 }
 
 /* initialization of state variables of time */
@@ -26,18 +29,17 @@ void INIT::initTimeVariables(PARAMETER &parameter)
 }
 
 /* initialization of random number generator seed */
-void INIT::initRandomNumberGeneratorSeed(PARAMETER &parameter, COMMUNITY &community)
+void INIT::initRandomNumberGeneratorSeed(PARAMETER &parameter)
 {
    if (parameter.randomNumberGeneratorSeed == std::numeric_limits<int>::min())
    {
       std::random_device rd; // seed generator
       parameter.randomNumberGeneratorSeed = rd();
    }
-   community.randomNumberIndex = parameter.randomNumberGeneratorSeed;
 }
 
 /* initialization of the community vector and grassland state variables */
-void INIT::initStateVariables(COMMUNITY &community, PARAMETER parameter, RECRUITMENT &recruitment, SOIL &soil)
+void INIT::initStateVariables(COMMUNITY &community, const PARAMETER &parameter, RECRUITMENT &recruitment, SOIL &soil)
 {
    // simulation-related variables
    community.allPlants.clear();
@@ -65,7 +67,7 @@ void INIT::initStateVariables(COMMUNITY &community, PARAMETER parameter, RECRUIT
    soil.seedNitrogenSoilLitter = 0;
 }
 
-void INIT::initAndResetProcessVariables(PARAMETER parameter, RECRUITMENT &recruitment, COMMUNITY &community, INTERACTION &interaction)
+void INIT::initAndResetProcessVariables(const PARAMETER &parameter, RECRUITMENT &recruitment, COMMUNITY &community)
 {
    /// Process-related variables
    // 1. Recruitment
@@ -80,13 +82,7 @@ void INIT::initAndResetProcessVariables(PARAMETER parameter, RECRUITMENT &recrui
    }
 
    // 2. Light availability (interaction)
-   interaction.LAI.clear();
-   interaction.LAIwithLightExtinction.clear();
-   for (int layerindex = 0; layerindex <= maximumHeightLayer; layerindex++)
-   {
-      interaction.LAI.push_back(0.0);
-      interaction.LAIwithLightExtinction.push_back(0.0);
-   }
+   // height layers are reset up to the layer reached by the largest plant in calculateCumulativeLeafAreaIndexAcrossHeightLayers()
    community.maximumHeightOfAllPlants = 0;
 
    /// Output-related variables
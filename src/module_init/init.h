@@ -17,7 +17,7 @@ public:
 
    void initModelSimulation(PARAMETER &parameter, COMMUNITY &community, RECRUITMENT &recruitment, SOIL &soil, INTERACTION &interaction);
    void initTimeVariables(PARAMETER &parameter);
-   void initRandomNumberGeneratorSeed(PARAMETER &parameter, COMMUNITY &community);
-   void initStateVariables(COMMUNITY &community, PARAMETER parameter, RECRUITMENT &recruitment, SOIL &soil);
-   void initAndResetProcessVariables(PARAMETER parameter, RECRUITMENT &recruitment, COMMUNITY &community, INTERACTION &interaction);
+   void initRandomNumberGeneratorSeed(PARAMETER &parameter);
+   void initStateVariables(COMMUNITY &community, const PARAMETER &parameter, RECRUITMENT &recruitment, SOIL &soil);
+   void initAndResetProcessVariables(const PARAMETER &parameter, RECRUITMENT &recruitment, COMMUNITY &community);
 };
\ No newline at end of file
@@ -1,573 +1,506 @@
 #include "input.h"
+#include "../module_profile/trace.h"
 
 INPUT::INPUT() {};
 INPUT::~INPUT() {};
 
-std::map<std::string, int> INPUT::configParInt;
-std::map<std::string, float> INPUT::configParFloat;
-std::map<std::string, bool> INPUT::configParBool;
-std::map<std::string, std::string> INPUT::configParString;
-
 /* stream all relevant input data */
 void INPUT::getInputData(std::string path, UTILS utils, PARAMETER &parameter, WEATHER &weather, SOIL &soil, MANAGEMENT &management)
 {
-   openAndReadConfigurationFile(path, utils, parameter);
-   openAndReadPlantTraitsFile(path, utils, parameter);
-   openAndReadWeatherFile(path, utils, parameter, weather);
-   openAndReadSoilFile(path, utils, parameter, soil);
-   openAndReadManagementFile(path, utils, parameter, management);
+   {
+      TRACESCOPE traceScope("input_configuration");
+      openAndReadConfigurationFile(path, utils, parameter);
+   }
+   {
+      TRACESCOPE traceScope("input_plant_traits");
+      openAndReadPlantTraitsFile(path, utils, parameter);
+   }
+   {
+      TRACESCOPE traceScope("input_weather");
+      openAndReadWeatherFile(path, utils, parameter, weather);
+      weather.dailyDrivers.buildDailyDriverTable(parameter, weather);
+   }
+   {
+      TRACESCOPE traceScope("input_soil");
+      openAndReadSoilFile(path, utils, parameter, soil);
+   }
+   {
+      TRACESCOPE traceScope("input_management");
+      openAndReadManagementFile(path, utils, parameter, management);
+   }
 }
 
 /* open and read configuration file */
 void INPUT::openAndReadConfigurationFile(std::string config, UTILS utils, PARAMETER &parameter)
 {
    const char *filename = config.c_str();
-   for (auto par : parameter.configParameterNames) /* parameterNames are listed in the class definition of PARAMETER (parameter.h)*/
-   {
-      /* open file and search for name in all lines */
-      searchParameterInInputFile(par, filename, utils);
 
-      /* check if the parameter name was found at least once and read in each line */
-      checkIfParameterExistsAndExtractValues(utils, par, lineValues, lineNumbers, lineTypeValues);
+   /* read the file once and index all lines by their first word */
+   tokenizeParameterFile(filename, utils);
 
-      /* get the corresponding datatype for the extracted parameter value */
-      extractDataTypeForExtractedValue(utils, par);
+   /* replace values of the configuration file by given overrides (e.g. of a batch job) */
+   overrideParameterValues(utils);
 
-      /* convert the extracted value to its datatype, check for inconsistencies and map the value to the parameter name */
-      convertAndCheckAndSetParameterValue(utils, par, parameterType, parameter);
-   }
+   /* look up each parameter listed in the registry (registry.h), convert its value and assign it to PARAMETER */
+   readParametersFromTokenizedFile(utils, registry.configParameterFields, parameter);
 
-   /* transfer the mapped values of all parameter names to their variables in class PARAMETER */
-   transferConfigParameterValueToModelParameter(parameter, utils);
+   /* calculate the simulation period from the first and last year */
+   calculateSimulationPeriod(parameter, utils);
 }
 
-/* open file and search for name (keyword) in all lines */
-void INPUT::searchParameterInInputFile(std::string keyword, const char *filename, UTILS utils)
+/* read the whole parameter file in a single pass, split each line into words and index the lines by their first word */
+bool INPUT::tokenizeParameterFile(const char *filename, UTILS &utils)
 {
-   std::string line;   // current line text in parser
-   int lineNumber = 0; // current line number in parser
-   bool found = false; // was the keyword found in a streamed line?
-
-   lineValues.clear();
-   lineTypeValues.clear();
-   lineNumbers.clear();
+   parameterFileLines.clear();
+   parameterFileTokens.clear();
+   keywordLineIndex.clear();
 
-   /* detect all lines in which the keyword is found */
    std::ifstream file(filename);
+   if (!file.is_open())
+   {
+      std::string s = filename;
+      utils.handleError("Cannot open the file" + s + ". There is no simuation possible. Please check if the file exists.");
+      return false;
+   }
 
-   if (file.is_open())
+   std::string line;
+   while (std::getline(file, line))
    {
-      found = false;
-      while (std::getline(file, line))
+      /* split line into words separated by tabstops or free spaces */
+      std::vector<std::string> words;
+      std::size_t startIndex = 0;
+      for (std::size_t it = 0; it <= line.size(); it++)
       {
-         if (found) /* if in the previous line the keyword was found, save the next line as datatype in lineTypeValues */
+         if (it == line.size() || line[it] == '\t' || line[it] == ' ')
          {
-            lineTypeValues.push_back(line);
-            found = false;
+            if (it > startIndex)
+            {
+               words.push_back(line.substr(startIndex, it - startIndex));
+            }
+            startIndex = it + 1;
          }
+      }
 
-         lineNumber++;
-         if (line.find(keyword) != std::string::npos) /* if the keyword is found in this line, save line number and line text in vectors, set found to true so that next line on datatype is also saved */
-         {
-            lineNumbers.push_back(lineNumber);
-            lineValues.push_back(line);
-            found = true;
-         }
+      /* the correct format of a parameter line: the line starts with the parameter name followed by its value(s) */
+      if (words.size() > 0)
+      {
+         keywordLineIndex[words.at(0)].push_back((int)parameterFileLines.size());
       }
-      file.close();
-   }
-   else
-   {
-      std::string s = filename;
-      utils.handleError("Cannot open the file" + s + ". There is no simuation possible. Please check if the file exists.");
+
+      parameterFileLines.push_back(line);
+      parameterFileTokens.push_back(words);
    }
+   file.close();
+
+   return true;
 }
 
-/* check if the parameter name (keyowrd) was found at least once */
-void INPUT::checkIfParameterExistsAndExtractValues(UTILS utils, std::string keyword, std::vector<std::string> lineValues, std::vector<int> lineNumbers, std::vector<std::string> lineTypeValues)
+/* replace the value(s) of overridden parameters in the tokenized parameter file, so that they are converted and checked as read values */
+void INPUT::overrideParameterValues(UTILS &utils)
 {
-   /* if parameter name (keyword) was not found in the input file */
-   if (lineNumbers.size() == 0)
-   {
-      utils.handleError("The parameter " + keyword + " is missing in the input file. Please check the file!");
-   }
-
-   /* extract for each line with the found keyword only those that have the correct format */
-   if (lineNumbers.size() >= 1)
+   for (const auto &[keyword, value] : parameterOverrides)
    {
-      extractLinesOfCorrectFormat(utils, keyword, lineValues);
+      auto found = keywordLineIndex.find(keyword);
+      if (found == keywordLineIndex.end())
+      {
+         utils.handleError("The overridden parameter " + keyword + " is missing in the configuration file. Please check the file!");
+         continue;
+      }
+      std::vector<std::string> &words = parameterFileTokens.at(found->second.at(0));
+      words.resize(1);
+      words.push_back(value);
    }
 }
 
-/* read in each line, split string and save correct formatted parameter values in variables */
-void INPUT::extractLinesOfCorrectFormat(UTILS utils, std::string keyword, std::vector<std::string> lineValues)
+/* look up, convert and assign all parameters of a registry list from the tokenized parameter file */
+void INPUT::readParametersFromTokenizedFile(UTILS &utils, const std::vector<PARAMETERFIELD> &fields, PARAMETER &parameter)
 {
-   int index = 0;                          /* index used to track which of the found lines show the correct format of the found parameter (e.g. if found more than once) */
-   std::vector<std::string> valueElements; /* first splitted line string by tabstopp */
-   std::vector<std::string> cleanLine;     /* remove additional free spaces if they occur between the name and value of the parameter */
-
-   keywordLineNumbers.clear(); // all lines where the parameter was found in the correct format
-   keywordLineValues.clear();
-
-   for (auto line : lineValues)
+   for (const PARAMETERFIELD &field : fields)
    {
-      cleanLine.clear();
-      utils.strings.clear();
-      utils.splitString(line, '\t'); /* split string based on tabstop */
-      valueElements.clear();
-      for (auto it : utils.strings)
-      {
-         valueElements.push_back(it); /* save splitted string elements because ut.strings will be cleared at next step */
-      }
+      /* missing or invalid parameters keep the default value (of optional parameters, otherwise 0, false or empty) */
+      std::visit([&parameter, &field](auto member)
+                 {
+                    using MEMBER = std::decay_t<decltype(parameter.*member)>;
+                    const MEMBER *defaultValue = std::get_if<MEMBER>(&field.defaultValue);
+                    parameter.*member = defaultValue ? *defaultValue : MEMBER{}; },
+                 field.member);
 
-      for (auto it : valueElements)
+      /* optional parameters may be missing in the input file */
+      if (!std::holds_alternative<std::monostate>(field.defaultValue) && keywordLineIndex.find(field.name) == keywordLineIndex.end())
       {
-         utils.strings.clear();
-         utils.splitString(it, ' '); /* split string based on free space */
-         for (auto word : utils.strings)
-         {
-            if (word != "")
-            {
-               cleanLine.push_back(word); /* now no more free spaces should be included */
-            }
-         }
+         continue;
       }
 
-      if (cleanLine.at(0) == keyword) // the correct format: (cleaned) line should start with the parameter name (here, keyword) followed by its value
+      /* check if the parameter name was found exactly once in the correct format */
+      int lineIndex = findLineOfParameter(utils, field.name);
+      if (lineIndex < 0)
       {
-         if (cleanLine.size() == 1)
-         {
-            utils.handleError("A value is missing for the parameter " + keyword + ". Please check the input file!");
-         }
-         else
-         {
-            keywordLineNumbers.push_back(index);
-            for (int i = 1; i < cleanLine.size(); i++)
-            {
-               keywordLineValues.push_back(cleanLine.at(i));
-            }
-         }
+         continue;
       }
-      else
+
+      /* get the corresponding datatype from the line following the parameter value */
+      std::string parameterType = extractDataTypeOfParameter(utils, field.name, lineIndex);
+      if (parameterType == "")
       {
-         if (lineValues.size() > 1) /* case: there are more than one line in the input file where the parameter is mentioned */
-         {
-            utils.handleWarning("The parameter " + keyword + " is mentioned several times. Please check the input file!");
-         }
-         else /* case: there is only one line in the input file where the parameter is mentioned and its the false format */
-         {
-            utils.handleError("The parameter " + keyword + " is either missing or in a wrong format. Please check the input file!");
-         }
+         continue;
       }
-      index++;
+
+      /* convert the extracted value(s) to the datatype, check for inconsistencies and assign them to the PARAMETER member */
+      const std::vector<std::string> &words = parameterFileTokens.at(lineIndex);
+      std::vector<std::string> values(words.begin() + 1, words.end());
+      PARSEDVALUE value = convertAndCheckParameterValue(utils, field.name, parameterType, values, parameter);
+      assignParameterValue(utils, field, value, parameter);
    }
+}
 
-   if (keywordLineNumbers.size() == 0) /* none of the identified lines shows a correct format of the parameter */
+/* return the index of the line starting with the parameter name (keyword), or -1 if the parameter is missing */
+int INPUT::findLineOfParameter(UTILS &utils, const std::string &keyword)
+{
+   auto found = keywordLineIndex.find(keyword);
+
+   /* if parameter name (keyword) was not found in the input file */
+   if (found == keywordLineIndex.end())
    {
-      utils.handleError("The parameter " + keyword + " is either missing or in a wrong format. Please check the input file!");
+      utils.handleError("The parameter " + keyword + " is missing in the input file. Please check the file!");
+      return -1;
    }
-   else if (keywordLineNumbers.size() > 0) /* the parameter occurs at least once in the correct format */
+
+   int lineIndex = found->second.at(0);
+   if (found->second.size() > 1) /* the parameter occurs more than once in the correct format */
    {
+      utils.handleError("The parameter " + keyword + " occurs more than once in the input file. Please check the input file!");
+   }
 
-      if (keywordLineNumbers.size() > 1) /* the parameter occurs more than once in the correct format */
-      {
-         utils.handleError("The parameter " + keyword + " occurs more than once in the input file. Please check the input file!");
-      }
+   if (parameterFileTokens.at(lineIndex).size() == 1)
+   {
+      utils.handleError("A value is missing for the parameter " + keyword + ". Please check the input file!");
+      return -1;
    }
+
+   return lineIndex;
 }
 
 /* get the corresponding datatype for the extracted parameter value */
-void INPUT::extractDataTypeForExtractedValue(UTILS utils, std::string keyword)
+std::string INPUT::extractDataTypeOfParameter(UTILS &utils, const std::string &keyword, int lineIndex)
 {
-   if (keywordLineNumbers.size() > 0)
+   if (lineIndex + 1 >= (int)parameterFileLines.size())
    {
-      utils.strings.clear();
-      utils.splitString(lineTypeValues.at(keywordLineNumbers.at(0)), ':'); // now strings should have 2 elements: "\datatype" type
+      utils.handleError("The datatype is missing for the parameter " + keyword + ". Please check the input file!");
+      return "";
+   }
 
-      if (utils.strings.size() > 0)
-      {
-         if (utils.strings.at(0) != "\\datatype") // at least on index 2 of vector strings can be found
-         {
-            utils.handleError("The line following the parameter value for " + keyword + " does not include the datatype. Please check the input file!");
-         }
-         else
-         {
-            if (utils.strings.size() == 2)
-            {
-               parameterType = utils.strings.at(1);
-            }
-            else
-            {
-               utils.handleError("The datatype is missing for the parameter " + keyword + ". Please check the input file!");
-            }
-         }
-      }
-      else
-      {
-         utils.handleError("The datatype is missing for the parameter " + keyword + ". Please check the input file!");
-      }
+   utils.strings.clear();
+   utils.splitString(parameterFileLines.at(lineIndex + 1), ':'); // now strings should have 2 elements: "\datatype" type
+
+   if (utils.strings.at(0) != "\\datatype")
+   {
+      utils.handleError("The line following the parameter value for " + keyword + " does not include the datatype. Please check the input file!");
+      return "";
+   }
+   else if (utils.strings.size() != 2)
+   {
+      utils.handleError("The datatype is missing for the parameter " + keyword + ". Please check the input file!");
+      return "";
    }
+
+   return utils.strings.at(1);
 }
 
-/* convert the extracted value to its datatype, check for inconsistencies and map the value to the parameter name */
-void INPUT::convertAndCheckAndSetParameterValue(UTILS utils, std::string keyword, std::string parameterType, PARAMETER parameter)
+/* convert the extracted value(s) to their datatype and check for inconsistencies */
+PARSEDVALUE INPUT::convertAndCheckParameterValue(UTILS &utils, const std::string &keyword, const std::string &parameterType, const std::vector<std::string> &values, const PARAMETER &parameter)
 {
+   PARSEDVALUE value;
+
    if (parameterType == "integer")
    {
       try
       {
-
-         int value = utils.parseIntegerOrNaN(keywordLineValues.at(0));
-         if (value < 0 && keyword != "randomNumberGeneratorSeed")
+         int number = utils.parseIntegerOrNaN(values.at(0));
+         if (number < 0 && keyword != "randomNumberGeneratorSeed")
          {
             throw std::out_of_range("Value of parameter " + keyword + " is outside the valid range! Value is not allowed to be negative!");
          }
-         else
-         {
-            configParInt[keyword] = value;
-         }
+         value.integers.push_back(number);
       }
       catch (const std::out_of_range &e)
       {
          utils.handleError(e.what());
-         configParInt[keyword] = -1;
+         value.integers.push_back(-1);
       }
    }
    else if (parameterType == "float")
    {
       try
       {
-         float value = std::stof(keywordLineValues.at(0));
-         if (value < 0)
+         float number = std::stof(values.at(0));
+         if (number < 0)
          {
             throw std::out_of_range("Value of parameter " + keyword + " is outside the valid range! Value is not allowed to be negative!");
          }
-         else
-         {
-            configParFloat[keyword] = value;
-         }
+         value.floats.push_back(number);
       }
       catch (const std::out_of_range &e)
       {
          utils.handleError(e.what());
-         configParFloat[keyword] = -1;
+         value.floats.push_back(-1);
       }
    }
    else if (parameterType == "date")
    {
       try
       {
-         utils.strings.clear();
-         utils.splitString(keywordLineValues.at(0), '-');
-         int day = std::stoi(utils.strings.at(2));
-         int month = std::stoi(utils.strings.at(1));
-         int year = std::stoi(utils.strings.at(0));
-
-         // calculate given day as count from first simulated day
-         int dayCount = utils.calculateDayCountFromDate(day, month, year, parameter.referenceJulianDayStart);
-         if (dayCount < 0)
-         {
-            throw std::out_of_range("Value of parameter " + keyword + " is outside the valid range! Please check the date!");
-         }
-         else
-         {
-            configParInt[keyword] = dayCount;
-         }
+         value.integers.push_back(convertDateToDayCount(utils, keyword, values.at(0), parameter));
       }
       catch (const std::out_of_range &e)
       {
          utils.handleError(e.what());
-         configParInt[keyword] = -1;
+         value.integers.push_back(-1);
       }
    }
    else if (parameterType == "boolean")
    {
       try
       {
-         bool value = utils.stringToBool(keywordLineValues.at(0));
-         if (value != true && value != false)
-         {
-            throw std::out_of_range("Value of parameter " + keyword + " is outside the valid range!");
-         }
-         else
-         {
-            configParBool[keyword] = value;
-         }
+         value.integers.push_back(utils.stringToBool(values.at(0)));
       }
       catch (const std::out_of_range &e)
       {
          utils.handleError(e.what());
-         configParBool[keyword] = false;
+         value.integers.push_back(false);
       }
    }
    else if (parameterType == "string")
    {
       try
       {
-         if (keywordLineValues.at(0) == "")
-         {
-            if (keyword == "deimsID" || keyword == "outputWritingDatesFile")
-            {
-               throw std::out_of_range("Value of parameter " + keyword + " is not a string! If not in use or available, write at least NA in the parameter file.");
-            }
-            else
-            {
-               throw std::out_of_range("Value of parameter " + keyword + " is not a string! Please add an existing filename.");
-            }
-         }
-         else if (keyword != "deimsID" && keyword != "outputWritingDatesFile" && keywordLineValues.at(0) == "NA")
-         {
-            throw std::out_of_range("Value of parameter " + keyword + " is an invalid string! Please add an existing filename.");
-         }
-
-         if (keyword != "deimsID" && keyword != "latitude" && keyword != "longitude")
-         {
-            if (!(keyword == "outputWritingDatesFile" && keywordLineValues.at(0) == "NaN"))
-            {
-               std::string fileEnding = "";
-               fileEnding = utils.getFileEnding(keywordLineValues.at(0));
-               if (fileEnding != "txt")
-               {
-                  configParString[keyword] = keywordLineValues.at(0) + ".txt";
-               }
-               else
-               {
-                  configParString[keyword] = keywordLineValues.at(0);
-               }
-            }
-            else
-            {
-               configParString[keyword] = keywordLineValues.at(0);
-            }
-         }
-         else
-         {
-            configParString[keyword] = keywordLineValues.at(0);
-         }
+         value.strings.push_back(convertFileNameOrString(utils, keyword, values.at(0)));
       }
       catch (const std::out_of_range &e)
       {
          utils.handleError(e.what());
-         configParString[keyword] = "";
+         value.strings.push_back("");
       }
       catch (const std::invalid_argument &e)
       {
          utils.handleError(e.what());
-         configParString[keyword] = "";
+         value.strings.push_back("");
       }
    }
-   else if (parameterType == "integer-array")
+   else if (parameterType == "integer-array" || parameterType == "boolean-array")
    {
-      int value;
       std::string array_pos;
       try
       {
-         for (int i = 0; i < keywordLineValues.size(); i++)
+         for (int i = 0; i < values.size(); i++)
          {
             array_pos = std::to_string(i);
-            value = std::stoi(keywordLineValues.at(i));
-            if (value < 0)
+            int number = std::stoi(values.at(i));
+            if (number < 0)
             {
-               throw std::out_of_range("Value of parameter " + keyword + array_pos.c_str() + " is outside the valid range! Value is not allowed to be negative!");
-            }
-            else
-            {
-               configParInt[keyword + array_pos.c_str()] = value;
+               throw std::out_of_range("Value of parameter " + keyword + array_pos + " is outside the valid range! Value is not allowed to be negative!");
             }
+            value.integers.push_back(number);
          }
       }
       catch (const std::out_of_range &e)
       {
          utils.handleError(e.what());
-         configParInt[keyword + array_pos.c_str()] = -1;
+         value.integers.push_back(-1);
       }
    }
    else if (parameterType == "float-array")
    {
-      float value;
       std::string array_pos;
       try
       {
-         for (int i = 0; i < keywordLineValues.size(); i++)
+         for (int i = 0; i < values.size(); i++)
          {
             array_pos = std::to_string(i);
-            value = std::stof(keywordLineValues.at(i));
-            if (value < 0)
-            {
-               throw std::out_of_range("Value of parameter " + keyword + array_pos.c_str() + " is outside the valid range! Value is not allowed to be negative!");
-            }
-            else
+            float number = std::stof(values.at(i));
+            if (number < 0)
             {
-               configParFloat[keyword + array_pos.c_str()] = value;
+               throw std::out_of_range("Value of parameter " + keyword + array_pos + " is outside the valid range! Value is not allowed to be negative!");
             }
+            value.floats.push_back(number);
          }
       }
       catch (const std::out_of_range &e)
       {
          utils.handleError(e.what());
-         configParFloat[keyword + array_pos.c_str()] = -1;
+         value.floats.push_back(-1);
       }
    }
-   else if (parameterType == "boolean-array")
+   else if (parameterType == "string-array")
+   {
+      value.strings = values;
+   }
+   else if (parameterType == "date-array")
    {
-      int value;
       std::string array_pos;
       try
       {
-         for (int i = 0; i < keywordLineValues.size(); i++)
+         for (int i = 0; i < values.size(); i++)
          {
             array_pos = std::to_string(i);
-            value = std::stoi(keywordLineValues.at(i));
-            if (value < 0)
-            {
-               throw std::out_of_range("Value of parameter " + keyword + array_pos.c_str() + " is outside the valid range! Value is not allowed to be negative!");
-            }
-            else
-            {
-               configParBool[keyword + array_pos.c_str()] = value;
-            }
+            value.integers.push_back(convertDateToDayCount(utils, keyword + array_pos, values.at(i), parameter));
          }
       }
       catch (const std::out_of_range &e)
       {
          utils.handleError(e.what());
-         configParBool[keyword + array_pos.c_str()] = -1;
+         value.integers.push_back(-1);
       }
    }
-   else if (parameterType == "string-array")
+   else
    {
-      std::string value;
-      std::string array_pos;
-      try
+      utils.handleError("No valid datatype for the parameter " + keyword + ". Please check the input file!");
+   }
+
+   return value;
+}
+
+/* convert a date (YYYY-MM-DD) to the day count from the first simulated day */
+int INPUT::convertDateToDayCount(UTILS &utils, const std::string &keyword, const std::string &date, const PARAMETER &parameter)
+{
+   utils.strings.clear();
+   utils.splitString(date, '-');
+   int day = std::stoi(utils.strings.at(2));
+   int month = std::stoi(utils.strings.at(1));
+   int year = std::stoi(utils.strings.at(0));
+
+   // calculate given day as count from first simulated day
+   int dayCount = utils.calculateDayCountFromDate(day, month, year, parameter.referenceJulianDayStart);
+   if (dayCount < 0)
+   {
+      throw std::out_of_range("Value of parameter " + keyword + " is outside the valid range! Please check the date!");
+   }
+   return dayCount;
+}
+
+/* check a string value and add the file ending .txt to file names */
+std::string INPUT::convertFileNameOrString(UTILS &utils, const std::string &keyword, const std::string &value)
+{
+   if (value == "")
+   {
+      if (keyword == "deimsID" || keyword == "outputWritingDatesFile")
       {
-         for (int i = 0; i < keywordLineValues.size(); i++)
-         {
-            array_pos = std::to_string(i);
-            value = keywordLineValues.at(i);
-            configParString[keyword + array_pos.c_str()] = value;
-         }
+         throw std::out_of_range("Value of parameter " + keyword + " is not a string! If not in use or available, write at least NA in the parameter file.");
       }
-      catch (const std::out_of_range &e)
+      else
       {
-         utils.handleError(e.what());
-         configParString[keyword + array_pos.c_str()] = "NA";
+         throw std::out_of_range("Value of parameter " + keyword + " is not a string! Please add an existing filename.");
       }
    }
-   else if (parameterType == "date-array")
+   else if (keyword != "deimsID" && keyword != "outputWritingDatesFile" && value == "NA")
    {
-      std::string array_pos;
-      try
-      {
-         for (int i = 0; i < keywordLineValues.size(); i++)
-         {
-            array_pos = std::to_string(i);
+      throw std::out_of_range("Value of parameter " + keyword + " is an invalid string! Please add an existing filename.");
+   }
 
-            utils.strings.clear();
-            utils.splitString(keywordLineValues.at(i), '-');
-            int day = std::stoi(utils.strings.at(2));
-            int month = std::stoi(utils.strings.at(1));
-            int year = std::stoi(utils.strings.at(0));
-
-            // calculate given day as count from first simulated day
-            int dayCount = utils.calculateDayCountFromDate(day, month, year, parameter.referenceJulianDayStart);
-            if (dayCount < 0)
-            {
-               throw std::out_of_range("Value of parameter " + keyword + array_pos.c_str() + " is outside the valid range! Please check the date!");
-            }
-            else
-            {
-               configParInt[keyword + array_pos.c_str()] = dayCount;
-            }
-         }
-      }
-      catch (const std::out_of_range &e)
+   if (keyword != "deimsID" && keyword != "latitude" && keyword != "longitude" && keyword != "outputFormat" && keyword.rfind("outputCadence", 0) != 0 && !(keyword == "outputWritingDatesFile" && value == "NaN"))
+   {
+      if (utils.getFileEnding(value) != "txt")
       {
-         utils.handleError(e.what());
-         configParInt[keyword + array_pos.c_str()] = -1;
+         return value + ".txt";
       }
    }
-   else
+   return value;
+}
+
+/* collect the numeric values of a parsed parameter, returns false if the datatype does not fit the member type */
+template <typename VALUE>
+static bool getNumericParameterValues(const PARSEDVALUE &value, std::vector<VALUE> &numbers)
+{
+   numbers.clear();
+   if (!value.strings.empty() || (!value.floats.empty() && std::is_integral<VALUE>::value))
    {
-      utils.handleError("No valid datatype for the parameter " + keyword + ". Please check the input file!");
+      return false;
+   }
+   for (long long number : value.integers)
+   {
+      numbers.push_back((VALUE)number);
+   }
+   for (double number : value.floats)
+   {
+      numbers.push_back((VALUE)number);
+   }
+   return true;
+}
+
+/* assign the converted value(s) to the PARAMETER member registered for the parameter name */
+void INPUT::assignParameterValue(UTILS &utils, const PARAMETERFIELD &field, const PARSEDVALUE &value, PARAMETER &parameter)
+{
+   if (value.integers.empty() && value.floats.empty() && value.strings.empty())
+   {
+      return; // conversion failed, default value is kept
+   }
+
+   bool datatypeMatches = true;
+   std::visit([&](auto member)
+              {
+                 using MEMBER = std::decay_t<decltype(parameter.*member)>;
+                 if constexpr (std::is_same<MEMBER, std::string>::value)
+                 {
+                    datatypeMatches = !value.strings.empty();
+                    if (datatypeMatches)
+                    {
+                       parameter.*member = value.strings.at(0);
+                    }
+                 }
+                 else if constexpr (std::is_same<MEMBER, std::vector<std::string>>::value)
+                 {
+                    datatypeMatches = !value.strings.empty();
+                    if (datatypeMatches)
+                    {
+                       parameter.*member = value.strings;
+                    }
+                 }
+                 else if constexpr (std::is_arithmetic<MEMBER>::value)
+                 {
+                    std::vector<MEMBER> numbers;
+                    datatypeMatches = getNumericParameterValues(value, numbers);
+                    if (datatypeMatches)
+                    {
+                       parameter.*member = numbers.at(0);
+                    }
+                 }
+                 else
+                 {
+                    std::vector<typename MEMBER::value_type> numbers;
+                    datatypeMatches = getNumericParameterValues(value, numbers);
+                    if (datatypeMatches)
+                    {
+                       parameter.*member = MEMBER(numbers.begin(), numbers.end());
+                    }
+                 } },
+              field.member);
+
+   if (!datatypeMatches)
+   {
+      utils.handleError("The datatype of the parameter " + field.name + " does not match the model parameter. Please check the input file!");
    }
 }
 
-/* transfer the mapped values of all config parameter names to their variables in class PARAMETER */
-void INPUT::transferConfigParameterValueToModelParameter(PARAMETER &parameter, UTILS utils)
+/* calculate reference julian days (1 Jan of param.firstYear and 31 Dec of param.lastYear) and the simulation time */
+void INPUT::calculateSimulationPeriod(PARAMETER &parameter, UTILS &utils)
 {
-   parameter.deimsID = configParString["deimsID"];
-   parameter.latitude = configParString["latitude"];
-   parameter.longitude = configParString["longitude"];
-   parameter.weatherFile = configParString["weatherFile"];
-   parameter.soilFile = configParString["soilFile"];
-   parameter.managementFile = configParString["managementFile"];
-   parameter.plantTraitsFile = configParString["plantTraitsFile"];
-   parameter.outputWritingDatesFile = configParString["outputWritingDatesFile"];
-   parameter.clippingHeightOfBiomassMeasurement = configParFloat["clippingHeightOfBiomassMeasurement"];
-   parameter.randomNumberGeneratorSeed = configParInt["randomNumberGeneratorSeed"];
-   parameter.firstYear = configParInt["firstYear"];
-   parameter.lastYear = configParInt["lastYear"];
-   // calculate reference julian days (1 Jan of param.firstYear and 31 Dec of param.lastYear)
    parameter.referenceJulianDayStart = utils.calculateJulianDayFromDate(1, 1, parameter.firstYear);
    parameter.referenceJulianDayEnd = utils.calculateJulianDayFromDate(31, 12, parameter.lastYear);
    parameter.simulationTimeInDays = parameter.referenceJulianDayEnd - parameter.referenceJulianDayStart + 1;
 }
 
-/* transfer the mapped values of all plant trait parameter names to their variables in class PARAMETER */
-void INPUT::transferPlantTraitsParameterValueToModelParameter(PARAMETER &parameter)
+/* plant trait arrays hold one value per PFT: missing values are 0, surplus values are ignored */
+void INPUT::adjustPlantTraitArraysToPftCount(PARAMETER &parameter)
 {
-   parameter.pftCount = configParInt["pftCount"];
-
-   /* parameters independent of species or PFT */
-   parameter.crowdingMortalityActivated = configParBool["crowdingMortalityActivated"];
-   parameter.externalSeedInfluxActivated = configParBool["externalSeedInfluxActivated"];
-   parameter.dayOfExternalSeedInfluxStart = configParInt["dayOfExternalSeedInfluxStart"];
-   parameter.seedsFromMaturePlantsActivated = configParBool["seedsFromMaturePlantsActivated"];
-   parameter.useStaticShootRootAllocationRates = configParBool["useStaticShootRootAllocationRates"];
-   parameter.brownBiomassFractionFalling = configParFloat["brownBiomassFractionFalling"];
-   parameter.plantResponseToTemperatureQ10Base = configParFloat["plantResponseToTemperatureQ10Base"];
-   parameter.plantResponseToTemperatureQ10Reference = configParFloat["plantResponseToTemperatureQ10Reference"];
-   parameter.plantCostRhizobiaSymbiosis = configParFloat["plantCostRhizobiaSymbiosis"];
-   parameter.growthRespirationFraction = configParFloat["growthRespirationFraction"];
-   parameter.maintenanceRespirationRate = configParFloat["maintenanceRespirationRate"];
-
-   /* parameters dependent on species or PFT */
-   for (int pft = 0; pft < parameter.pftCount; pft++)
+   for (const PARAMETERFIELD &field : registry.plantTraitsParameterFields)
    {
-      std::string array_pos = std::to_string(pft);
-      parameter.maximumPlantHeight.push_back(configParInt["maximumPlantHeight" + array_pos]);
-      parameter.plantHeightToWidthRatio.push_back(configParFloat["plantHeightToWidthRatio" + array_pos]);
-      parameter.plantShootCorrectionFactor.push_back(configParFloat["plantShootCorrectionFactor" + array_pos]);
-      parameter.plantShootRootRatio.push_back(configParFloat["plantShootRootRatio" + array_pos]);
-      parameter.plantRootDepthParamIntercept.push_back(configParFloat["plantRootDepthParamIntercept" + array_pos]);
-      parameter.plantRootDepthParamExponent.push_back(configParFloat["plantRootDepthParamExponent" + array_pos]);
-      parameter.plantSpecificLeafArea.push_back(configParFloat["plantSpecificLeafArea" + array_pos]);
-      parameter.plantShootOverlapFactors.push_back(configParFloat["plantShootOverlapFactors" + array_pos]);
-      parameter.rootLifeSpan.push_back(configParInt["rootLifeSpan" + array_pos]);
-      parameter.leafLifeSpan.push_back(configParInt["leafLifeSpan" + array_pos]);
-      parameter.plantLifeSpan.push_back(configParString["plantLifeSpan" + array_pos]);
-      parameter.plantMortalityProbability.push_back(configParFloat["plantMortalityProbability" + array_pos]);
-      parameter.seedlingMortalityProbability.push_back(configParFloat["seedlingMortalityProbability" + array_pos]);
-      parameter.seedGerminationTimes.push_back(configParInt["seedGerminationTimes" + array_pos]);
-      parameter.seedGerminationRates.push_back(configParFloat["seedGerminationRates" + array_pos]);
-      parameter.seedMasses.push_back(configParFloat["seedMasses" + array_pos]);
-      parameter.maturityAges.push_back(configParFloat["maturityAges" + array_pos]);
-      parameter.maturityHeights.push_back(configParFloat["maturityHeights" + array_pos]);
-      parameter.externalSeedInfluxNumber.push_back(configParInt["externalSeedInfluxNumber" + array_pos]);
-      parameter.maximumGrossLeafPhotosynthesisRate.push_back(configParFloat["maximumGrossLeafPhotosynthesisRate" + array_pos]);
-      parameter.initialSlopeOfLightResponseCurve.push_back(configParFloat["initialSlopeOfLightResponseCurve" + array_pos]);
-      parameter.lightExtinctionCoefficients.push_back(configParFloat["lightExtinctionCoefficients" + array_pos]);
-      parameter.plantNppAllocationGrowth.push_back(configParFloat["plantNppAllocationGrowth" + array_pos]);
-      parameter.plantNppAllocationExudation.push_back(configParFloat["plantNppAllocationExudation" + array_pos]);
-      parameter.plantCNRatioGreenLeaves.push_back(configParFloat["plantCNRatioGreenLeaves" + array_pos]);
-      parameter.plantCNRatioBrownLeaves.push_back(configParFloat["plantCNRatioBrownLeaves" + array_pos]);
-      parameter.plantCNRatioRoots.push_back(configParFloat["plantCNRatioRoots" + array_pos]);
-      parameter.plantCNRatioSeeds.push_back(configParFloat["plantCNRatioSeeds" + array_pos]);
-      parameter.plantCNRatioExudates.push_back(configParFloat["plantCNRatioExudates" + array_pos]);
-      parameter.nitrogenFixationAbility.push_back(configParBool["nitrogenFixationAbility" + array_pos]);
-      parameter.plantWaterUseEfficiency.push_back(configParFloat["plantWaterUseEfficiency" + array_pos]);
-      parameter.plantMinimalSoilWaterForGppReduction.push_back(configParFloat["plantMinimalSoilWaterForGppReduction" + array_pos]);
-      parameter.plantMaximalSoilWaterForGppReduction.push_back(configParFloat["plantMaximalSoilWaterForGppReduction" + array_pos]);
+      std::visit([&parameter](auto member)
+                 {
+                    using MEMBER = std::decay_t<decltype(parameter.*member)>;
+                    if constexpr (!std::is_arithmetic<MEMBER>::value && !std::is_same<MEMBER, std::string>::value)
+                    {
+                       (parameter.*member).resize(std::max(parameter.pftCount, 0));
+                    } },
+                 field.member);
    }
 }
 
@@ -584,23 +517,14 @@ void INPUT::openAndReadPlantTraitsFile(std::string path, UTILS utils, PARAMETER
    plantTraitsDirectory = plantTraitsDirectory + "parameters\\" + parameter.plantTraitsFile;
    const char *filename = plantTraitsDirectory.c_str();
 
-   for (auto par : parameter.plantTraitsParameterNames) /* parameterNames are listed in the class definition of PARAMETER (parameter.h)*/
-   {
-      /* open file and search for name in all lines */
-      searchParameterInInputFile(par, filename, utils);
+   /* read the file once and index all lines by their first word */
+   plantTraitsFileOpened = tokenizeParameterFile(filename, utils);
 
-      /* check if the parameter name was found at least once and read in each line */
-      checkIfParameterExistsAndExtractValues(utils, par, lineValues, lineNumbers, lineTypeValues);
-
-      /* get the corresponding datatype for the extracted parameter value */
-      extractDataTypeForExtractedValue(utils, par);
-
-      /* convert the extracted value to its datatype, check for inconsistencies and map the value to the parameter name */
-      convertAndCheckAndSetParameterValue(utils, par, parameterType, parameter);
-   }
+   /* look up each parameter listed in the registry (registry.h), convert its value and assign it to PARAMETER */
+   readParametersFromTokenizedFile(utils, registry.plantTraitsParameterFields, parameter);
 
-   /* transfer the mapped values of all parameter names to their variables in class PARAMETER */
-   transferPlantTraitsParameterValueToModelParameter(parameter);
+   /* PFT-specific parameters: one value per PFT */
+   adjustPlantTraitArraysToPftCount(parameter);
 }
 
 /* read-in weather variables from input file */
@@ -726,21 +650,7 @@ void INPUT::openAndReadManagementFile(std::string path, UTILS utils, PARAMETER &
    manageDirectory = manageDirectory + "scenarios\\" + location + "\\management\\" + parameter.managementFile;
    const char *filename = manageDirectory.c_str();
 
-   management.mowingDate.clear();
-   management.mowingHeight.clear();
-
-   management.fertilizationDate.clear();
-   management.fertilizerAmount.clear();
-
-   management.irrigationDate.clear();
-   management.irrigationAmount.clear();
-
-   management.sowingDate.clear();
-   management.amountOfSownSeeds.clear(); // 2D vector
-   for (int pft = 0; pft < parameter.pftCount; pft++)
-   {
-      management.amountOfSownSeeds.push_back(std::vector<int>()); // add rows according to the number of pfts from configuration file
-   }
+   management.timeline.clear();
 
    std::string line;                      // current line text in parser
    int m = 0;                             // current line number in parser
@@ -842,8 +752,7 @@ void INPUT::openAndReadManagementFile(std::string path, UTILS utils, PARAMETER &
 
                      if (mowDay > 0 && mowDay < parameter.simulationTimeInDays)
                      {
-                        management.mowingDate.push_back(mowDay);
-                        management.mowingHeight.push_back(valueActionMowing);
+                        management.timeline.addEvent(mowDay, MANAGEMENTACTION::mowing, valueActionMowing);
                      }
                      else
                      {
@@ -870,8 +779,7 @@ void INPUT::openAndReadManagementFile(std::string path, UTILS utils, PARAMETER &
                      int fertDay = utils.calculateDayCountFromDate(day, month, year, parameter.referenceJulianDayStart);
                      if (fertDay > 0 && fertDay < parameter.simulationTimeInDays)
                      {
-                        management.fertilizationDate.push_back(fertDay);
-                        management.fertilizerAmount.push_back(valueActionFertilization);
+                        management.timeline.addEvent(fertDay, MANAGEMENTACTION::fertilization, valueActionFertilization);
                      }
                      else
                      {
@@ -898,8 +806,7 @@ void INPUT::openAndReadManagementFile(std::string path, UTILS utils, PARAMETER &
                      int irrigDay = utils.calculateDayCountFromDate(day, month, year, parameter.referenceJulianDayStart);
                      if (irrigDay > 0 && irrigDay < parameter.simulationTimeInDays)
                      {
-                        management.irrigationDate.push_back(irrigDay);
-                        management.irrigationAmount.push_back(valueActionIrrigation);
+                        management.timeline.addEvent(irrigDay, MANAGEMENTACTION::irrigation, valueActionIrrigation);
                      }
                      else
                      {
@@ -924,11 +831,12 @@ void INPUT::openAndReadManagementFile(std::string path, UTILS utils, PARAMETER &
                   int sowDay = utils.calculateDayCountFromDate(day, month, year, parameter.referenceJulianDayStart);
                   if (sowDay > 0 && sowDay < parameter.simulationTimeInDays)
                   {
-                     management.sowingDate.push_back(sowDay);
+                     std::vector<int> amountOfSownSeeds;
                      for (int pft = 0; pft < parameter.pftCount; pft++)
                      {
-                        management.amountOfSownSeeds[pft].push_back((int)valueActionSowing[pft]);
+                        amountOfSownSeeds.push_back((int)valueActionSowing[pft]);
                      }
+                     management.timeline.addEvent(sowDay, MANAGEMENTACTION::sowing, 0.0, amountOfSownSeeds);
                   }
                   else
                   {
@@ -948,6 +856,9 @@ void INPUT::openAndReadManagementFile(std::string path, UTILS utils, PARAMETER &
    {
       utils.handleError("Error (management input): The management file cannot be opened. Please check the name in the configuration file.");
    }
+
+   /* events sorted and indexed by day for the simulation */
+   management.timeline.compileTimeline(parameter.simulationTimeInDays);
 }
 
 /* Reads-in soil parameters from input file */
@@ -1,17 +1,31 @@
 #pragma once
 #include "../module_parameter/parameter.h"
+#include "../module_parameter/registry.h"
 #include "../module_weather/weather.h"
 #include "../module_soil/soil.h"
 #include "../module_management/management.h"
 #include "../utils/utils.h"
 #include "../module_init/constants.h"
 #include <iostream>
-#include <map>
+#include <unordered_map>
 #include <fstream>
 #include <string>
 #include <vector>
 #include <limits>
 #include <filesystem>
+#include <variant>
+#include <type_traits>
+#include <algorithm>
+
+/**
+ * @brief Value of a parameter converted according to the datatype given in the input file.
+ */
+struct PARSEDVALUE
+{
+   std::vector<long long> integers;  /// Values of the datatypes integer, date and boolean (and their arrays)
+   std::vector<double> floats;       /// Values of the datatypes float and float-array (single precision as read)
+   std::vector<std::string> strings; /// Values of the datatypes string and string-array
+};
 
 class INPUT
 {
@@ -29,20 +43,14 @@ public:
    bool managementFileOpened;
    bool soilFileOpened;
 
-   /* vectors to store information of parsed lines for parameters */
-   std::vector<std::string> lineValues;        // stored parameter text lines
-   std::vector<std::string> lineTypeValues;    // stored datatype lines of parameters
-   std::vector<int> lineNumbers;               // stored line numbers of parameters
-   std::vector<int> keywordLineNumbers;        // vector which stores only those lines that start with the correct format i.e. parameterName (here keyword)
-   std::vector<std::string> keywordLineValues; // vector which stores only values of those lines that start with the correct format i.e. parameterName (here keyword)
-   std::string parameterValue;
-   std::string parameterType;
-
-   /* auxillary structure to map parsed parameter to its name */
-   static std::map<std::string, int> configParInt;
-   static std::map<std::string, float> configParFloat;
-   static std::map<std::string, bool> configParBool;
-   static std::map<std::string, std::string> configParString;
+   PARAMETERREGISTRY registry; /// Keywords of all parameters and the PARAMETER members they are assigned to
+
+   std::vector<std::pair<std::string, std::string>> parameterOverrides; /// Values replacing parameters of the configuration file (e.g. set by a batch job)
+
+   /* parameter file tokenized in a single pass */
+   std::vector<std::string> parameterFileLines;                        // raw text lines of the parameter file
+   std::vector<std::vector<std::string>> parameterFileTokens;          // words of each line (separated by tabstops or free spaces)
+   std::unordered_map<std::string, std::vector<int>> keywordLineIndex; // indices of all lines starting with a word (i.e. a parameter name)
 
    /* functions of the INPUT class */
    void getInputData(std::string path, UTILS utils, PARAMETER &parameter, WEATHER &weather, SOIL &soil, MANAGEMENT &management);
@@ -52,11 +60,15 @@ public:
    void openAndReadSoilFile(std::string path, UTILS utils, PARAMETER &parameter, SOIL &soil);
    void openAndReadManagementFile(std::string path, UTILS utils, PARAMETER &parameter, MANAGEMENT &management);
 
-   void searchParameterInInputFile(std::string keyword, const char *filename, UTILS utils);
-   void checkIfParameterExistsAndExtractValues(UTILS utils, std::string keyword, std::vector<std::string> lineValues, std::vector<int> lineNumbers, std::vector<std::string> lineTypeValues);
-   void extractLinesOfCorrectFormat(UTILS utils, std::string keyword, std::vector<std::string> lineValues);
-   void extractDataTypeForExtractedValue(UTILS utils, std::string keyword);
-   void convertAndCheckAndSetParameterValue(UTILS utils, std::string keyword, std::string parameterType, PARAMETER parameter);
-   void transferConfigParameterValueToModelParameter(PARAMETER &parameter, UTILS utils);
-   void transferPlantTraitsParameterValueToModelParameter(PARAMETER &parameter);
+   bool tokenizeParameterFile(const char *filename, UTILS &utils);
+   void overrideParameterValues(UTILS &utils);
+   void readParametersFromTokenizedFile(UTILS &utils, const std::vector<PARAMETERFIELD> &fields, PARAMETER &parameter);
+   int findLineOfParameter(UTILS &utils, const std::string &keyword);
+   std::string extractDataTypeOfParameter(UTILS &utils, const std::string &keyword, int lineIndex);
+   PARSEDVALUE convertAndCheckParameterValue(UTILS &utils, const std::string &keyword, const std::string &parameterType, const std::vector<std::string> &values, const PARAMETER &parameter);
+   int convertDateToDayCount(UTILS &utils, const std::string &keyword, const std::string &date, const PARAMETER &parameter);
+   std::string convertFileNameOrString(UTILS &utils, const std::string &keyword, const std::string &value);
+   void assignParameterValue(UTILS &utils, const PARAMETERFIELD &field, const PARSEDVALUE &value, PARAMETER &parameter);
+   void calculateSimulationPeriod(PARAMETER &parameter, UTILS &utils);
+   void adjustPlantTraitArraysToPftCount(PARAMETER &parameter);
 };
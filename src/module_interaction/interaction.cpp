@@ -3,7 +3,7 @@
 INTERACTION::INTERACTION() {};
 INTERACTION::~INTERACTION() {};
 
-void INTERACTION::calculateLightAttenuationAndAvailabilityForPlants(UTILS utils, PARAMETER parameter, COMMUNITY &community, double fullSunLight)
+void INTERACTION::calculateLightAttenuationAndAvailabilityForPlants(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, double fullSunLight)
 {
    /// 1. calculate height of largest plant in the community to discretisize the aboveground space vertically into height layers
    calculateNumberOfHeightLayersFromLargestPlant(utils, community);
@@ -18,14 +18,14 @@ void INTERACTION::calculateLightAttenuationAndAvailabilityForPlants(UTILS utils,
    calculateLightAvailabilityForPlants(utils, community, parameter, fullSunLight);
 }
 
-void INTERACTION::calculateNumberOfHeightLayersFromLargestPlant(UTILS utils, COMMUNITY &community)
+void INTERACTION::calculateNumberOfHeightLayersFromLargestPlant(const UTILS &utils, COMMUNITY &community)
 {
    /// maximumHeightOfAllPlants is initialized (with 0) in every day step in initAndResetProcessVariables()
    for (int cohortindex = 0; cohortindex < community.totalNumberOfCohortsInCommunity; cohortindex++)
    {
-      if (community.allPlants[cohortindex]->height > community.maximumHeightOfAllPlants)
+      if (community.allPlants.height[cohortindex] > community.maximumHeightOfAllPlants)
       {
-         community.maximumHeightOfAllPlants = community.allPlants[cohortindex]->height;
+         community.maximumHeightOfAllPlants = community.allPlants.height[cohortindex];
       }
    }
    /// predefined maximum height layer (see module_init/constants.h)
@@ -40,16 +40,19 @@ void INTERACTION::calculateNumberOfHeightLayersFromLargestPlant(UTILS utils, COM
    }
 }
 
-void INTERACTION::calculateCumulativeLeafAreaIndexAcrossHeightLayers(UTILS utils, COMMUNITY &community, PARAMETER parameter)
+void INTERACTION::calculateCumulativeLeafAreaIndexAcrossHeightLayers(const UTILS &utils, COMMUNITY &community, const PARAMETER &parameter)
 {
+   /// only the height layers reachable by the currently largest plant are used and have to be reset
+   resetHeightLayers(maximumHeightLayerIndexReachedByPlants);
+
    /// go through all living plants in the community and add their leaf area to the respective height layers
    for (int cohortindex = 0; cohortindex < community.totalNumberOfCohortsInCommunity; cohortindex++)
    {
-      int plantAmount = community.allPlants.at(cohortindex)->amount;
-      int pft = community.allPlants.at(cohortindex)->pft;
-      double plantHeight = community.allPlants.at(cohortindex)->height;
-      double plantArea = community.allPlants.at(cohortindex)->coveredArea;
-      double plantLeafAreaIndex = community.allPlants.at(cohortindex)->lai;
+      int plantAmount = community.allPlants.amount[cohortindex];
+      int pft = community.allPlants.pft[cohortindex];
+      double plantHeight = community.allPlants.height[cohortindex];
+      double plantArea = community.allPlants.coveredArea[cohortindex];
+      double plantLeafAreaIndex = community.allPlants.lai[cohortindex];
       double plantLightExtinctionCoefficient = parameter.lightExtinctionCoefficients.at(pft);
       double leafAreaOfPlantCohort = plantAmount * plantArea * plantLeafAreaIndex;
 
@@ -59,11 +62,8 @@ void INTERACTION::calculateCumulativeLeafAreaIndexAcrossHeightLayers(UTILS utils
          /// Note: floor is used because first height layer 0-1 cm has index 0
          int topHeightLayerIndexOfPlant = (int)std::floor((plantHeight / heightLayerWidth));
 
-         /// calculate weights for the plants' contribution to height layers based on plant height
-         calculateWeightsOfPlantHeightContributionToHeightLayers(topHeightLayerIndexOfPlant, plantHeight);
-
-         /// add plant cohort's leaf area to height layers according to the respective weights
-         addPlantLeafAreaToHeightLayers(topHeightLayerIndexOfPlant, leafAreaOfPlantCohort, plantLightExtinctionCoefficient);
+         /// add plant cohort's leaf area to height layers according to its height
+         addPlantLeafAreaToHeightLayers(topHeightLayerIndexOfPlant, plantHeight, leafAreaOfPlantCohort, plantLightExtinctionCoefficient);
       }
    }
 
@@ -71,31 +71,38 @@ void INTERACTION::calculateCumulativeLeafAreaIndexAcrossHeightLayers(UTILS utils
    accumulateLeafAreaFromTopToBottomHeightLayers(maximumHeightLayerIndexReachedByPlants);
 }
 
-void INTERACTION::calculateWeightsOfPlantHeightContributionToHeightLayers(int topHeightLayerIndexOfPlant, double plantHeight)
+void INTERACTION::initHeightLayers()
 {
-   double plantPartInHeightLayer;
-   weightsForPlantContributionToHeightLayer.clear();
+   /// the height layer buffers are allocated once for the highest possible height layer (see module_init/constants.h)
+   LAI.assign(maximumHeightLayer + 1, 0.0);
+   LAIwithLightExtinction.assign(maximumHeightLayer + 1, 0.0);
+   maximumHeightLayerIndexReachedByPlants = 0;
+}
 
+void INTERACTION::resetHeightLayers(int maximumHeightLayerReachedByPlants)
+{
+   std::fill(LAI.begin(), LAI.begin() + maximumHeightLayerReachedByPlants + 1, 0.0);
+   std::fill(LAIwithLightExtinction.begin(), LAIwithLightExtinction.begin() + maximumHeightLayerReachedByPlants + 1, 0.0);
+}
+
+void INTERACTION::addPlantLeafAreaToHeightLayers(int topHeightLayerIndexOfPlant, double plantHeight, double leafAreaOfPlantCohort, double plantLightExtinctionCoefficient)
+{
+   /// plant parts fully cover the height layers below the top layer
+   /// Note: the leaf area is added layer by layer in the order of the cohorts (O(height) per cohort).
+   /// A difference array would add a cohort in constant time, but changes the summation order and
+   /// thereby the last bits of the layer sums; the layer by layer sums keep the results bit-identical.
+   double plantPartInHeightLayer = heightLayerWidth / plantHeight;
    for (int layerindex = 0; layerindex < topHeightLayerIndexOfPlant; layerindex++)
    {
-      /// plant parts fully cover the respective height layer
-      plantPartInHeightLayer = heightLayerWidth / plantHeight;
-      weightsForPlantContributionToHeightLayer.push_back(plantPartInHeightLayer);
+      LAI.at(layerindex) += (leafAreaOfPlantCohort * plantPartInHeightLayer);
+      LAIwithLightExtinction.at(layerindex) += (leafAreaOfPlantCohort * plantLightExtinctionCoefficient * plantPartInHeightLayer);
    }
 
    /// plant parts at top layer (topHeightLayerIndexOfPlant) may not fully cover the entire height layer
    /// downward correction is required
-   plantPartInHeightLayer = ((plantHeight / heightLayerWidth) - std::floor(plantHeight / heightLayerWidth));
-   weightsForPlantContributionToHeightLayer.push_back((plantPartInHeightLayer / plantHeight));
-}
-
-void INTERACTION::addPlantLeafAreaToHeightLayers(int topHeightLayerIndexOfPlant, double leafAreaOfPlantCohort, double plantLightExtinctionCoefficient)
-{
-   for (int layerindex = 0; layerindex <= topHeightLayerIndexOfPlant; layerindex++)
-   {
-      LAI.at(layerindex) += (leafAreaOfPlantCohort * weightsForPlantContributionToHeightLayer.at(layerindex));
-      LAIwithLightExtinction.at(layerindex) += (leafAreaOfPlantCohort * plantLightExtinctionCoefficient * weightsForPlantContributionToHeightLayer.at(layerindex));
-   }
+   double plantPartInTopHeightLayer = ((plantHeight / heightLayerWidth) - std::floor(plantHeight / heightLayerWidth)) / plantHeight;
+   LAI.at(topHeightLayerIndexOfPlant) += (leafAreaOfPlantCohort * plantPartInTopHeightLayer);
+   LAIwithLightExtinction.at(topHeightLayerIndexOfPlant) += (leafAreaOfPlantCohort * plantLightExtinctionCoefficient * plantPartInTopHeightLayer);
 }
 
 void INTERACTION::accumulateLeafAreaFromTopToBottomHeightLayers(int maximumHeightLayerReachedByPlants)
@@ -107,15 +114,15 @@ void INTERACTION::accumulateLeafAreaFromTopToBottomHeightLayers(int maximumHeigh
    }
 }
 
-void INTERACTION::calculateLightAvailabilityForPlants(UTILS utils, COMMUNITY &community, PARAMETER parameter, double fullSunLight)
+void INTERACTION::calculateLightAvailabilityForPlants(const UTILS &utils, COMMUNITY &community, const PARAMETER &parameter, double fullSunLight)
 {
    int lowestOvertoppingHeightLayerIndexOfPlant;
 
    for (int cohortindex = 0; cohortindex < community.totalNumberOfCohortsInCommunity; cohortindex++)
    {
-      int plantAmount = community.allPlants.at(cohortindex)->amount;
-      int pft = community.allPlants.at(cohortindex)->pft;
-      double plantHeight = community.allPlants.at(cohortindex)->height;
+      int plantAmount = community.allPlants.amount[cohortindex];
+      int pft = community.allPlants.pft[cohortindex];
+      double plantHeight = community.allPlants.height[cohortindex];
 
       if (plantAmount > 0)
       {
@@ -130,25 +137,25 @@ void INTERACTION::calculateLightAvailabilityForPlants(UTILS utils, COMMUNITY &co
 
 void INTERACTION::getOvertoppingCumulativeLeafAreaIndexOfPlant(COMMUNITY &community, int cohortindex, int layerindex)
 {
-   community.allPlants.at(cohortindex)->cumulativeOvertoppingCommunityLAI = LAIwithLightExtinction.at(layerindex);
+   community.allPlants.cumulativeOvertoppingCommunityLAI[cohortindex] = LAIwithLightExtinction.at(layerindex);
 }
 
-void INTERACTION::calculateAvailableLightReachingAPlant(PARAMETER parameter, COMMUNITY &community, int cohortindex, double fullSunLight)
+void INTERACTION::calculateAvailableLightReachingAPlant(const PARAMETER &parameter, COMMUNITY &community, int cohortindex, double fullSunLight)
 {
-   double shadingCommunityLeafAreaIndex = community.allPlants.at(cohortindex)->cumulativeOvertoppingCommunityLAI;
-   community.allPlants.at(cohortindex)->availableRadiation = getRadiationByLightExtinctionLaw(shadingCommunityLeafAreaIndex, fullSunLight);
+   double shadingCommunityLeafAreaIndex = community.allPlants.cumulativeOvertoppingCommunityLAI[cohortindex];
+   community.allPlants.availableRadiation[cohortindex] = getRadiationByLightExtinctionLaw(shadingCommunityLeafAreaIndex, fullSunLight);
 }
 
-void INTERACTION::calculateShadingIndicatorOfPlantForOutput(UTILS utils, PARAMETER parameter, COMMUNITY &community, int cohortindex, double fullSunLight)
+void INTERACTION::calculateShadingIndicatorOfPlantForOutput(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, int cohortindex, double fullSunLight)
 {
-   double sunLightReachingPlant = community.allPlants.at(cohortindex)->availableRadiation;
+   double sunLightReachingPlant = community.allPlants.availableRadiation[cohortindex];
    if (fullSunLight > 0)
    {
-      community.allPlants.at(cohortindex)->shadingIndicator = sunLightReachingPlant / fullSunLight;
+      community.allPlants.shadingIndicator[cohortindex] = sunLightReachingPlant / fullSunLight;
    }
    else
    {
-      community.allPlants.at(cohortindex)->shadingIndicator = -1.0;
+      community.allPlants.shadingIndicator[cohortindex] = -1.0;
       utils.handleWarning("There is no sunlight today. The shading factor is set to default value of -1.");
    }
 }
@@ -161,10 +168,16 @@ double INTERACTION::getRadiationByLightExtinctionLaw(double cumulativeLAIAboveAn
    return radiationByExtinction;
 }
 
-void INTERACTION::getEnvironmentalConditionsOfDay(WEATHER weather, SOIL soil, MANAGEMENT management, int day)
+void INTERACTION::getEnvironmentalConditionsOfDay(const WEATHER &weather, const SOIL &soil, const MANAGEMENT &management, int day)
 {
-   fullSunLight = weather.photosyntheticPhotonFluxDensity.at(day - 1); // parameter.day starts at 1, but vectors start with index 0
+   fullSunLight = weather.dailyDrivers.photosyntheticPhotonFluxDensity.at(day - 1); // parameter.day starts at 1, but vectors start with index 0
    dayLength = weather.dayLength.at(day - 1);
    dayTimeAirTemperature = weather.dayTimeAirTemperature.at(day - 1);
    fullDayAirTemperature = weather.fullDayAirTemperature.at(day - 1);
+
+   /// day-dependent drivers of the plant processes are precomputed in the daily driver table
+   effectOfDayTimeAirTemperatureOnGpp = weather.dailyDrivers.effectOfDayTimeAirTemperatureOnGpp[day - 1];
+   effectOfFullDayAirTemperatureOnRespiration = weather.dailyDrivers.effectOfFullDayAirTemperatureOnRespiration[day - 1];
+   radiationCorrectionForDayLength = weather.dailyDrivers.radiationCorrectionForDayLength[day - 1];
+   secondsOfDaylight = weather.dailyDrivers.secondsOfDaylight[day - 1];
 }
\ No newline at end of file
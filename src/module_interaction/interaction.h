@@ -6,6 +6,7 @@
 #include "../module_management/management.h"
 #include "../utils/utils.h"
 #include <vector>
+#include <algorithm>
 #include <iostream>
 
 class INTERACTION
@@ -18,24 +19,28 @@ public:
    double dayLength;
    double fullDayAirTemperature;
    double dayTimeAirTemperature;
+   double effectOfDayTimeAirTemperatureOnGpp;         /// see DAILYDRIVERTABLE
+   double effectOfFullDayAirTemperatureOnRespiration; /// see DAILYDRIVERTABLE
+   double radiationCorrectionForDayLength;            /// see DAILYDRIVERTABLE
+   double secondsOfDaylight;                          /// see DAILYDRIVERTABLE
 
    int maximumHeightLayerIndexReachedByPlants;
-   std::vector<double> LAI;
-   std::vector<double> LAIwithLightExtinction;
-   std::vector<double> weightsForPlantContributionToHeightLayer;
+   std::vector<double> LAI;                    /// Leaf area per height layer, cumulated from top to bottom
+   std::vector<double> LAIwithLightExtinction; /// Leaf area weighted by light extinction per height layer, cumulated from top to bottom
 
-   void getEnvironmentalConditionsOfDay(WEATHER weather, SOIL soil, MANAGEMENT management, int day);
-   void calculateLightAttenuationAndAvailabilityForPlants(UTILS utils, PARAMETER parameter, COMMUNITY &community, double fullSunLight);
+   void getEnvironmentalConditionsOfDay(const WEATHER &weather, const SOIL &soil, const MANAGEMENT &management, int day);
+   void calculateLightAttenuationAndAvailabilityForPlants(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, double fullSunLight);
 
-   void calculateNumberOfHeightLayersFromLargestPlant(UTILS utils, COMMUNITY &community);
-   void calculateCumulativeLeafAreaIndexAcrossHeightLayers(UTILS utils, COMMUNITY &community, PARAMETER parameter);
-   void calculateWeightsOfPlantHeightContributionToHeightLayers(int topHeightLayerIndexOfPlant, double plantHeight);
-   void addPlantLeafAreaToHeightLayers(int topHeightLayerIndexOfPlant, double leafAreaOfPlantCohort, double plantLightExtinctionCoefficient);
+   void calculateNumberOfHeightLayersFromLargestPlant(const UTILS &utils, COMMUNITY &community);
+   void calculateCumulativeLeafAreaIndexAcrossHeightLayers(const UTILS &utils, COMMUNITY &community, const PARAMETER &parameter);
+   void initHeightLayers();
+   void resetHeightLayers(int maximumHeightLayerReachedByPlants);
+   void addPlantLeafAreaToHeightLayers(int topHeightLayerIndexOfPlant, double plantHeight, double leafAreaOfPlantCohort, double plantLightExtinctionCoefficient);
    void accumulateLeafAreaFromTopToBottomHeightLayers(int maximumHeightLayerReachedByPlants);
 
-   void calculateLightAvailabilityForPlants(UTILS utils, COMMUNITY &community, PARAMETER parameter, double fullSunLight);
+   void calculateLightAvailabilityForPlants(const UTILS &utils, COMMUNITY &community, const PARAMETER &parameter, double fullSunLight);
    void getOvertoppingCumulativeLeafAreaIndexOfPlant(COMMUNITY &community, int cohortindex, int top);
-   void calculateAvailableLightReachingAPlant(PARAMETER parameter, COMMUNITY &community, int cohortindex, double fullSunLight);
-   void calculateShadingIndicatorOfPlantForOutput(UTILS utils, PARAMETER parameter, COMMUNITY &community, int cohortindex, double fullSunLight);
+   void calculateAvailableLightReachingAPlant(const PARAMETER &parameter, COMMUNITY &community, int cohortindex, double fullSunLight);
+   void calculateShadingIndicatorOfPlantForOutput(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, int cohortindex, double fullSunLight);
    double getRadiationByLightExtinctionLaw(double cumulativeLAIAboveAndAtHeightLayer, double fullSunLight);
 };
\ No newline at end of file
@@ -3,14 +3,14 @@
 MANAGEMENT::MANAGEMENT() {};
 MANAGEMENT::~MANAGEMENT() {};
 
-void MANAGEMENT::applyManagementRegime(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter)
+void MANAGEMENT::applyManagementRegime(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter) const
 {
    /* mowing events */
    initializeYieldVariables(community, parameter);
    checkIfTodayAndDoMowing(utils, community, allometry, parameter);
 }
 
-void MANAGEMENT::initializeYieldVariables(COMMUNITY &community, PARAMETER parameter)
+void MANAGEMENT::initializeYieldVariables(COMMUNITY &community, const PARAMETER &parameter) const
 {
    // initialize variables to track yield
    for (int pft = 0; pft < parameter.pftCount; pft++)
@@ -25,64 +25,62 @@ void MANAGEMENT::initializeYieldVariables(COMMUNITY &community, PARAMETER parame
    }
 }
 
-void MANAGEMENT::checkIfTodayAndDoMowing(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter)
+void MANAGEMENT::checkIfTodayAndDoMowing(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter) const
 {
-   // scan through all mowing dates from the management file to check if today is a mowing event
-   int index = 0;
-   for (auto day : mowingDate)
+   // only the events of today are visited (see MANAGEMENTTIMELINE)
+   for (const MANAGEMENTEVENT &event : timeline.getEventsOfDay(parameter.day))
    {
-      if (parameter.day == day)
+      if (event.action == MANAGEMENTACTION::mowing)
       {
-         double heightToCutPlantsDownTo = 100.0 * mowingHeight.at(index); // convert m in cm
+         double heightToCutPlantsDownTo = 100.0 * event.value; // convert m in cm
          for (int cohortIndex = 0; cohortIndex < community.totalNumberOfCohortsInCommunity; cohortIndex++)
          {
-            int pft = community.allPlants[cohortIndex]->pft;
+            int pft = community.allPlants.pft[cohortIndex];
             cutPlantsAndTrackYieldAndUpdatePlantAttributes(utils, community, allometry, parameter, cohortIndex, pft, heightToCutPlantsDownTo);
          }
       }
-      index++;
    }
 }
 
-void MANAGEMENT::cutPlantsAndTrackYieldAndUpdatePlantAttributes(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter, int cohortIndex, int pft, double heightToCutPlantsDownTo)
+void MANAGEMENT::cutPlantsAndTrackYieldAndUpdatePlantAttributes(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter, int cohortIndex, int pft, double heightToCutPlantsDownTo) const
 {
-   if (community.allPlants[cohortIndex]->amount > 0)
+   if (community.allPlants.amount[cohortIndex] > 0)
    {
-      if (community.allPlants[cohortIndex]->height > heightToCutPlantsDownTo)
+      if (community.allPlants.height[cohortIndex] > heightToCutPlantsDownTo)
       {
          // cut the plants
-         double heightProportionalityFactor = (community.allPlants[cohortIndex]->height - heightToCutPlantsDownTo) / community.allPlants[cohortIndex]->height;
-         double cutGreenLeaves = heightProportionalityFactor * community.allPlants[cohortIndex]->shootBiomassGreenLeaves;
-         double cutBrownLeaves = heightProportionalityFactor * community.allPlants[cohortIndex]->shootBiomassBrownLeaves;
+         double heightProportionalityFactor = (community.allPlants.height[cohortIndex] - heightToCutPlantsDownTo) / community.allPlants.height[cohortIndex];
+         double cutGreenLeaves = heightProportionalityFactor * community.allPlants.shootBiomassGreenLeaves[cohortIndex];
+         double cutBrownLeaves = heightProportionalityFactor * community.allPlants.shootBiomassBrownLeaves[cohortIndex];
 
          // track the yield
-         community.greenBiomassYieldPerPFT[pft] += (cutGreenLeaves * community.allPlants[cohortIndex]->amount);
-         community.brownBiomassYieldPerPFT[pft] += (cutBrownLeaves * community.allPlants[cohortIndex]->amount);
-         community.biomassYieldPerPFT[pft] += ((cutBrownLeaves + cutGreenLeaves) * community.allPlants[cohortIndex]->amount);
+         community.greenBiomassYieldPerPFT[pft] += (cutGreenLeaves * community.allPlants.amount[cohortIndex]);
+         community.brownBiomassYieldPerPFT[pft] += (cutBrownLeaves * community.allPlants.amount[cohortIndex]);
+         community.biomassYieldPerPFT[pft] += ((cutBrownLeaves + cutGreenLeaves) * community.allPlants.amount[cohortIndex]);
 
-         community.greenBiomassYield += (cutGreenLeaves * community.allPlants[cohortIndex]->amount);
-         community.brownBiomassYield += (cutBrownLeaves * community.allPlants[cohortIndex]->amount);
-         community.biomassYield += ((cutBrownLeaves + cutGreenLeaves) * community.allPlants[cohortIndex]->amount);
+         community.greenBiomassYield += (cutGreenLeaves * community.allPlants.amount[cohortIndex]);
+         community.brownBiomassYield += (cutBrownLeaves * community.allPlants.amount[cohortIndex]);
+         community.biomassYield += ((cutBrownLeaves + cutGreenLeaves) * community.allPlants.amount[cohortIndex]);
 
          // update attributes of plants
-         community.allPlants[cohortIndex]->shootBiomass -= (cutGreenLeaves + cutBrownLeaves);
-         community.allPlants[cohortIndex]->shootBiomassGreenLeaves -= cutGreenLeaves;
-         community.allPlants[cohortIndex]->shootBiomassBrownLeaves -= cutBrownLeaves;
+         community.allPlants.shootBiomass[cohortIndex] -= (cutGreenLeaves + cutBrownLeaves);
+         community.allPlants.shootBiomassGreenLeaves[cohortIndex] -= cutGreenLeaves;
+         community.allPlants.shootBiomassBrownLeaves[cohortIndex] -= cutBrownLeaves;
 
-         community.allPlants[cohortIndex]->shootCarbonGreenLeaves = community.allPlants[cohortIndex]->shootBiomassGreenLeaves * carbonContentOdm;
-         community.allPlants[cohortIndex]->shootCarbonBrownLeaves = community.allPlants[cohortIndex]->shootBiomassBrownLeaves * carbonContentOdm;
-         community.allPlants[cohortIndex]->shootCarbon = community.allPlants[cohortIndex]->shootCarbonGreenLeaves + community.allPlants[cohortIndex]->shootCarbonBrownLeaves;
+         community.allPlants.shootCarbonGreenLeaves[cohortIndex] = community.allPlants.shootBiomassGreenLeaves[cohortIndex] * carbonContentOdm;
+         community.allPlants.shootCarbonBrownLeaves[cohortIndex] = community.allPlants.shootBiomassBrownLeaves[cohortIndex] * carbonContentOdm;
+         community.allPlants.shootCarbon[cohortIndex] = community.allPlants.shootCarbonGreenLeaves[cohortIndex] + community.allPlants.shootCarbonBrownLeaves[cohortIndex];
 
-         community.allPlants[cohortIndex]->shootNitrogenGreenLeaves = community.allPlants[cohortIndex]->shootCarbonGreenLeaves / parameter.plantCNRatioGreenLeaves[pft];
-         community.allPlants[cohortIndex]->shootNitrogenBrownLeaves = community.allPlants[cohortIndex]->shootCarbonBrownLeaves / parameter.plantCNRatioBrownLeaves[pft];
-         community.allPlants[cohortIndex]->shootNitrogen = community.allPlants[cohortIndex]->shootNitrogenGreenLeaves + community.allPlants[cohortIndex]->shootNitrogenBrownLeaves;
+         community.allPlants.shootNitrogenGreenLeaves[cohortIndex] = community.allPlants.shootCarbonGreenLeaves[cohortIndex] / parameter.plantCNRatioGreenLeaves[pft];
+         community.allPlants.shootNitrogenBrownLeaves[cohortIndex] = community.allPlants.shootCarbonBrownLeaves[cohortIndex] / parameter.plantCNRatioBrownLeaves[pft];
+         community.allPlants.shootNitrogen[cohortIndex] = community.allPlants.shootNitrogenGreenLeaves[cohortIndex] + community.allPlants.shootNitrogenBrownLeaves[cohortIndex];
 
-         community.allPlants[cohortIndex]->height = heightToCutPlantsDownTo;
-         community.allPlants[cohortIndex]->laiGreen = allometry.laiFromShootBiomassAreaSla(utils, community.allPlants[cohortIndex]->shootBiomassGreenLeaves,
-                                                                                           community.allPlants[cohortIndex]->coveredArea, parameter.plantSpecificLeafArea[pft]);
-         community.allPlants[cohortIndex]->laiBrown = allometry.laiFromShootBiomassAreaSla(utils, community.allPlants[cohortIndex]->shootBiomassBrownLeaves,
-                                                                                           community.allPlants[cohortIndex]->coveredArea, parameter.plantSpecificLeafArea[pft]);
-         community.allPlants[cohortIndex]->lai = community.allPlants[cohortIndex]->laiGreen + community.allPlants[cohortIndex]->laiBrown;
+         community.allPlants.height[cohortIndex] = heightToCutPlantsDownTo;
+         community.allPlants.laiGreen[cohortIndex] = allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.shootBiomassGreenLeaves[cohortIndex],
+                                                                                           community.allPlants.coveredArea[cohortIndex], parameter.plantSpecificLeafArea[pft]);
+         community.allPlants.laiBrown[cohortIndex] = allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.shootBiomassBrownLeaves[cohortIndex],
+                                                                                           community.allPlants.coveredArea[cohortIndex], parameter.plantSpecificLeafArea[pft]);
+         community.allPlants.lai[cohortIndex] = community.allPlants.laiGreen[cohortIndex] + community.allPlants.laiBrown[cohortIndex];
       }
    }
 }
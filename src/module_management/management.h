@@ -3,6 +3,7 @@
 #include "../module_parameter/parameter.h"
 #include "../module_plant/allometry.h"
 #include "../utils/utils.h"
+#include "managementtimeline.h"
 #include <vector>
 #include <iostream>
 
@@ -12,20 +13,10 @@ public:
    MANAGEMENT();
    ~MANAGEMENT();
 
-   std::vector<int> mowingDate;
-   std::vector<double> mowingHeight;
+   MANAGEMENTTIMELINE timeline; /// Mowing, fertilization, irrigation and sowing events indexed by day
 
-   std::vector<int> fertilizationDate;
-   std::vector<double> fertilizerAmount;
-
-   std::vector<int> irrigationDate;
-   std::vector<double> irrigationAmount;
-
-   std::vector<int> sowingDate;
-   std::vector<std::vector<int>> amountOfSownSeeds; // dynamic 2D vector of pft and sowing events with elements being the event-specific seed numbers sown
-
-   void applyManagementRegime(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter);
-   void initializeYieldVariables(COMMUNITY &community, PARAMETER parameter);
-   void checkIfTodayAndDoMowing(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter);
-   void cutPlantsAndTrackYieldAndUpdatePlantAttributes(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter, int cohortIndex, int pft, double heightToCutPlantsDownTo);
+   void applyManagementRegime(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter) const;
+   void initializeYieldVariables(COMMUNITY &community, const PARAMETER &parameter) const;
+   void checkIfTodayAndDoMowing(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter) const;
+   void cutPlantsAndTrackYieldAndUpdatePlantAttributes(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter, int cohortIndex, int pft, double heightToCutPlantsDownTo) const;
 };
\ No newline at end of file
@@ -0,0 +1,68 @@
+#include "managementtimeline.h"
+#include <algorithm>
+
+MANAGEMENTTIMELINE::MANAGEMENTTIMELINE() {};
+MANAGEMENTTIMELINE::~MANAGEMENTTIMELINE() {};
+
+/**
+ * @brief Removes all events (before reading a management file).
+ */
+void MANAGEMENTTIMELINE::clear()
+{
+   events.clear();
+   firstEventOfDay.clear();
+}
+
+/**
+ * @brief Adds an event read from the management file (`compileTimeline()` has to be called after the last event).
+ *
+ * @param day Day count of the event.
+ * @param action Type of the event.
+ * @param value Mowing height (in m), fertilizer amount or irrigation amount.
+ * @param amountOfSownSeeds Seeds sown per PFT (sowing events).
+ */
+void MANAGEMENTTIMELINE::addEvent(int day, MANAGEMENTACTION action, double value, const std::vector<int> &amountOfSownSeeds)
+{
+   events.push_back({day, action, value, amountOfSownSeeds});
+}
+
+/**
+ * @brief Sorts the events by day and indexes the first event of each day.
+ *
+ * Events of the same day keep the order in which they were added. Events outside the
+ * simulation period are never returned by `getEventsOfDay()`.
+ *
+ * @param simulationTimeInDays Number of simulated days.
+ */
+void MANAGEMENTTIMELINE::compileTimeline(int simulationTimeInDays)
+{
+   std::stable_sort(events.begin(), events.end(), [](const MANAGEMENTEVENT &first, const MANAGEMENTEVENT &second)
+                    { return first.day < second.day; });
+
+   firstEventOfDay.assign(simulationTimeInDays + 2, 0);
+   int event = 0;
+   for (int day = 0; day < static_cast<int>(firstEventOfDay.size()); day++)
+   {
+      while (event < static_cast<int>(events.size()) && events[event].day < day)
+      {
+         event++;
+      }
+      firstEventOfDay[day] = event;
+   }
+}
+
+/**
+ * @brief Returns the events of a day.
+ *
+ * @param day Day count (empty for days outside the simulation period).
+ */
+MANAGEMENTDAY MANAGEMENTTIMELINE::getEventsOfDay(int day) const
+{
+   if (day < 0 || day + 1 >= static_cast<int>(firstEventOfDay.size()))
+   {
+      return {nullptr, nullptr};
+   }
+   const MANAGEMENTEVENT *first = events.data();
+   return {first + firstEventOfDay[day], first + firstEventOfDay[day + 1]};
+}
+
@@ -0,0 +1,62 @@
+#pragma once
+#include <vector>
+
+/**
+ * @brief Type of a management event.
+ */
+enum class MANAGEMENTACTION
+{
+   mowing,        /// Plants are cut down to the mowing height
+   fertilization, /// Fertilizer is applied
+   irrigation,    /// Water is applied
+   sowing,        /// Seeds are added to the seed pool of each PFT
+};
+
+/**
+ * @brief One management event of the management file.
+ */
+struct MANAGEMENTEVENT
+{
+   int day;                             /// Day count of the event
+   MANAGEMENTACTION action;             /// Type of the event
+   double value;                        /// Mowing height (in m), fertilizer amount or irrigation amount of the event
+   std::vector<int> amountOfSownSeeds; /// Seeds sown per PFT (sowing events only)
+};
+
+/**
+ * @brief Events of one day of the management timeline (usable in range-based for loops).
+ */
+struct MANAGEMENTDAY
+{
+   const MANAGEMENTEVENT *first; /// First event of the day
+   const MANAGEMENTEVENT *last;  /// End of the events of the day
+
+   const MANAGEMENTEVENT *begin() const { return first; }
+   const MANAGEMENTEVENT *end() const { return last; }
+   bool empty() const { return first == last; }
+};
+
+/**
+ * @brief Management events compiled into a day-indexed timeline once after reading the management file.
+ *
+ * The `MANAGEMENTTIMELINE` class holds all management events sorted by day (events of the same
+ * day keep the order of the management file) and the index of the first event of each simulated
+ * day. The events of a day are thus found in constant time, independent of the length of the
+ * management history, and mowing and sowing (`MANAGEMENT`, `RECRUITMENT`) only visit the events
+ * due on the current day. The timeline is read-only during the simulation, so that it can be
+ * shared by concurrent simulations (ensemble replicates, fork branches) and runs resumed at any day.
+ */
+class MANAGEMENTTIMELINE
+{
+public:
+   MANAGEMENTTIMELINE();
+   ~MANAGEMENTTIMELINE();
+
+   std::vector<MANAGEMENTEVENT> events;  /// Management events sorted by day
+   std::vector<int> firstEventOfDay;     /// Index of the first event of each day (index = day count, one entry more than days)
+
+   void clear();
+   void addEvent(int day, MANAGEMENTACTION action, double value, const std::vector<int> &amountOfSownSeeds = std::vector<int>());
+   void compileTimeline(int simulationTimeInDays);
+   MANAGEMENTDAY getEventsOfDay(int day) const;
+};
@@ -15,42 +15,40 @@ MORTALITY::~MORTALITY() {};
  * @param utils Utility functions used for calculations and operations.
  *
  * @note The function assumes that the `community` contains valid plants in the `allPlants`
- *       vector. It performs checks to ensure that plant cohorts in the vector still have
+ *       table. It performs checks to ensure that plant cohorts in the vector still have
  *       a minimum of one plant after applying the mortality processes.
  */
-void MORTALITY::doPlantMortality(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry, GROWTH growth, INTERACTION interaction, SOIL soil)
+void MORTALITY::doPlantMortality(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry, const INTERACTION &interaction, SOIL &soil)
 {
    for (int cohortIndex = 0; cohortIndex < community.totalNumberOfCohortsInCommunity; cohortIndex++)
    {
-      int pft = community.allPlants[cohortIndex]->pft;
+      int pft = community.allPlants.pft[cohortIndex];
 
       // 1. Leaf and root senescence and litter fall
-      doSenescenceAndLitterFall(utils, parameter, community, allometry, growth, interaction, soil, cohortIndex, pft);
+      doSenescenceAndLitterFall(utils, parameter, community, allometry, interaction, soil, cohortIndex, pft);
 
       // 2. Crowding mortality
       if (parameter.crowdingMortalityActivated)
       {
-         community.randomNumberIndex++;
          doPlantCrowding(parameter, utils, soil, community, cohortIndex, pft);
       }
 
       // 3. Basic mortality
-      community.randomNumberIndex++;
       doBasicMortality(parameter, utils, soil, community, cohortIndex, pft);
    }
 
    // 4. Delete cohorts if no more plants are alive
    community.checkPlantsAreAliveInCommunity(utils);
 
-   // 5. Update number of cohorts in allPlants-vector
+   // 5. Update number of cohorts in allPlants-table
    community.totalNumberOfCohortsInCommunity = community.allPlants.size();
 }
 
 /* Leaf and root senescence and litter fall */
-void MORTALITY::doSenescenceAndLitterFall(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry, GROWTH growth, INTERACTION interaction, SOIL soil, int cohortIndex, int pft)
+void MORTALITY::doSenescenceAndLitterFall(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry, const INTERACTION &interaction, SOIL &soil, int cohortIndex, int pft)
 {
    /// Leaf senescence
-   double browningLeafBiomass = doLeafSenescence(community, parameter, growth, interaction, cohortIndex, pft);
+   double browningLeafBiomass = doLeafSenescence(community, parameter, interaction, cohortIndex, pft);
    doNitrogenRelocation(utils, parameter, community, browningLeafBiomass, cohortIndex, pft);
 
    // Litter fall of senescent leaves & transfer to surface litter pool
@@ -60,98 +58,98 @@ void MORTALITY::doSenescenceAndLitterFall(UTILS utils, PARAMETER parameter, COMM
    doRootSenescenceAndLitterFall(community, parameter, soil, cohortIndex, pft);
 }
 
-double MORTALITY::doLeafSenescence(COMMUNITY &community, PARAMETER parameter, GROWTH growth, INTERACTION interaction, int cohortIndex, int pft)
+double MORTALITY::doLeafSenescence(COMMUNITY &community, const PARAMETER &parameter, const INTERACTION &interaction, int cohortIndex, int pft)
 {
-   double effectOfDayTimeTemperature = growth.calculateEffectOfAirTemperatureOnGPP(interaction.dayTimeAirTemperature);
-   double browningLeafBiomass = effectOfDayTimeTemperature * (community.allPlants.at(cohortIndex)->shootBiomassGreenLeaves / parameter.leafLifeSpan[pft]); // to be added: effect of community.allPlants.at(cohortIndex)->limitingFactorGppWater
+   double effectOfDayTimeTemperature = interaction.effectOfDayTimeAirTemperatureOnGpp;
+   double browningLeafBiomass = effectOfDayTimeTemperature * (community.allPlants.shootBiomassGreenLeaves[cohortIndex] / parameter.leafLifeSpan[pft]); // to be added: effect of community.allPlants.limitingFactorGppWater[cohortIndex]
 
-   community.allPlants.at(cohortIndex)->shootBiomassBrownLeaves += browningLeafBiomass;
-   community.allPlants.at(cohortIndex)->shootBiomassGreenLeaves -= browningLeafBiomass;
-   // community.allPlants.at(cohortIndex)->shootBiomass remains unchanged here
+   community.allPlants.shootBiomassBrownLeaves[cohortIndex] += browningLeafBiomass;
+   community.allPlants.shootBiomassGreenLeaves[cohortIndex] -= browningLeafBiomass;
+   // community.allPlants.shootBiomass[cohortIndex] remains unchanged here
 
-   community.allPlants.at(cohortIndex)->shootCarbonBrownLeaves = community.allPlants.at(cohortIndex)->shootBiomassBrownLeaves * carbonContentOdm;
-   community.allPlants.at(cohortIndex)->shootCarbonGreenLeaves = community.allPlants.at(cohortIndex)->shootBiomassGreenLeaves * carbonContentOdm;
+   community.allPlants.shootCarbonBrownLeaves[cohortIndex] = community.allPlants.shootBiomassBrownLeaves[cohortIndex] * carbonContentOdm;
+   community.allPlants.shootCarbonGreenLeaves[cohortIndex] = community.allPlants.shootBiomassGreenLeaves[cohortIndex] * carbonContentOdm;
 
-   community.allPlants.at(cohortIndex)->shootNitrogenBrownLeaves = community.allPlants.at(cohortIndex)->shootCarbonBrownLeaves / parameter.plantCNRatioBrownLeaves[pft];
-   community.allPlants.at(cohortIndex)->shootNitrogenGreenLeaves = community.allPlants.at(cohortIndex)->shootCarbonGreenLeaves / parameter.plantCNRatioGreenLeaves[pft];
+   community.allPlants.shootNitrogenBrownLeaves[cohortIndex] = community.allPlants.shootCarbonBrownLeaves[cohortIndex] / parameter.plantCNRatioBrownLeaves[pft];
+   community.allPlants.shootNitrogenGreenLeaves[cohortIndex] = community.allPlants.shootCarbonGreenLeaves[cohortIndex] / parameter.plantCNRatioGreenLeaves[pft];
 
    return (browningLeafBiomass);
 }
 
-void MORTALITY::doLeafLitterFall(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter, SOIL soil, int cohortIndex, int pft)
+void MORTALITY::doLeafLitterFall(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter, SOIL &soil, int cohortIndex, int pft)
 {
-   if (community.allPlants.at(cohortIndex)->shootBiomassBrownLeaves > 0.0)
+   if (community.allPlants.shootBiomassBrownLeaves[cohortIndex] > 0.0)
    {
       double fractionLeavesFalling = parameter.brownBiomassFractionFalling;
       (parameter.day % 365 == 0) ? (fractionLeavesFalling = 1) : (fractionLeavesFalling = fractionLeavesFalling);
 
       if (fractionLeavesFalling > 0)
       {
-         double fallingLeafBiomass = fractionLeavesFalling * community.allPlants.at(cohortIndex)->shootBiomassBrownLeaves;
+         double fallingLeafBiomass = fractionLeavesFalling * community.allPlants.shootBiomassBrownLeaves[cohortIndex];
 
-         community.allPlants.at(cohortIndex)->shootBiomassBrownLeaves -= fallingLeafBiomass;
-         community.allPlants.at(cohortIndex)->shootBiomass = community.allPlants.at(cohortIndex)->shootBiomassGreenLeaves + community.allPlants.at(cohortIndex)->shootBiomassBrownLeaves;
+         community.allPlants.shootBiomassBrownLeaves[cohortIndex] -= fallingLeafBiomass;
+         community.allPlants.shootBiomass[cohortIndex] = community.allPlants.shootBiomassGreenLeaves[cohortIndex] + community.allPlants.shootBiomassBrownLeaves[cohortIndex];
 
-         community.allPlants[cohortIndex]->shootCarbonBrownLeaves = community.allPlants[cohortIndex]->shootBiomassBrownLeaves * carbonContentOdm;
-         community.allPlants[cohortIndex]->shootCarbon = community.allPlants[cohortIndex]->shootCarbonGreenLeaves + community.allPlants[cohortIndex]->shootCarbonBrownLeaves;
+         community.allPlants.shootCarbonBrownLeaves[cohortIndex] = community.allPlants.shootBiomassBrownLeaves[cohortIndex] * carbonContentOdm;
+         community.allPlants.shootCarbon[cohortIndex] = community.allPlants.shootCarbonGreenLeaves[cohortIndex] + community.allPlants.shootCarbonBrownLeaves[cohortIndex];
 
-         community.allPlants[cohortIndex]->shootNitrogenBrownLeaves = community.allPlants[cohortIndex]->shootCarbonBrownLeaves / parameter.plantCNRatioBrownLeaves[pft];
-         community.allPlants[cohortIndex]->shootNitrogen = community.allPlants[cohortIndex]->shootNitrogenGreenLeaves + community.allPlants[cohortIndex]->shootNitrogenBrownLeaves;
+         community.allPlants.shootNitrogenBrownLeaves[cohortIndex] = community.allPlants.shootCarbonBrownLeaves[cohortIndex] / parameter.plantCNRatioBrownLeaves[pft];
+         community.allPlants.shootNitrogen[cohortIndex] = community.allPlants.shootNitrogenGreenLeaves[cohortIndex] + community.allPlants.shootNitrogenBrownLeaves[cohortIndex];
 
-         // community.allPlants.at(cohortIndex)->shootBiomassGreenLeaves remains unchanged here
+         // community.allPlants.shootBiomassGreenLeaves[cohortIndex] remains unchanged here
 
-         soil.transferDyingPlantPartsToLitterPools(parameter, community.allPlants.at(cohortIndex)->amount, fallingLeafBiomass, 1, pft);
+         soil.transferDyingPlantPartsToLitterPools(parameter, community.allPlants.amount[cohortIndex], fallingLeafBiomass, 1, pft);
          updatePlantSize(utils, community, allometry, parameter, fractionLeavesFalling, cohortIndex, pft);
       }
    }
 }
 
-void MORTALITY::updatePlantSize(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter, int fractionLeavesFalling, int cohortIndex, int pft)
+void MORTALITY::updatePlantSize(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter, int fractionLeavesFalling, int cohortIndex, int pft)
 {
    // calculation of width & coveredArea only if fractionFalling < 1
    // width shall not be updated when all brown biomass falls off at once, but only height
    if (fractionLeavesFalling == 1)
    {
-      community.allPlants.at(cohortIndex)->height = allometry.heightFromShootBiomassWidthShootCorrection(utils, community.allPlants.at(cohortIndex)->shootBiomass, community.allPlants.at(cohortIndex)->width,
+      community.allPlants.height[cohortIndex] = allometry.heightFromShootBiomassWidthShootCorrection(utils, community.allPlants.shootBiomass[cohortIndex], community.allPlants.width[cohortIndex],
                                                                                                          parameter.plantShootCorrectionFactor[pft]);
    }
    else
    {
-      community.allPlants.at(cohortIndex)->width = allometry.widthFromShootBiomassByRatioAndShootCorrection(utils, community.allPlants.at(cohortIndex)->shootBiomass, parameter.plantHeightToWidthRatio[pft],
+      community.allPlants.width[cohortIndex] = allometry.widthFromShootBiomassByRatioAndShootCorrection(utils, community.allPlants.shootBiomass[cohortIndex], parameter.plantHeightToWidthRatio[pft],
                                                                                                             parameter.plantShootCorrectionFactor[pft]);
 
-      community.allPlants.at(cohortIndex)->height = allometry.heightFromWidthByRatio(community.allPlants.at(cohortIndex)->width, parameter.plantHeightToWidthRatio[pft]);
-      community.allPlants.at(cohortIndex)->coveredArea = allometry.areaFromWidth(community.allPlants.at(cohortIndex)->width);
+      community.allPlants.height[cohortIndex] = allometry.heightFromWidthByRatio(community.allPlants.width[cohortIndex], parameter.plantHeightToWidthRatio[pft]);
+      community.allPlants.coveredArea[cohortIndex] = allometry.areaFromWidth(community.allPlants.width[cohortIndex]);
    }
 
-   community.allPlants.at(cohortIndex)->laiGreen =
-       allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.at(cohortIndex)->shootBiomassGreenLeaves, community.allPlants.at(cohortIndex)->coveredArea, parameter.plantSpecificLeafArea[pft]);
-   community.allPlants.at(cohortIndex)->laiBrown =
-       allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.at(cohortIndex)->shootBiomassBrownLeaves, community.allPlants.at(cohortIndex)->coveredArea, parameter.plantSpecificLeafArea[pft]);
-   community.allPlants.at(cohortIndex)->lai = community.allPlants.at(cohortIndex)->laiBrown + community.allPlants.at(cohortIndex)->laiGreen;
+   community.allPlants.laiGreen[cohortIndex] =
+       allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.shootBiomassGreenLeaves[cohortIndex], community.allPlants.coveredArea[cohortIndex], parameter.plantSpecificLeafArea[pft]);
+   community.allPlants.laiBrown[cohortIndex] =
+       allometry.laiFromShootBiomassAreaSla(utils, community.allPlants.shootBiomassBrownLeaves[cohortIndex], community.allPlants.coveredArea[cohortIndex], parameter.plantSpecificLeafArea[pft]);
+   community.allPlants.lai[cohortIndex] = community.allPlants.laiBrown[cohortIndex] + community.allPlants.laiGreen[cohortIndex];
 }
 
-void MORTALITY::doRootSenescenceAndLitterFall(COMMUNITY &community, PARAMETER parameter, SOIL soil, int cohortIndex, int pft)
+void MORTALITY::doRootSenescenceAndLitterFall(COMMUNITY &community, const PARAMETER &parameter, SOIL &soil, int cohortIndex, int pft)
 {
-   double dyingRootBiomass = community.allPlants.at(cohortIndex)->rootBiomass * (1.0 / parameter.rootLifeSpan[pft]);
+   double dyingRootBiomass = community.allPlants.rootBiomass[cohortIndex] * (1.0 / parameter.rootLifeSpan[pft]);
 
-   soil.transferDyingPlantPartsToLitterPools(parameter, community.allPlants.at(cohortIndex)->amount, dyingRootBiomass, 2, pft);
-   community.allPlants.at(cohortIndex)->rootBiomass -= dyingRootBiomass;
-   community.allPlants.at(cohortIndex)->rootCarbon = community.allPlants.at(cohortIndex)->rootBiomass * carbonContentOdm;
-   community.allPlants.at(cohortIndex)->rootNitrogen = community.allPlants.at(cohortIndex)->rootCarbon / parameter.plantCNRatioRoots[pft];
+   soil.transferDyingPlantPartsToLitterPools(parameter, community.allPlants.amount[cohortIndex], dyingRootBiomass, 2, pft);
+   community.allPlants.rootBiomass[cohortIndex] -= dyingRootBiomass;
+   community.allPlants.rootCarbon[cohortIndex] = community.allPlants.rootBiomass[cohortIndex] * carbonContentOdm;
+   community.allPlants.rootNitrogen[cohortIndex] = community.allPlants.rootCarbon[cohortIndex] / parameter.plantCNRatioRoots[pft];
 }
 
-void MORTALITY::doNitrogenRelocation(UTILS utils, PARAMETER parameter, COMMUNITY &community, double browningLeafBiomass, int cohortIndex, int pft)
+void MORTALITY::doNitrogenRelocation(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, double browningLeafBiomass, int cohortIndex, int pft)
 {
    double carbonContentBrowningLeaves = browningLeafBiomass * carbonContentOdm;
    double previousNitrogenContentBrowningLeaves = carbonContentBrowningLeaves / parameter.plantCNRatioGreenLeaves[pft];
    double currentNitrogenContentBrowningLeaves = carbonContentBrowningLeaves / parameter.plantCNRatioBrownLeaves[pft];
 
    double relocatedNitrogen = previousNitrogenContentBrowningLeaves - currentNitrogenContentBrowningLeaves;
-   community.allPlants[cohortIndex]->nitrogenSurplus += relocatedNitrogen;
-   community.allPlants[cohortIndex]->shootNitrogen -= relocatedNitrogen;
+   community.allPlants.nitrogenSurplus[cohortIndex] += relocatedNitrogen;
+   community.allPlants.shootNitrogen[cohortIndex] -= relocatedNitrogen;
 
-   if (abs((community.allPlants.at(cohortIndex)->shootNitrogenBrownLeaves + community.allPlants.at(cohortIndex)->shootNitrogenGreenLeaves) - community.allPlants.at(cohortIndex)->shootNitrogen) > tolerance)
+   if (abs((community.allPlants.shootNitrogenBrownLeaves[cohortIndex] + community.allPlants.shootNitrogenGreenLeaves[cohortIndex]) - community.allPlants.shootNitrogen[cohortIndex]) > tolerance)
    {
       utils.handleError("Error (mortality): relocated nitrogen due to senescence does not match with CN ratios.");
    }
@@ -159,30 +157,28 @@ void MORTALITY::doNitrogenRelocation(UTILS utils, PARAMETER parameter, COMMUNITY
 
 /* Plant mortality due to thinning of the community */
 // * @cite Concept of crowding mortality is derived from the forest model FORMIND (www.formind.org)
-void MORTALITY::doPlantCrowding(PARAMETER parameter, UTILS utils, SOIL &soil, COMMUNITY &community, int cohortIndex, int pft)
+void MORTALITY::doPlantCrowding(const PARAMETER &parameter, const UTILS &utils, SOIL &soil, COMMUNITY &community, int cohortIndex, int pft)
 {
-   if (community.allPlants[cohortIndex]->amount > 0)
+   if (community.allPlants.amount[cohortIndex] > 0)
    {
       if (community.coveredAreaOfAllPlants > 1.0)
       {
-         std::uniform_real_distribution<> dis(0.0, 1.0);
-         std::mt19937 gen(community.randomNumberIndex); // generator initialized with the incremental variable
-         double randomNumber = dis(gen);
+         double randomNumber = random.uniform(parameter.randomNumberGeneratorSeed, parameter.day, community.allPlants.cohortId[cohortIndex], randomEventCrowdingMortality, 0);
 
-         double amountOfTooManyPlants = community.allPlants[cohortIndex]->amount * (1.0 - (1.0 / community.coveredAreaOfAllPlants));
+         double amountOfTooManyPlants = community.allPlants.amount[cohortIndex] * (1.0 - (1.0 / community.coveredAreaOfAllPlants));
          double letAnotherPlantDy = amountOfTooManyPlants - int(amountOfTooManyPlants);
          if (randomNumber <= letAnotherPlantDy)
          {
             amountOfTooManyPlants += 1.0;
          }
 
-         if (community.allPlants[cohortIndex]->amount - amountOfTooManyPlants >= 0)
+         if (community.allPlants.amount[cohortIndex] - amountOfTooManyPlants >= 0)
          {
-            soil.transferDyingPlantPartsToLitterPools(parameter, amountOfTooManyPlants, community.allPlants.at(cohortIndex)->shootBiomassGreenLeaves, 0, pft);
-            soil.transferDyingPlantPartsToLitterPools(parameter, amountOfTooManyPlants, community.allPlants.at(cohortIndex)->shootBiomassBrownLeaves, 1, pft);
-            soil.transferDyingPlantPartsToLitterPools(parameter, amountOfTooManyPlants, community.allPlants.at(cohortIndex)->rootBiomass, 2, pft);
-            soil.transferDyingPlantPartsToLitterPools(parameter, amountOfTooManyPlants, community.allPlants.at(cohortIndex)->recruitmentBiomass, 3, pft);
-            community.allPlants[cohortIndex]->amount -= amountOfTooManyPlants;
+            soil.transferDyingPlantPartsToLitterPools(parameter, amountOfTooManyPlants, community.allPlants.shootBiomassGreenLeaves[cohortIndex], 0, pft);
+            soil.transferDyingPlantPartsToLitterPools(parameter, amountOfTooManyPlants, community.allPlants.shootBiomassBrownLeaves[cohortIndex], 1, pft);
+            soil.transferDyingPlantPartsToLitterPools(parameter, amountOfTooManyPlants, community.allPlants.rootBiomass[cohortIndex], 2, pft);
+            soil.transferDyingPlantPartsToLitterPools(parameter, amountOfTooManyPlants, community.allPlants.recruitmentBiomass[cohortIndex], 3, pft);
+            community.allPlants.amount[cohortIndex] -= amountOfTooManyPlants;
          }
          else
          {
@@ -197,48 +193,47 @@ void MORTALITY::doPlantCrowding(PARAMETER parameter, UTILS utils, SOIL &soil, CO
 }
 
 /**
- * @brief Applies basic mortality to a plant in the community based on its intrinsic mortality rate.
+ * @brief Applies basic mortality to the plants of a cohort based on their intrinsic mortality rate.
  *
- * This function computes the probability of death for a given plant and
- * decreases the plant amount in the respective cohort if the
- * random number generated is less than or equal to the calculated mortality probability.
+ * This function computes the probability of death for the plants of a given cohort.
+ * Since every plant of the cohort dies independently with this probability, the number
+ * of dying plants follows a binomial distribution and is sampled by one binomial draw per
+ * cohort, keyed by the day and the cohort id. The dying plants are transferred to the
+ * litter pools in one batch and the plant amount of the cohort is decreased accordingly.
  *
  * @param parameter Reference to the PARAMETER object containing simulation settings.
  * @param utils Utility functions used for calculations and operations.
+ * @param soil Reference to the SOIL object receiving the litter of the dying plants.
  * @param community Reference to the COMMUNITY object representing the plant community.
  * @param cohortIndex The index of the plant cohort within the community's list of plants.
  * @param pft The plant functional type (PFT) index of the plant being assessed.
  *
- * @note The function retrieves the mortality probability for the specified plant and
- *       checks if the plant amount in the cohort is greater than zero before decrementing it.
- *       If the amount is zero, an error is reported using the utility function.
+ * @note If more plants shall die than are available in the cohort or the mortality probability
+ *       is not finite (e.g. invalid parameters), an error is reported using the utility function.
  */
-void MORTALITY::doBasicMortality(PARAMETER parameter, UTILS utils, SOIL &soil, COMMUNITY &community, int cohortIndex, int pft)
+void MORTALITY::doBasicMortality(const PARAMETER &parameter, const UTILS &utils, SOIL &soil, COMMUNITY &community, int cohortIndex, int pft)
 {
    double mortalityProbability = getPlantMortalityProbability(parameter, community, cohortIndex, pft);
-
-   for (int plantIndex = 0; plantIndex < community.allPlants[cohortIndex]->amount; plantIndex++)
+   int numberOfPlantsInCohort = community.allPlants.amount[cohortIndex];
+   if (!std::isfinite(mortalityProbability))
    {
-      if (community.allPlants[cohortIndex]->amount > 0)
-      {
-         std::uniform_real_distribution<> dis(0.0, 1.0);
-         std::mt19937 gen(community.randomNumberIndex); // generator initialized with the incremental variable
-         double randomNumber = dis(gen);
+      utils.handleError("Error (mortality): the mortality probability is not a finite number. No plants of the cohort die.");
+   }
 
-         /* let plants die according to the mortality probability */
-         if (randomNumber <= mortalityProbability)
-         {
-            soil.transferDyingPlantPartsToLitterPools(parameter, 1, community.allPlants.at(cohortIndex)->shootBiomassGreenLeaves, 0, pft);
-            soil.transferDyingPlantPartsToLitterPools(parameter, 1, community.allPlants.at(cohortIndex)->shootBiomassBrownLeaves, 1, pft);
-            soil.transferDyingPlantPartsToLitterPools(parameter, 1, community.allPlants.at(cohortIndex)->rootBiomass, 2, pft);
-            soil.transferDyingPlantPartsToLitterPools(parameter, 1, community.allPlants.at(cohortIndex)->recruitmentBiomass, 3, pft);
-            community.allPlants[cohortIndex]->amount -= 1;
-         }
-      }
-      else
-      {
-         utils.handleError("Error (mortality): no more plants available in the cohort to die.");
-      }
+   /* number of plants dying according to the mortality probability */
+   int numberOfDyingPlants = random.binomial(numberOfPlantsInCohort, mortalityProbability, parameter.randomNumberGeneratorSeed, parameter.day, community.allPlants.cohortId[cohortIndex], randomEventBasicMortality);
+
+   if (numberOfDyingPlants > numberOfPlantsInCohort)
+   {
+      utils.handleError("Error (mortality): more plants shall die than are available in the cohort.");
+   }
+   else if (numberOfDyingPlants > 0)
+   {
+      soil.transferDyingPlantPartsToLitterPools(parameter, numberOfDyingPlants, community.allPlants.shootBiomassGreenLeaves[cohortIndex], 0, pft);
+      soil.transferDyingPlantPartsToLitterPools(parameter, numberOfDyingPlants, community.allPlants.shootBiomassBrownLeaves[cohortIndex], 1, pft);
+      soil.transferDyingPlantPartsToLitterPools(parameter, numberOfDyingPlants, community.allPlants.rootBiomass[cohortIndex], 2, pft);
+      soil.transferDyingPlantPartsToLitterPools(parameter, numberOfDyingPlants, community.allPlants.recruitmentBiomass[cohortIndex], 3, pft);
+      community.allPlants.amount[cohortIndex] -= numberOfDyingPlants;
    }
 }
 
@@ -260,11 +255,11 @@ void MORTALITY::doBasicMortality(PARAMETER parameter, UTILS utils, SOIL &soil, C
  *       which mortality probability to return. If the plant is adult, it returns the
  *       adult mortality probability; otherwise, it returns the seedling mortality probability.
  */
-double MORTALITY::getPlantMortalityProbability(PARAMETER parameter, COMMUNITY community, int cohortIndex, int pft)
+double MORTALITY::getPlantMortalityProbability(const PARAMETER &parameter, const COMMUNITY &community, int cohortIndex, int pft)
 {
-   if (community.allPlants[cohortIndex]->age >= parameter.maturityAges[pft])
+   if (community.allPlants.age[cohortIndex] >= parameter.maturityAges[pft])
    {
-      if (parameter.plantLifeSpan[pft] == "annual" && community.allPlants[cohortIndex]->age > 365)
+      if (parameter.plantLifeSpan[pft] == "annual" && community.allPlants.age[cohortIndex] > 365)
       {
          return (1.0);
       }
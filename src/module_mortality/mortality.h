@@ -2,8 +2,8 @@
 #include "../module_plant/community.h"
 #include "../module_parameter/parameter.h"
 #include "../module_growth/growth.h"
+#include "../module_random/random.h"
 #include "../utils/utils.h"
-#include <random>
 
 /**
  * @class MORTALITY
@@ -20,14 +20,16 @@ public:
    MORTALITY();
    ~MORTALITY();
 
-   void doPlantMortality(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry, GROWTH growth, INTERACTION interaction, SOIL soil);
-   void doSenescenceAndLitterFall(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry, GROWTH growth, INTERACTION interaction, SOIL soil, int cohortIndex, int pft);
-   double doLeafSenescence(COMMUNITY &community, PARAMETER parameter, GROWTH growth, INTERACTION interaction, int cohortIndex, int pft);
-   void doLeafLitterFall(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter, SOIL soil, int cohortIndex, int pft);
-   void updatePlantSize(UTILS utils, COMMUNITY &community, ALLOMETRY allometry, PARAMETER parameter, int fractionLeavesFalling, int cohortIndex, int pft);
-   void doNitrogenRelocation(UTILS utils, PARAMETER parameter, COMMUNITY &community, double browningLeafBiomass, int cohortIndex, int pft);
-   void doRootSenescenceAndLitterFall(COMMUNITY &community, PARAMETER parameter, SOIL soil, int cohortIndex, int pft);
-   void doPlantCrowding(PARAMETER parameter, UTILS utils, SOIL &soil, COMMUNITY &community, int cohortIndex, int pft);
-   void doBasicMortality(PARAMETER parameter, UTILS utils, SOIL &soil, COMMUNITY &community, int cohortIndex, int pft);
-   double getPlantMortalityProbability(PARAMETER parameter, COMMUNITY community, int cohortIndex, int pft);
+   RANDOM random; /// Counter-based random number generator for stochastic mortality events
+
+   void doPlantMortality(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry, const INTERACTION &interaction, SOIL &soil);
+   void doSenescenceAndLitterFall(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry, const INTERACTION &interaction, SOIL &soil, int cohortIndex, int pft);
+   double doLeafSenescence(COMMUNITY &community, const PARAMETER &parameter, const INTERACTION &interaction, int cohortIndex, int pft);
+   void doLeafLitterFall(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter, SOIL &soil, int cohortIndex, int pft);
+   void updatePlantSize(const UTILS &utils, COMMUNITY &community, const ALLOMETRY &allometry, const PARAMETER &parameter, int fractionLeavesFalling, int cohortIndex, int pft);
+   void doNitrogenRelocation(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, double browningLeafBiomass, int cohortIndex, int pft);
+   void doRootSenescenceAndLitterFall(COMMUNITY &community, const PARAMETER &parameter, SOIL &soil, int cohortIndex, int pft);
+   void doPlantCrowding(const PARAMETER &parameter, const UTILS &utils, SOIL &soil, COMMUNITY &community, int cohortIndex, int pft);
+   void doBasicMortality(const PARAMETER &parameter, const UTILS &utils, SOIL &soil, COMMUNITY &community, int cohortIndex, int pft);
+   double getPlantMortalityProbability(const PARAMETER &parameter, const COMMUNITY &community, int cohortIndex, int pft);
 };
\ No newline at end of file
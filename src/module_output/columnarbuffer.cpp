@@ -0,0 +1,175 @@
+#include "columnarbuffer.h"
+#include <cstring>
+
+COLUMNARBUFFER::COLUMNARBUFFER()
+{
+   numberOfRows = 0;
+};
+COLUMNARBUFFER::~COLUMNARBUFFER() {};
+
+/**
+ * @brief Sets the columns from a tab-separated text header (the `Date` column is stored in the day index).
+ *
+ * @param header Header line of the corresponding text output file.
+ */
+void COLUMNARBUFFER::setColumnNames(const std::string &header)
+{
+   columnNames.clear();
+   std::size_t begin = 0;
+   while (begin <= header.size())
+   {
+      std::size_t end = header.find_first_of("\t\r\n", begin);
+      if (end == std::string::npos)
+      {
+         end = header.size();
+      }
+      std::string name = header.substr(begin, end - begin);
+      if (!name.empty() && name != "Date")
+      {
+         columnNames.push_back(name);
+      }
+      begin = end + 1;
+   }
+   columnTypes.clear();
+   columnValues.assign(columnNames.size(), std::string());
+   dayIndex.clear();
+   numberOfRows = 0;
+}
+
+/**
+ * @brief Appends the file header with the column names to a buffer.
+ */
+void COLUMNARBUFFER::appendFileHeader(std::string &buffer) const
+{
+   std::string names;
+   for (const auto &name : columnNames)
+   {
+      std::uint16_t length = static_cast<std::uint16_t>(name.size());
+      names.append(reinterpret_cast<const char *>(&length), sizeof(length));
+      names.append(name);
+   }
+
+   COLUMNARFILEHEADER fileHeader{};
+   std::memcpy(fileHeader.magic, COLUMNARFORMAT::fileMagic, sizeof(fileHeader.magic));
+   fileHeader.byteOrderMark = COLUMNARFORMAT::byteOrderMark;
+   fileHeader.numberOfColumns = static_cast<std::uint32_t>(columnNames.size());
+   fileHeader.headerSize = COLUMNARFORMAT::getPaddedSize(sizeof(fileHeader) + names.size());
+
+   std::size_t begin = buffer.size();
+   buffer.append(reinterpret_cast<const char *>(&fileHeader), sizeof(fileHeader));
+   buffer.append(names);
+   buffer.resize(begin + fileHeader.headerSize, '\0');
+}
+
+/**
+ * @brief Starts a new row and adds its day to the day index if the day is new.
+ *
+ * @param date Date of the row (YYYY-MM-DD).
+ * @param day Day count of the row.
+ */
+void COLUMNARBUFFER::beginRow(const std::string &date, int day)
+{
+   if (dayIndex.empty() || dayIndex.back().day != day)
+   {
+      COLUMNARDAY entry{};
+      entry.day = day;
+      entry.firstRow = numberOfRows;
+      date.copy(entry.date, sizeof(entry.date) - 1);
+      dayIndex.push_back(entry);
+   }
+   numberOfRows++;
+}
+
+void COLUMNARBUFFER::appendValue(std::size_t column, std::int32_t value)
+{
+   appendBytes(column, COLUMNTYPE::int32, &value, sizeof(value));
+}
+
+void COLUMNARBUFFER::appendValue(std::size_t column, double value)
+{
+   appendBytes(column, COLUMNTYPE::float64, &value, sizeof(value));
+}
+
+/**
+ * @brief Appends the bytes of a value to a column (the first row of a block sets the type of the column).
+ */
+void COLUMNARBUFFER::appendBytes(std::size_t column, COLUMNTYPE type, const void *value, std::size_t width)
+{
+   if (column == columnTypes.size())
+   {
+      columnTypes.push_back(type);
+   }
+   columnValues[column].append(static_cast<const char *>(value), width);
+}
+
+/**
+ * @brief Serializes the current block into a buffer and starts a new block.
+ *
+ * Nothing is appended if the block has no rows.
+ *
+ * @param buffer Output buffer handed over to the writer of the output file.
+ */
+void COLUMNARBUFFER::moveBlockToBuffer(std::string &buffer)
+{
+   if (numberOfRows == 0)
+   {
+      return;
+   }
+
+   std::uint64_t typesSize = COLUMNARFORMAT::getPaddedSize(columnNames.size());
+   std::uint64_t blockSize = sizeof(COLUMNARBLOCKHEADER) + typesSize + dayIndex.size() * sizeof(COLUMNARDAY);
+   for (const auto &values : columnValues)
+   {
+      blockSize += COLUMNARFORMAT::getPaddedSize(values.size());
+   }
+
+   COLUMNARBLOCKHEADER blockHeader{};
+   std::memcpy(blockHeader.magic, COLUMNARFORMAT::blockMagic, sizeof(blockHeader.magic));
+   blockHeader.blockSize = blockSize;
+   blockHeader.numberOfRows = numberOfRows;
+   blockHeader.numberOfDays = static_cast<std::uint32_t>(dayIndex.size());
+   blockHeader.numberOfColumns = static_cast<std::uint32_t>(columnNames.size());
+
+   std::size_t begin = buffer.size();
+   buffer.reserve(begin + blockSize);
+   buffer.append(reinterpret_cast<const char *>(&blockHeader), sizeof(blockHeader));
+   buffer.append(reinterpret_cast<const char *>(columnTypes.data()), columnTypes.size());
+   buffer.resize(begin + sizeof(blockHeader) + typesSize, '\0');
+   buffer.append(reinterpret_cast<const char *>(dayIndex.data()), dayIndex.size() * sizeof(COLUMNARDAY));
+   for (auto &values : columnValues)
+   {
+      buffer.append(values);
+      buffer.resize(COLUMNARFORMAT::getPaddedSize(buffer.size() - begin) + begin, '\0');
+      values.clear();
+   }
+
+   columnTypes.clear();
+   dayIndex.clear();
+   numberOfRows = 0;
+}
+
+/**
+ * @brief Returns the number of bytes of the values in the current block.
+ */
+std::size_t COLUMNARBUFFER::size() const
+{
+   std::size_t bytes = dayIndex.size() * sizeof(COLUMNARDAY);
+   for (const auto &values : columnValues)
+   {
+      bytes += values.size();
+   }
+   return bytes;
+}
+
+/**
+ * @brief Returns the number of bytes allocated by the column buffers and the day index.
+ */
+std::size_t COLUMNARBUFFER::capacity() const
+{
+   std::size_t bytes = dayIndex.capacity() * sizeof(COLUMNARDAY);
+   for (const auto &values : columnValues)
+   {
+      bytes += values.capacity();
+   }
+   return bytes;
+}
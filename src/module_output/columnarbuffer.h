@@ -0,0 +1,89 @@
+#pragma once
+#include "columnarformat.h"
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <type_traits>
+
+/**
+ * @brief Collects simulation results of one output level as columns of fixed-width values.
+ *
+ * Counterpart of the text buffers of the `OUTPUT` class for the columnar binary output
+ * (outputFormat `columnar`, layout in columnarformat.h). Rows are appended column-wise to
+ * byte buffers, the date of each day is stored only once in the day index. When the block
+ * is written, it is serialized into an output buffer and the column buffers keep their capacity.
+ */
+class COLUMNARBUFFER
+{
+public:
+   COLUMNARBUFFER();
+   ~COLUMNARBUFFER();
+
+   std::vector<std::string> columnNames;  /// Names of the columns (text header without `Date`)
+   std::vector<COLUMNTYPE> columnTypes;   /// Types of the columns (set by the first row of a block)
+   std::vector<std::string> columnValues; /// Values of each column of the current block
+   std::vector<COLUMNARDAY> dayIndex;     /// Day index of the current block
+   std::uint32_t numberOfRows;            /// Rows of the current block
+
+   void setColumnNames(const std::string &header);
+   void appendFileHeader(std::string &buffer) const;
+   void beginRow(const std::string &date, int day);
+   void appendValue(std::size_t column, std::int32_t value);
+   void appendValue(std::size_t column, double value);
+   void moveBlockToBuffer(std::string &buffer);
+   std::size_t size() const;
+   std::size_t capacity() const;
+
+   /**
+    * @brief Appends a row of the columns of the text header after `Date`.
+    *
+    * Integral values are stored as `int32`, floating point values as `float64`.
+    *
+    * @param date Date of the row (YYYY-MM-DD).
+    * @param day Day count of the row (first column).
+    * @param values Values of the remaining columns.
+    */
+   template <typename... VALUES>
+   void appendRow(const std::string &date, int day, const VALUES &...values)
+   {
+      beginRow(date, day);
+      std::size_t column = 0;
+      appendValue(column++, static_cast<std::int32_t>(day));
+      ((appendTypedValue(column++, values)), ...);
+   }
+
+   /**
+    * @brief Appends a row of the selected columns (see `OUTPUTSELECTION`).
+    *
+    * @param fieldIsSelected Selection of each column of the text header (`Date` and `DayCount` are always stored).
+    * @param date Date of the row (YYYY-MM-DD).
+    * @param day Day count of the row (first column).
+    * @param values Values of the remaining columns.
+    */
+   template <typename... VALUES>
+   void appendSelectedRow(const std::vector<bool> &fieldIsSelected, const std::string &date, int day, const VALUES &...values)
+   {
+      beginRow(date, day);
+      std::size_t column = 0;
+      std::size_t field = 2;
+      appendValue(column++, static_cast<std::int32_t>(day));
+      ((fieldIsSelected[field++] ? appendTypedValue(column++, values) : void()), ...);
+   }
+
+private:
+   template <typename VALUE>
+   void appendTypedValue(std::size_t column, const VALUE &value)
+   {
+      static_assert(std::is_arithmetic_v<VALUE>, "Columnar output only stores numbers.");
+      if constexpr (std::is_floating_point_v<VALUE>)
+      {
+         appendValue(column, static_cast<double>(value));
+      }
+      else
+      {
+         appendValue(column, static_cast<std::int32_t>(value));
+      }
+   }
+
+   void appendBytes(std::size_t column, COLUMNTYPE type, const void *value, std::size_t width);
+};
@@ -0,0 +1,77 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * @brief Layout of the columnar binary output files (outputFormat `columnar`).
+ *
+ * A columnar output file mirrors one text output file (community, PFT population or plant
+ * level): the columns are those of the text header (see `OUTPUT::writeHeaderInOutputFiles()`)
+ * without the `Date` column, whose values are stored once per day in the day index of each block.
+ *
+ * - File header (`COLUMNARFILEHEADER`) followed by the column names (length as `uint16_t`
+ *   and characters), padded to a multiple of 8 bytes.
+ * - Blocks, one per written output buffer, each consisting of
+ *   - the block header (`COLUMNARBLOCKHEADER`),
+ *   - the type of each column (`COLUMNTYPE`, one byte per column), padded to 8 bytes,
+ *   - the day index (`COLUMNARDAY` per simulated day in the block, ascending days),
+ *   - the values of each column (`numberOfRows` fixed-width values), each padded to 8 bytes.
+ *
+ * All blocks start at multiples of 8 bytes, so that the columns can be used in place in a
+ * memory-mapped file (see `COLUMNARREADER`). Values are stored in the byte order of the
+ * writing machine, which is recorded in the file header. A block that was not completely
+ * written (e.g. aborted run) is ignored by the reader.
+ */
+
+/** @brief Type of the values of a column. */
+enum class COLUMNTYPE : std::uint8_t
+{
+   int32 = 1,   /// Integral values (day counts, PFTs, numbers of plants and soil layers)
+   float64 = 2, /// Floating point values
+};
+
+/** @brief Header at the beginning of a columnar output file. */
+struct COLUMNARFILEHEADER
+{
+   char magic[8];                /// "GMCOLS1" (terminated by '\0')
+   std::uint32_t byteOrderMark;  /// 0x01020304 in the byte order of the writing machine
+   std::uint32_t numberOfColumns; /// Number of columns of each block
+   std::uint64_t headerSize;     /// Size of the file header including the column names and padding (in bytes)
+};
+
+/** @brief Header at the beginning of a block of rows. */
+struct COLUMNARBLOCKHEADER
+{
+   char magic[8];                 /// "GMBLOCK" (terminated by '\0')
+   std::uint64_t blockSize;       /// Size of the block including its header (in bytes)
+   std::uint32_t numberOfRows;    /// Number of rows of the block
+   std::uint32_t numberOfDays;    /// Number of entries of the day index
+   std::uint32_t numberOfColumns; /// Number of columns (equal to the file header)
+   std::uint32_t reserved;        /// Unused (alignment)
+};
+
+/** @brief Entry of the day index of a block: rows `firstRow` up to the `firstRow` of the next entry belong to the day. */
+struct COLUMNARDAY
+{
+   std::int32_t day;        /// Day count of the simulation
+   std::uint32_t firstRow;  /// First row of the day in the block
+   char date[16];           /// Date (YYYY-MM-DD, terminated by '\0')
+};
+
+namespace COLUMNARFORMAT
+{
+   inline constexpr char fileMagic[8] = "GMCOLS1";
+   inline constexpr char blockMagic[8] = "GMBLOCK";
+   inline constexpr std::uint32_t byteOrderMark = 0x01020304;
+
+   /** @brief Returns the size of `size` bytes padded to a multiple of 8. */
+   inline constexpr std::uint64_t getPaddedSize(std::uint64_t size)
+   {
+      return (size + 7) & ~static_cast<std::uint64_t>(7);
+   }
+
+   /** @brief Returns the width of a value of a column type (in bytes). */
+   inline constexpr std::uint64_t getWidth(COLUMNTYPE type)
+   {
+      return (type == COLUMNTYPE::int32) ? 4 : 8;
+   }
+}
@@ -0,0 +1,363 @@
+#include "columnarreader.h"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+COLUMNARREADER::COLUMNARREADER()
+{
+   data = nullptr;
+   fileSize = 0;
+   headerSize = 0;
+#ifdef _WIN32
+   fileHandle = nullptr;
+   mappingHandle = nullptr;
+#else
+   fileDescriptor = -1;
+#endif
+};
+
+COLUMNARREADER::~COLUMNARREADER()
+{
+   close();
+};
+
+/**
+ * @brief Maps a columnar output file into memory and reads its column names and block structure.
+ *
+ * @param filename Name of the columnar output file.
+ * @return False (with `errorMessage`) if the file cannot be mapped or is not a columnar output file.
+ */
+bool COLUMNARREADER::open(const std::string &filename)
+{
+   close();
+   errorMessage.clear();
+   if (!mapFile(filename) || !readFileHeader() || !readBlocks())
+   {
+      close();
+      return false;
+   }
+   return true;
+}
+
+/**
+ * @brief Unmaps the file. Slices returned before are no longer valid.
+ */
+void COLUMNARREADER::close()
+{
+#ifdef _WIN32
+   if (data != nullptr)
+   {
+      UnmapViewOfFile(data);
+   }
+   if (mappingHandle != nullptr)
+   {
+      CloseHandle(mappingHandle);
+   }
+   if (fileHandle != nullptr)
+   {
+      CloseHandle(fileHandle);
+   }
+   fileHandle = nullptr;
+   mappingHandle = nullptr;
+#else
+   if (data != nullptr && fileSize > 0)
+   {
+      munmap(const_cast<char *>(data), fileSize);
+   }
+   if (fileDescriptor >= 0)
+   {
+      ::close(fileDescriptor);
+   }
+   fileDescriptor = -1;
+#endif
+   data = nullptr;
+   fileSize = 0;
+   headerSize = 0;
+   columnNames.clear();
+   blocks.clear();
+}
+
+bool COLUMNARREADER::is_open() const
+{
+   return data != nullptr;
+}
+
+/**
+ * @brief Maps the file read-only into memory.
+ */
+bool COLUMNARREADER::mapFile(const std::string &filename)
+{
+#ifdef _WIN32
+   fileHandle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+   if (fileHandle == INVALID_HANDLE_VALUE)
+   {
+      fileHandle = nullptr;
+      errorMessage = "The file " + filename + " cannot be opened.";
+      return false;
+   }
+   LARGE_INTEGER size;
+   GetFileSizeEx(fileHandle, &size);
+   fileSize = static_cast<std::uint64_t>(size.QuadPart);
+   if (fileSize < sizeof(COLUMNARFILEHEADER))
+   {
+      errorMessage = "The file " + filename + " is too short for a columnar output file.";
+      return false;
+   }
+   mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+   data = (mappingHandle != nullptr) ? static_cast<const char *>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0)) : nullptr;
+#else
+   fileDescriptor = ::open(filename.c_str(), O_RDONLY);
+   if (fileDescriptor < 0)
+   {
+      errorMessage = "The file " + filename + " cannot be opened.";
+      return false;
+   }
+   struct stat status;
+   fstat(fileDescriptor, &status);
+   fileSize = static_cast<std::uint64_t>(status.st_size);
+   if (fileSize < sizeof(COLUMNARFILEHEADER))
+   {
+      errorMessage = "The file " + filename + " is too short for a columnar output file.";
+      return false;
+   }
+   void *mapping = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+   data = (mapping != MAP_FAILED) ? static_cast<const char *>(mapping) : nullptr;
+#endif
+   if (data == nullptr)
+   {
+      errorMessage = "The file " + filename + " cannot be mapped into memory.";
+      return false;
+   }
+   return true;
+}
+
+/**
+ * @brief Checks the file header and reads the column names.
+ */
+bool COLUMNARREADER::readFileHeader()
+{
+   COLUMNARFILEHEADER fileHeader;
+   std::memcpy(&fileHeader, data, sizeof(fileHeader));
+   if (std::memcmp(fileHeader.magic, COLUMNARFORMAT::fileMagic, sizeof(fileHeader.magic)) != 0)
+   {
+      errorMessage = "The file is not a columnar output file.";
+      return false;
+   }
+   if (fileHeader.byteOrderMark != COLUMNARFORMAT::byteOrderMark)
+   {
+      errorMessage = "The file was written on a machine with another byte order.";
+      return false;
+   }
+   if (fileHeader.headerSize > fileSize)
+   {
+      errorMessage = "The header of the columnar output file is incomplete.";
+      return false;
+   }
+
+   std::uint64_t position = sizeof(fileHeader);
+   for (std::uint32_t column = 0; column < fileHeader.numberOfColumns; column++)
+   {
+      std::uint16_t length;
+      if (position + sizeof(length) > fileHeader.headerSize)
+      {
+         errorMessage = "The column names of the columnar output file are incomplete.";
+         return false;
+      }
+      std::memcpy(&length, data + position, sizeof(length));
+      position += sizeof(length);
+      if (position + length > fileHeader.headerSize)
+      {
+         errorMessage = "The column names of the columnar output file are incomplete.";
+         return false;
+      }
+      columnNames.emplace_back(data + position, length);
+      position += length;
+   }
+   headerSize = fileHeader.headerSize;
+   return true;
+}
+
+/**
+ * @brief Reads the headers of all complete blocks (an incompletely written last block is ignored).
+ */
+bool COLUMNARREADER::readBlocks()
+{
+   std::uint64_t position = headerSize;
+   while (position + sizeof(COLUMNARBLOCKHEADER) <= fileSize)
+   {
+      COLUMNARBLOCKHEADER blockHeader;
+      std::memcpy(&blockHeader, data + position, sizeof(blockHeader));
+      if (std::memcmp(blockHeader.magic, COLUMNARFORMAT::blockMagic, sizeof(blockHeader.magic)) != 0 ||
+          blockHeader.numberOfColumns != columnNames.size())
+      {
+         errorMessage = "The columnar output file contains an invalid block.";
+         return false;
+      }
+      if (blockHeader.blockSize > fileSize - position)
+      {
+         break;
+      }
+
+      /* every part of the block is checked to lie within the block before it is read */
+      const std::uint64_t blockEnd = position + blockHeader.blockSize;
+      std::uint64_t blockPosition = position + sizeof(blockHeader);
+      auto fitsInBlock = [&blockPosition, blockEnd](std::uint64_t size)
+      { return blockPosition <= blockEnd && size <= blockEnd - blockPosition; };
+
+      BLOCK block;
+      block.numberOfRows = blockHeader.numberOfRows;
+      block.numberOfDays = blockHeader.numberOfDays;
+      const std::uint64_t columnTypesSize = COLUMNARFORMAT::getPaddedSize(columnNames.size());
+      const std::uint64_t dayIndexSize = static_cast<std::uint64_t>(block.numberOfDays) * sizeof(COLUMNARDAY);
+      if (!fitsInBlock(columnTypesSize + dayIndexSize))
+      {
+         errorMessage = "The columnar output file contains a block of inconsistent size.";
+         return false;
+      }
+      block.columnTypes = reinterpret_cast<const COLUMNTYPE *>(data + blockPosition);
+      blockPosition += columnTypesSize;
+      block.dayIndex = reinterpret_cast<const COLUMNARDAY *>(data + blockPosition);
+      blockPosition += dayIndexSize;
+      for (std::size_t column = 0; column < columnNames.size(); column++)
+      {
+         if (block.columnTypes[column] != COLUMNTYPE::int32 && block.columnTypes[column] != COLUMNTYPE::float64)
+         {
+            errorMessage = "The columnar output file contains a column of unknown type.";
+            return false;
+         }
+         const std::uint64_t columnSize = COLUMNARFORMAT::getPaddedSize(static_cast<std::uint64_t>(block.numberOfRows) * COLUMNARFORMAT::getWidth(block.columnTypes[column]));
+         if (!fitsInBlock(columnSize))
+         {
+            errorMessage = "The columnar output file contains a block of inconsistent size.";
+            return false;
+         }
+         block.columnValues.push_back(data + blockPosition);
+         blockPosition += columnSize;
+      }
+      if (blockPosition != blockEnd)
+      {
+         errorMessage = "The columnar output file contains a block of inconsistent size.";
+         return false;
+      }
+      blocks.push_back(std::move(block));
+      position += blockHeader.blockSize;
+   }
+   return true;
+}
+
+/**
+ * @brief Returns the names of the columns.
+ */
+const std::vector<std::string> &COLUMNARREADER::getColumnNames() const
+{
+   return columnNames;
+}
+
+/**
+ * @brief Returns the index of a column, -1 if the file has no column of that name.
+ */
+int COLUMNARREADER::getColumnIndex(const std::string &name) const
+{
+   auto it = std::find(columnNames.begin(), columnNames.end(), name);
+   return (it == columnNames.end()) ? -1 : static_cast<int>(it - columnNames.begin());
+}
+
+/**
+ * @brief Returns the type of a column (as stored in the first block, `float64` for files without blocks).
+ */
+COLUMNTYPE COLUMNARREADER::getColumnType(int column) const
+{
+   if (column < 0 || column >= static_cast<int>(columnNames.size()))
+   {
+      throw std::invalid_argument("The columnar output file has no column " + std::to_string(column) + ".");
+   }
+   return blocks.empty() ? COLUMNTYPE::float64 : blocks.front().columnTypes[column];
+}
+
+/**
+ * @brief Returns the blocks of the file.
+ */
+const std::vector<COLUMNARREADER::BLOCK> &COLUMNARREADER::getBlocks() const
+{
+   return blocks;
+}
+
+/**
+ * @brief Returns the total number of rows of all blocks.
+ */
+std::uint64_t COLUMNARREADER::getNumberOfRows() const
+{
+   std::uint64_t numberOfRows = 0;
+   for (const auto &block : blocks)
+   {
+      numberOfRows += block.numberOfRows;
+   }
+   return numberOfRows;
+}
+
+/**
+ * @brief Returns the date (YYYY-MM-DD) of a row of a block from the day index.
+ */
+std::string COLUMNARREADER::getDate(std::size_t block, std::size_t row) const
+{
+   const BLOCK &rows = blocks.at(block);
+   const COLUMNARDAY *end = rows.dayIndex + rows.numberOfDays;
+   const COLUMNARDAY *day = std::upper_bound(rows.dayIndex, end, row, [](std::size_t value, const COLUMNARDAY &entry)
+                                             { return value < entry.firstRow; });
+   if (day == rows.dayIndex)
+   {
+      return std::string();
+   }
+   const COLUMNARDAY &entry = *(day - 1);
+   return std::string(entry.date, strnlen(entry.date, sizeof(entry.date)));
+}
+
+/**
+ * @brief Finds the rows of a block on the days `firstDay` to `lastDay` by a binary search in its day index.
+ *
+ * @return False if the block contains none of the days.
+ */
+bool COLUMNARREADER::findRowRange(std::size_t block, int firstDay, int lastDay, std::size_t &beginRow, std::size_t &endRow) const
+{
+   const BLOCK &rows = blocks[block];
+   const COLUMNARDAY *end = rows.dayIndex + rows.numberOfDays;
+   const COLUMNARDAY *first = std::lower_bound(rows.dayIndex, end, firstDay, [](const COLUMNARDAY &entry, int day)
+                                               { return entry.day < day; });
+   const COLUMNARDAY *last = std::upper_bound(first, end, lastDay, [](int day, const COLUMNARDAY &entry)
+                                              { return day < entry.day; });
+   if (first == last)
+   {
+      return false;
+   }
+   beginRow = first->firstRow;
+   endRow = (last == end) ? rows.numberOfRows : last->firstRow;
+   return true;
+}
+
+/**
+ * @brief Checks that a column exists and has the requested type in all blocks.
+ *
+ * @throws std::invalid_argument Otherwise.
+ */
+void COLUMNARREADER::checkColumnType(int column, COLUMNTYPE type) const
+{
+   if (column < 0 || column >= static_cast<int>(columnNames.size()))
+   {
+      throw std::invalid_argument("The columnar output file has no column " + std::to_string(column) + ".");
+   }
+   for (const auto &block : blocks)
+   {
+      if (block.columnTypes[column] != type)
+      {
+         throw std::invalid_argument("The column " + columnNames[column] + " has another type than requested.");
+      }
+   }
+}
@@ -0,0 +1,135 @@
+#pragma once
+#include "columnarformat.h"
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Values of a column in one block of a columnar output file (not copied, valid while the file is open).
+ */
+template <typename VALUE>
+struct COLUMNSLICE
+{
+   const VALUE *values;  /// First value
+   std::size_t size;     /// Number of values
+   std::size_t block;    /// Block of the values
+   std::size_t firstRow; /// Row of the first value in the block
+
+   const VALUE *begin() const { return values; }
+   const VALUE *end() const { return values + size; }
+   const VALUE &operator[](std::size_t row) const { return values[row]; }
+};
+
+/**
+ * @brief Reads columnar binary output files (layout in columnarformat.h) by mapping them into memory.
+ *
+ * Columns are returned as slices pointing into the mapped file, one per block, so that single
+ * columns or day ranges can be analysed without parsing or copying the values. Day ranges are
+ * located by the day index of each block.
+ *
+ * Example:
+ * @code
+ * COLUMNARREADER reader;
+ * if (reader.open("...__outputPFT__generic_v1.gmcol"))
+ * {
+ *    int column = reader.getColumnIndex("ShootBiomass");
+ *    for (const auto &slice : reader.getColumn<double>(column, 366, 730))
+ *       for (double value : slice) { ... }
+ * }
+ * @endcode
+ */
+class COLUMNARREADER
+{
+public:
+   /** @brief Block of rows in the mapped file. */
+   struct BLOCK
+   {
+      std::uint32_t numberOfRows;                   /// Number of rows
+      std::uint32_t numberOfDays;                   /// Number of entries of the day index
+      const COLUMNTYPE *columnTypes;                /// Type of each column
+      const COLUMNARDAY *dayIndex;                  /// Day index (ascending days)
+      std::vector<const char *> columnValues;       /// First value of each column
+   };
+
+   COLUMNARREADER();
+   ~COLUMNARREADER();
+   COLUMNARREADER(const COLUMNARREADER &) = delete;
+   COLUMNARREADER &operator=(const COLUMNARREADER &) = delete;
+
+   std::string errorMessage; /// Reason why the last `open()` failed
+
+   bool open(const std::string &filename);
+   void close();
+   bool is_open() const;
+
+   const std::vector<std::string> &getColumnNames() const;
+   int getColumnIndex(const std::string &name) const;
+   COLUMNTYPE getColumnType(int column) const;
+   const std::vector<BLOCK> &getBlocks() const;
+   std::uint64_t getNumberOfRows() const;
+   std::string getDate(std::size_t block, std::size_t row) const;
+
+   /**
+    * @brief Returns the values of a column in all blocks.
+    *
+    * @param column Index of the column (see `getColumnIndex()`).
+    * @return One slice per block.
+    *
+    * @throws std::invalid_argument If the column does not exist or has another type than `VALUE`.
+    */
+   template <typename VALUE>
+   std::vector<COLUMNSLICE<VALUE>> getColumn(int column) const
+   {
+      return getColumn<VALUE>(column, std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+   }
+
+   /**
+    * @brief Returns the values of a column on the days `firstDay` to `lastDay` (day counts).
+    *
+    * @param column Index of the column (see `getColumnIndex()`).
+    * @param firstDay First day of the range.
+    * @param lastDay Last day of the range.
+    * @return One slice per block containing days of the range.
+    *
+    * @throws std::invalid_argument If the column does not exist or has another type than `VALUE`.
+    */
+   template <typename VALUE>
+   std::vector<COLUMNSLICE<VALUE>> getColumn(int column, int firstDay, int lastDay) const
+   {
+      static_assert(std::is_same_v<VALUE, std::int32_t> || std::is_same_v<VALUE, double>, "Columns contain int32_t or double values.");
+      checkColumnType(column, std::is_same_v<VALUE, std::int32_t> ? COLUMNTYPE::int32 : COLUMNTYPE::float64);
+      std::vector<COLUMNSLICE<VALUE>> slices;
+      for (std::size_t block = 0; block < blocks.size(); block++)
+      {
+         std::size_t beginRow = 0;
+         std::size_t endRow = 0;
+         if (findRowRange(block, firstDay, lastDay, beginRow, endRow))
+         {
+            const VALUE *values = reinterpret_cast<const VALUE *>(blocks[block].columnValues[column]);
+            slices.push_back({values + beginRow, endRow - beginRow, block, beginRow});
+         }
+      }
+      return slices;
+   }
+
+private:
+   const char *data;                     /// Mapped file
+   std::uint64_t fileSize;               /// Size of the mapped file (in bytes)
+   std::uint64_t headerSize;             /// Size of the file header (position of the first block)
+   std::vector<std::string> columnNames; /// Names of the columns
+   std::vector<BLOCK> blocks;            /// Complete blocks of the file
+#ifdef _WIN32
+   void *fileHandle;
+   void *mappingHandle;
+#else
+   int fileDescriptor;
+#endif
+
+   bool mapFile(const std::string &filename);
+   bool readFileHeader();
+   bool readBlocks();
+   bool findRowRange(std::size_t block, int firstDay, int lastDay, std::size_t &beginRow, std::size_t &endRow) const;
+   void checkColumnType(int column, COLUMNTYPE type) const;
+};
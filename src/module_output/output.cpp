@@ -1,6 +1,11 @@
 #include "output.h"
+#include "../module_profile/trace.h"
 
-OUTPUT::OUTPUT() {};
+OUTPUT::OUTPUT()
+{
+   outputBufferSizeInBytes = 0;
+   columnarOutputActivated = false;
+};
 OUTPUT::~OUTPUT() {};
 
 /**
@@ -11,19 +16,26 @@ OUTPUT::~OUTPUT() {};
  * - Creates and opens the output files for writing.
  * - Writes the header information in the output files.
  * - Opens and reads the output writing dates from a specified file.
+ * - Prepares the formatter of the simulation results (date table, significant digits).
  *
  * @param path The base path for the output files. This is the directory where
  *             the result folder will be created and where output files will be saved.
  * @param utils Utility functions for file handling and directory management.
  * @param parameter Reference to the PARAMETER object containing simulation settings
  *                  and configurations required for output file creation and writing.
+ * @return False if the output files of a resumed run cannot be continued.
  */
-void OUTPUT::prepareModelOutput(std::string path, UTILS utils, PARAMETER &parameter)
+bool OUTPUT::prepareModelOutput(std::string path, UTILS utils, PARAMETER &parameter)
 {
    createOutputFolder(path, utils);
-   createAndOpenOutputFiles(parameter, utils);
+   if (!createAndOpenOutputFiles(parameter, utils))
+   {
+      return false;
+   }
    writeHeaderInOutputFiles(utils);
    openAndReadOutputWritingDates(path, utils, parameter);
+   formatter.prepareOutputFormatter(utils, parameter);
+   return true;
 }
 
 /**
@@ -41,51 +53,145 @@ void OUTPUT::prepareModelOutput(std::string path, UTILS utils, PARAMETER &parame
  * - Ending location: derived from latitude and longitude.
  * - Ending years: formatted as `__firstYear-01-01_lastYear-12-31`.
  * - Random seed: formatted as `__randomNumberGeneratorSeed`.
- * - Parameter ending: derived from the `plantTraitsFile`.
+ * - Scenario name: formatted as `__scenarioName` (only if set).
+ * - Parameter ending: derived from the `plantTraitsFile` (with the ending `.gmcol` for columnar output files).
  *
  * @param parameter Reference to the PARAMETER object that contains simulation
  *                  configurations, including geographical coordinates and
  *                  simulation years.
+ * The output buffers are written to the files as soon as they reach `outputBufferSize` (in kB),
+ * optionally by a background writer thread per file (`outputWriterThreadActivated`).
+ *
+ * If the run is resumed from a snapshot (`resumedFileSizes` set), the existing output files
+ * are continued at the sizes they had at the snapshot.
+ *
  * @param utils Utility functions for string manipulation and error handling.
+ * @return False if the output files of a resumed run are missing or shorter than at the snapshot.
  *
  * @throws std::ios_base::failure If the output file cannot be opened.
  */
-void OUTPUT::createAndOpenOutputFiles(PARAMETER parameter, UTILS utils)
+bool OUTPUT::createAndOpenOutputFiles(PARAMETER parameter, UTILS utils)
 {
-   utils.strings.clear();
-   utils.splitString(parameter.plantTraitsFile, '/');
-   std::string endingLocation = "lat" + parameter.latitude + "_lon" + parameter.longitude;
-   std::string endingYears = "__" + std::to_string(parameter.firstYear) + "-01-01_" + std::to_string(parameter.lastYear) + "-12-31";
-   std::string runNumber = (parameter.randomNumberGeneratorSeed < 10) ? ("00" + std::to_string(parameter.randomNumberGeneratorSeed)) : ((parameter.randomNumberGeneratorSeed < 100) ? ("0" + std::to_string(parameter.randomNumberGeneratorSeed)) : (std::to_string(parameter.randomNumberGeneratorSeed)));
-   std::string endingRandomSeed = "__run" + runNumber;
-   std::string plantTraitsFile = utils.strings.at(1);
-   utils.strings.clear();
-   utils.splitString(plantTraitsFile, '_');
-   std::string endingParameter = utils.strings.at(utils.strings.size() - 2) + "_" + utils.strings.at(utils.strings.size() - 1);
+   outputBufferSizeInBytes = static_cast<std::size_t>(std::max(parameter.outputBufferSize, 0)) * 1024;
+   columnarOutputActivated = (parameter.outputFormat == "columnar");
+   if (!columnarOutputActivated && parameter.outputFormat != "text" && parameter.outputFormat != "")
+   {
+      utils.handleWarning("The output format (outputFormat) has to be text or columnar. Text output files are written instead.");
+   }
+   selectionCommunity.setOutputSpecification(utils, "community", parameter.outputFieldsCommunity, parameter.outputCadenceCommunity);
+   selectionPFTPopulation.setOutputSpecification(utils, "PFT", parameter.outputFieldsPFT, parameter.outputCadencePFT);
+   selectionPlant.setOutputSpecification(utils, "plant", parameter.outputFieldsPlant, parameter.outputCadencePlant);
+   bufferCommunity.reserve(outputBufferSizeInBytes);
+   bufferPFTPopulation.reserve(outputBufferSizeInBytes);
+   bufferPlant.reserve(outputBufferSizeInBytes);
 
-   std::string filenameCommunity = outputDirectory + endingLocation + endingYears + endingRandomSeed + "__outputCommunity__" + endingParameter;
-   std::string filenamePFTPopulation = outputDirectory + endingLocation + endingYears + endingRandomSeed + "__outputPFT__" + endingParameter;
-   std::string filenamePlant = outputDirectory + endingLocation + endingYears + endingRandomSeed + "__outputPlant__" + endingParameter;
+   createOutputFileNames(parameter, utils);
+   const std::string &filenameCommunity = outputFileNames.at(0);
+   const std::string &filenamePFTPopulation = outputFileNames.at(1);
+   const std::string &filenamePlant = outputFileNames.at(2);
 
-   outputCommunity.open(filenameCommunity);
+   if (resumedFileSizes.size() == 3)
+   {
+      if (!outputCommunity.openForResume(filenameCommunity, parameter.outputWriterThreadActivated, resumedFileSizes[0]) ||
+          !outputPFTPopulation.openForResume(filenamePFTPopulation, parameter.outputWriterThreadActivated, resumedFileSizes[1]) ||
+          !outputPlant.openForResume(filenamePlant, parameter.outputWriterThreadActivated, resumedFileSizes[2]))
+      {
+         utils.handleError("The output files of the snapshot cannot be continued. They are missing or shorter than at the snapshot.");
+         return false;
+      }
+      return true;
+   }
+
+   outputCommunity.open(filenameCommunity, parameter.outputWriterThreadActivated);
    if (!outputCommunity.is_open())
    {
       utils.handleError("Error writing to the community output file.");
    }
 
-   outputPFTPopulation.open(filenamePFTPopulation);
+   outputPFTPopulation.open(filenamePFTPopulation, parameter.outputWriterThreadActivated);
    if (!outputPFTPopulation.is_open())
    {
       utils.handleError("Error writing to the PFT population output file.");
    }
 
-   outputPlant.open(filenamePlant);
+   outputPlant.open(filenamePlant, parameter.outputWriterThreadActivated);
    if (!outputPlant.is_open())
    {
       utils.handleError("Error writing to the plant / cohorte output file.");
    }
+   return true;
 };
 
+/**
+ * @brief Takes over the output settings that are read only once and shared by several runs.
+ *
+ * Replicates of an ensemble and the spin-up and branches of a fork write their own output files,
+ * but use the output writing dates read once into the shared output.
+ *
+ * @param sharedOutput Output holding the output writing dates read once for all runs.
+ * @param scenarioNameOfRun Name added to the output file names of the run (`scenarioName`).
+ */
+void OUTPUT::useSharedSettings(const OUTPUT &sharedOutput, const std::string &scenarioNameOfRun)
+{
+   scenarioName = scenarioNameOfRun;
+   outputWritingDates = sharedOutput.outputWritingDates;
+   outputWritingDays = sharedOutput.outputWritingDays;
+   outputWritingDatesFileOpened = sharedOutput.outputWritingDatesFileOpened;
+}
+
+/**
+ * @brief Derives the name of a management scenario from its management file.
+ *
+ * The name is the management scenario following `__management__` in the file name
+ * (e.g. `GER_Lange`), or the file name without ending otherwise.
+ *
+ * @param managementFile Name of the management file.
+ * @return Scenario name appended to the output file names (`scenarioName`) of fork branches and
+ *         of batch jobs overriding the management file.
+ */
+std::string OUTPUT::getScenarioName(const std::string &managementFile)
+{
+   std::string name = managementFile.substr(0, managementFile.find_last_of('.'));
+   std::size_t position = name.rfind("__management__");
+   if (position != std::string::npos)
+   {
+      name = name.substr(position + std::string("__management__").size());
+   }
+   return name;
+}
+
+/**
+ * @brief Constructs the names of the output files, of the snapshot file and of the profile report of the run.
+ *
+ * The names are derived from the location, the simulation years, the random number generator
+ * seed, the scenario name (if set, e.g. for branches of a spin-up fork) and the plant traits file.
+ *
+ * @param parameter Parameters of the simulation.
+ * @param utils Utility functions for string manipulation.
+ */
+void OUTPUT::createOutputFileNames(const PARAMETER &parameter, UTILS utils)
+{
+   utils.strings.clear();
+   utils.splitString(parameter.plantTraitsFile, '/');
+   std::string endingLocation = "lat" + parameter.latitude + "_lon" + parameter.longitude;
+   std::string endingYears = "__" + std::to_string(parameter.firstYear) + "-01-01_" + std::to_string(parameter.lastYear) + "-12-31";
+   std::string runNumber = (parameter.randomNumberGeneratorSeed < 10) ? ("00" + std::to_string(parameter.randomNumberGeneratorSeed)) : ((parameter.randomNumberGeneratorSeed < 100) ? ("0" + std::to_string(parameter.randomNumberGeneratorSeed)) : (std::to_string(parameter.randomNumberGeneratorSeed)));
+   std::string endingRandomSeed = "__run" + runNumber + ((scenarioName != "") ? ("__" + scenarioName) : "");
+   std::string plantTraitsFile = utils.strings.at(1);
+   utils.strings.clear();
+   utils.splitString(plantTraitsFile, '_');
+   std::string endingParameter = utils.strings.at(utils.strings.size() - 2) + "_" + utils.strings.at(utils.strings.size() - 1);
+   std::string endingOutput = (parameter.outputFormat == "columnar") ? (endingParameter.substr(0, endingParameter.find_last_of('.')) + ".gmcol") : endingParameter;
+
+   outputFileNames.clear();
+   outputFileNames.push_back(outputDirectory + endingLocation + endingYears + endingRandomSeed + "__outputCommunity__" + endingOutput);
+   outputFileNames.push_back(outputDirectory + endingLocation + endingYears + endingRandomSeed + "__outputPFT__" + endingOutput);
+   outputFileNames.push_back(outputDirectory + endingLocation + endingYears + endingRandomSeed + "__outputPlant__" + endingOutput);
+   checkpointFile = outputDirectory + endingLocation + endingYears + endingRandomSeed + "__checkpoint__" + endingParameter.substr(0, endingParameter.find_last_of('.')) + ".bin";
+   profileFile = outputDirectory + endingLocation + endingYears + endingRandomSeed + "__profile__" + endingParameter.substr(0, endingParameter.find_last_of('.')) + ".json";
+   memoryFile = outputDirectory + endingLocation + endingYears + endingRandomSeed + "__memory__" + endingParameter;
+}
+
 /**
  * @brief Writes the header to the output file.
  *
@@ -101,12 +207,38 @@ void OUTPUT::createAndOpenOutputFiles(PARAMETER parameter, UTILS utils)
  * The method checks if the output file is open before attempting to write.
  * If the file is not open, an error is logged and handled appropriately.
  *
+ * Only the selected fields of each output level are written (see `OUTPUTSELECTION`); `Date`, `DayCount`
+ * and `PFT` are always written. For columnar output files, the header lines define the columns. Output files of a resumed run
+ * (`resumedFileSizes` set) already contain the header, only the columns are set up.
+ *
  * @param utils Utility functions for error handling and other utilities.
  *
  * @throws std::ios_base::failure If the output file is not open.
  */
 void OUTPUT::writeHeaderInOutputFiles(UTILS utils)
 {
+   std::string headerCommunity;
+   headerCommunity += "Date\tDayCount\tNumberPlants\tLeafAreaIndex";
+   headerCommunity += "\tBiomassYield";
+   headerCommunity += "\n";
+
+   std::string headerPFTPopulation;
+   headerPFTPopulation += "Date\tDayCount\tPFT\tFraction\tNumberPlants\t";
+   headerPFTPopulation += "CoveredArea\tShootBiomass\tGreenShootBiomass\tBrownShootBiomass\t";
+   headerPFTPopulation += "ClippedShootBiomass\tRootBiomass\tRecruitmentBiomass\tExudationBiomass\t";
+   headerPFTPopulation += "GPP\tNPP\tRespiration";
+   headerPFTPopulation += "\tBiomassYield";
+   headerPFTPopulation += "\n";
+
+   std::string headerPlant;
+   headerPlant += "Date\tDayCount\tPFT\tAge\tNumberPlants\tHeight\tWidth\tLAI\t";
+   headerPlant += "CoveredArea\tRootDepth\tNumberSoilLayers\t";
+   headerPlant += "ShootBiomass\tGreenShootBiomass\tBrownShootBiomass\t";
+   headerPlant += "ClippedShootBiomass\tRootBiomass\tRecruitmentBiomass\tExudationBiomass\t";
+   headerPlant += "GPP\tNPP\tRespiration\t";
+   headerPlant += "Radiation\tShadingIndicator\tLimitingFactorWater\tLimitingFactorNitrogen\t";
+   headerPlant += "AllocationShoot\tAllocationRoot\tAllocationRecruitment\tAllocationExudation";
+   headerPlant += "\n";
 
    if (!outputCommunity.is_open())
    {
@@ -114,8 +246,7 @@ void OUTPUT::writeHeaderInOutputFiles(UTILS utils)
    }
    else
    {
-      outputCommunity << "Date\tDayCount\tNumberPlants\tLeafAreaIndex";
-      outputCommunity << std::endl;
+      writeHeaderInOutputFile(selectionCommunity.selectFieldsOfHeader(utils, headerCommunity, 2, 1, true), columnsCommunity, outputCommunity);
    }
 
    if (!outputPFTPopulation.is_open())
@@ -124,11 +255,7 @@ void OUTPUT::writeHeaderInOutputFiles(UTILS utils)
    }
    else
    {
-      outputPFTPopulation << "Date\tDayCount\tPFT\tFraction\tNumberPlants\t";
-      outputPFTPopulation << "CoveredArea\tShootBiomass\tGreenShootBiomass\tBrownShootBiomass\t";
-      outputPFTPopulation << "ClippedShootBiomass\tRootBiomass\tRecruitmentBiomass\tExudationBiomass\t";
-      outputPFTPopulation << "GPP\tNPP\tRespiration";
-      outputPFTPopulation << std::endl;
+      writeHeaderInOutputFile(selectionPFTPopulation.selectFieldsOfHeader(utils, headerPFTPopulation, 3, 1, true), columnsPFTPopulation, outputPFTPopulation);
    }
 
    if (!outputPlant.is_open())
@@ -137,17 +264,115 @@ void OUTPUT::writeHeaderInOutputFiles(UTILS utils)
    }
    else
    {
-      outputPlant << "Date\tDayCount\tPFT\tAge\tNumberPlants\tHeight\tWidth\tLAI\t";
-      outputPlant << "CoveredArea\tRootDepth\tNumberSoilLayers\t";
-      outputPlant << "ShootBiomass\tGreenShootBiomass\tBrownShootBiomass\t";
-      outputPlant << "ClippedShootBiomass\tRootBiomass\tRecruitmentBiomass\tExudationBiomass\t";
-      outputPlant << "GPP\tNPP\tRespiration\t";
-      outputPlant << "Radiation\tShadingIndicator\tLimitingFactorWater\tLimitingFactorNitrogen\t";
-      outputPlant << "AllocationShoot\tAllocationRoot\tAllocationRecruitment\tAllocationExudation";
-      outputPlant << std::endl;
+      writeHeaderInOutputFile(selectionPlant.selectFieldsOfHeader(utils, headerPlant, 3, 0, false), columnsPlant, outputPlant);
    }
 }
 
+/**
+ * @brief Returns the types of the columns of a columnar output file of an output level.
+ *
+ * The types mirror the C++ types of the values written for the columns of the headers in
+ * `writeHeaderInOutputFiles()` (see `STEP::saveSimulationResultsToBuffer()`), independent of
+ * the values of a particular run. Day counts and PFTs are `int32`; the numbers of plants of
+ * the community and of the cohorts and the number of soil layers are `int32` unless the file
+ * contains aggregated fields (statistics are always `float64`); all other columns are `float64`.
+ *
+ * @param level Output level (community, PFT or plant).
+ * @param columnNames Names of the columns (header without `Date`).
+ * @return Type of each column.
+ */
+std::vector<COLUMNTYPE> OUTPUT::getColumnTypesOfOutputFile(const std::string &level, const std::vector<std::string> &columnNames)
+{
+   /// files with aggregated fields write all non-key fields as statistics (see appendAggregatedRows())
+   bool aggregated = false;
+   for (const auto &name : columnNames)
+   {
+      for (OUTPUTSTATISTIC statistic : {OUTPUTSTATISTIC::mean, OUTPUTSTATISTIC::minimum, OUTPUTSTATISTIC::maximum, OUTPUTSTATISTIC::sum})
+      {
+         const std::string suffix = OUTPUTSELECTION::getStatisticName(statistic);
+         aggregated = aggregated || (name.size() > suffix.size() && name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0);
+      }
+   }
+
+   std::vector<COLUMNTYPE> columnTypes;
+   for (const auto &name : columnNames)
+   {
+      bool keyField = (name == "DayCount") || (name == "PFT" && level != "community");
+      bool integralField = !aggregated && ((level == "community" && name == "NumberPlants") ||
+                                           (level == "plant" && (name == "NumberPlants" || name == "NumberSoilLayers")));
+      columnTypes.push_back((keyField || integralField) ? COLUMNTYPE::int32 : COLUMNTYPE::float64);
+   }
+   return columnTypes;
+}
+
+/**
+ * @brief Writes the header line of a text output file or the file header of a columnar output file.
+ *
+ * The columns of a columnar output file are taken from the header line of the text output file.
+ * Output files of a resumed run already contain the header.
+ *
+ * @param header Header line of the text output file.
+ * @param columns Columns of the output level.
+ * @param writer Writer of the output file.
+ */
+void OUTPUT::writeHeaderInOutputFile(const std::string &header, COLUMNARBUFFER &columns, OUTPUTWRITER &writer)
+{
+   std::string fileHeader = header;
+   if (columnarOutputActivated)
+   {
+      columns.setColumnNames(header);
+      fileHeader.clear();
+      columns.appendFileHeader(fileHeader);
+   }
+   if (resumedFileSizes.empty())
+   {
+      writer.write(fileHeader);
+   }
+}
+
+/**
+ * @brief Writes the output buffers that reached the configured size to the output files.
+ *
+ * Called once per simulated day, so that the memory used by the buffers stays bounded
+ * by `outputBufferSizeInBytes` regardless of the length of the simulation. Buffers of
+ * output files that are not open (e.g. in benchmarks) are discarded.
+ */
+void OUTPUT::writeFullBuffersToOutputFiles()
+{
+   if (bufferCommunity.size() + columnsCommunity.size() >= outputBufferSizeInBytes)
+   {
+      moveBufferToOutputFile(bufferCommunity, columnsCommunity, outputCommunity);
+   }
+   if (bufferPFTPopulation.size() + columnsPFTPopulation.size() >= outputBufferSizeInBytes)
+   {
+      moveBufferToOutputFile(bufferPFTPopulation, columnsPFTPopulation, outputPFTPopulation);
+   }
+   if (bufferPlant.size() + columnsPlant.size() >= outputBufferSizeInBytes)
+   {
+      moveBufferToOutputFile(bufferPlant, columnsPlant, outputPlant);
+   }
+}
+
+/**
+ * @brief Hands the content of an output buffer over to its output file writer.
+ *
+ * The writer leaves an empty buffer with recycled capacity, so that the buffers are
+ * reused as byte arenas for the following results. For columnar output files, the
+ * current block of the columns is serialized into the buffer first.
+ *
+ * @param buffer Buffer of formatted simulation results.
+ * @param columns Columns of the output level (columnar output).
+ * @param writer Writer of the corresponding output file.
+ */
+void OUTPUT::moveBufferToOutputFile(std::string &buffer, COLUMNARBUFFER &columns, OUTPUTWRITER &writer)
+{
+   if (columnarOutputActivated)
+   {
+      columns.moveBlockToBuffer(buffer);
+   }
+   writer.write(buffer);
+}
+
 /**
  * @brief Writes daily simulation results to the output file.
  *
@@ -155,6 +380,7 @@ void OUTPUT::writeHeaderInOutputFiles(UTILS utils)
  * variables of the community, to the output file. The results are stored
  * in a temporary buffer and are written to the file if the file is open.
  * After writing, the buffer is cleared to prepare for the next set of results.
+ * Called at the end of the simulation to write the remaining content of the buffers.
  *
  * @param utils Utility functions for error handling and other utilities.
  *
@@ -162,11 +388,10 @@ void OUTPUT::writeHeaderInOutputFiles(UTILS utils)
  */
 void OUTPUT::writeSimulationResultsToOutputFiles(UTILS utils)
 {
+   TRACESCOPE traceScope("output_write_remaining_buffers");
    if (outputCommunity.is_open())
    {
-      outputCommunity << bufferCommunity.str();
-      bufferCommunity.str("");
-      bufferCommunity.clear();
+      moveBufferToOutputFile(bufferCommunity, columnsCommunity, outputCommunity);
    }
    else
    {
@@ -175,9 +400,7 @@ void OUTPUT::writeSimulationResultsToOutputFiles(UTILS utils)
 
    if (outputPFTPopulation.is_open())
    {
-      outputPFTPopulation << bufferPFTPopulation.str();
-      bufferPFTPopulation.str("");
-      bufferPFTPopulation.clear();
+      moveBufferToOutputFile(bufferPFTPopulation, columnsPFTPopulation, outputPFTPopulation);
    }
    else
    {
@@ -186,9 +409,7 @@ void OUTPUT::writeSimulationResultsToOutputFiles(UTILS utils)
 
    if (outputPlant.is_open())
    {
-      outputPlant << bufferPlant.str();
-      bufferPlant.str("");
-      bufferPlant.clear();
+      moveBufferToOutputFile(bufferPlant, columnsPlant, outputPlant);
    }
    else
    {
@@ -196,6 +417,103 @@ void OUTPUT::writeSimulationResultsToOutputFiles(UTILS utils)
    }
 }
 
+/**
+ * @brief Writes all buffered results and waits until they are written to the output files.
+ *
+ * Used for snapshots of the simulation state (see CHECKPOINT).
+ *
+ * @return Sizes of the community, PFT population and plant output files (in bytes).
+ */
+std::vector<std::uint64_t> OUTPUT::flushOutputFiles()
+{
+   moveBufferToOutputFile(bufferCommunity, columnsCommunity, outputCommunity);
+   moveBufferToOutputFile(bufferPFTPopulation, columnsPFTPopulation, outputPFTPopulation);
+   moveBufferToOutputFile(bufferPlant, columnsPlant, outputPlant);
+   return {outputCommunity.flush(), outputPFTPopulation.flush(), outputPlant.flush()};
+}
+
+/**
+ * @brief Checks if results of a day are written (every day without output writing dates file).
+ *
+ * @param day Day count.
+ */
+bool OUTPUT::isOutputWritingDate(int day) const
+{
+   if (!outputWritingDatesFileOpened)
+   {
+      return true;
+   }
+   return day >= 0 && day < static_cast<int>(outputWritingDays.size()) && outputWritingDays[day];
+}
+
+/**
+ * @brief Checks if the aggregated state variables of the community are needed on a day.
+ *
+ * They are needed if community or PFT results of the day are written, or every day if fields
+ * of the community or PFT level are aggregated (see `OUTPUTAGGREGATOR`). Plant results do not
+ * depend on them.
+ *
+ * @param day Day count.
+ */
+bool OUTPUT::isCommunityAggregationDay(int day) const
+{
+   if (selectionCommunity.aggregationActivated || selectionPFTPopulation.aggregationActivated)
+   {
+      return true;
+   }
+   return isOutputWritingDate(day) && (selectionCommunity.isOutputDay(day, formatter) || selectionPFTPopulation.isOutputDay(day, formatter));
+}
+
+/**
+ * @brief Appends the aggregated records of the current cadence period of an output level.
+ *
+ * One record is appended per row of the aggregator (one at community level, one per PFT at
+ * PFT level), with the key fields of the day closing the period followed by the statistics of
+ * the aggregated columns (see `OUTPUTSELECTION::aggregatedColumns`).
+ *
+ * @param buffer Text buffer of the output level.
+ * @param columns Columns of the output level.
+ * @param selection Selected fields and aggregated columns of the output level.
+ * @param aggregator Statistics of the output level.
+ * @param date Date of the day closing the cadence period (YYYY-MM-DD).
+ * @param day Day count of the day closing the cadence period.
+ * @param numberOfRows Rows of the output level.
+ */
+void OUTPUT::appendAggregatedRows(std::string &buffer, COLUMNARBUFFER &columns, const OUTPUTSELECTION &selection, const OUTPUTAGGREGATOR &aggregator, const std::string &date, int day, int numberOfRows)
+{
+   bool rowsHavePFT = selection.numberOfKeyFields > 2;
+   for (int row = 0; row < numberOfRows; row++)
+   {
+      if (columnarOutputActivated)
+      {
+         std::size_t column = 0;
+         columns.beginRow(date, day);
+         columns.appendValue(column++, static_cast<std::int32_t>(day));
+         if (rowsHavePFT)
+         {
+            columns.appendValue(column++, static_cast<std::int32_t>(row));
+         }
+         for (std::size_t aggregatedColumn = 0; aggregatedColumn < selection.aggregatedColumns.size(); aggregatedColumn++)
+         {
+            columns.appendValue(column++, aggregator.getStatistic(selection, row, aggregatedColumn));
+         }
+      }
+      else
+      {
+         formatter.appendFields(buffer, date, day);
+         if (rowsHavePFT)
+         {
+            formatter.appendFields(buffer, row);
+         }
+         for (std::size_t aggregatedColumn = 0; aggregatedColumn < selection.aggregatedColumns.size(); aggregatedColumn++)
+         {
+            formatter.appendFields(buffer, aggregator.getStatistic(selection, row, aggregatedColumn));
+         }
+         buffer.back() = '\n';
+      }
+   }
+}
+
 /**
  * @brief Closes the output file.
  *
@@ -210,6 +528,7 @@ void OUTPUT::writeSimulationResultsToOutputFiles(UTILS utils)
  */
 void OUTPUT::closeOutputFiles(UTILS utils)
 {
+   TRACESCOPE traceScope("output_close_files");
    if (outputCommunity.is_open())
    {
       outputCommunity.close();
@@ -272,7 +591,8 @@ void OUTPUT::createOutputFolder(std::string path, UTILS utils)
  * This method constructs the full path to the output writing dates file
  * using the specified path and the filename from the parameters. It opens
  * the file and reads the dates from it, storing them in the outputWritingDates
- * vector. The first line of the file is considered a header and is skipped.
+ * vector and in the day bitmap outputWritingDays. The first line of the file is
+ * considered a header and is skipped.
  * If the file cannot be opened, a warning is issued and daily resolution
  * will be used for writing simulation results.
  *
@@ -300,6 +620,7 @@ void OUTPUT::openAndReadOutputWritingDates(std::string path, UTILS utils, PARAME
    std::string line; // current line text in parser
    int m = 0;        // current line number in parser
    outputWritingDates.clear();
+   outputWritingDays.clear();
 
    outputWritingDatesFileOpened = false;
    if (file.is_open())
@@ -319,6 +640,16 @@ void OUTPUT::openAndReadOutputWritingDates(std::string path, UTILS utils, PARAME
          }
       }
       file.close();
+
+      /* day bitmap for the daily lookup (dates outside the simulation period are never reached) */
+      outputWritingDays.assign(parameter.simulationTimeInDays + 1, false);
+      for (auto day : outputWritingDates)
+      {
+         if (day >= 0 && day <= parameter.simulationTimeInDays)
+         {
+            outputWritingDays[day] = true;
+         }
+      }
    }
    else
    {
@@ -398,6 +729,16 @@ void OUTPUT::printSimulationSettingsToConsole(PARAMETER parameter, INPUT input)
       dates = "at dates provided in " + parameter.outputWritingDatesFile;
    }
    std::cout << "Simulation output is written: " << dates << std::endl;
+   if (parameter.outputFormat == "columnar")
+   {
+      std::cout << "Simulation output format: columnar (.gmcol)" << std::endl;
+   }
+   auto isDaily = [](const std::string &cadence)
+   { return cadence == "daily" || cadence == ""; };
+   if (!isDaily(parameter.outputCadenceCommunity) || !isDaily(parameter.outputCadencePFT) || !isDaily(parameter.outputCadencePlant))
+   {
+      std::cout << "Output cadence (community, PFT, plant): " << parameter.outputCadenceCommunity << ", " << parameter.outputCadencePFT << ", " << parameter.outputCadencePlant << std::endl;
+   }
    if (!outputWritingDatesFileOpened)
    {
       if (parameter.outputWritingDatesFile != "NaN" && parameter.outputWritingDatesFile != "")
@@ -3,9 +3,15 @@
 #include "../module_plant/community.h"
 #include "../module_input/input.h"
 #include "../utils/utils.h"
+#include "outputwriter.h"
+#include "outputformatter.h"
+#include "columnarbuffer.h"
+#include "outputselection.h"
+#include "outputaggregator.h"
 #include <iostream>
 #include <vector>
 #include <fstream>
+#include <algorithm>
 #include <direct.h>
 
 /**
@@ -23,24 +29,92 @@ public:
 
    std::string outputDirectory;           /// Directory where output files will be stored.
    std::string fileDirectory;             /// Directory of the outputWritingDates file.
-   std::ofstream outputCommunity;         /// Output file stream for writing data.
-   std::ofstream outputPFTPopulation;     /// Output file stream for writing data.
-   std::ofstream outputPlant;             /// Output file stream for writing data.
-   std::stringstream bufferCommunity;     /// Temporary storage buffer for output data at community level.
-   std::stringstream bufferPFTPopulation; /// Temporary storage buffer for output data at PFT level.
-   std::stringstream bufferPlant;         /// Temporary storage buffer for output data at cohort level.
-   std::stringstream bufferEnvironment;   /// Temporary storage buffer for output data at ecosystem level (environmental conditions).
+   OUTPUTWRITER outputCommunity;          /// Output file writer for writing data.
+   OUTPUTWRITER outputPFTPopulation;      /// Output file writer for writing data.
+   OUTPUTWRITER outputPlant;              /// Output file writer for writing data.
+   std::size_t outputBufferSizeInBytes;   /// Size of a buffer at which its content is written to the output file.
+   OUTPUTFORMATTER formatter;             /// Formatter appending simulation results to the buffers.
+   std::string bufferCommunity;           /// Temporary storage buffer for output data at community level.
+   std::string bufferPFTPopulation;       /// Temporary storage buffer for output data at PFT level.
+   std::string bufferPlant;               /// Temporary storage buffer for output data at cohort level.
+   std::string bufferEnvironment;         /// Temporary storage buffer for output data at ecosystem level (environmental conditions).
+   bool columnarOutputActivated;          /// Results are written as columnar binary files instead of text (outputFormat `columnar`).
+   COLUMNARBUFFER columnsCommunity;       /// Columns of the community level (columnar output).
+   COLUMNARBUFFER columnsPFTPopulation;   /// Columns of the PFT level (columnar output).
+   COLUMNARBUFFER columnsPlant;           /// Columns of the cohort level (columnar output).
+   OUTPUTSELECTION selectionCommunity;    /// Selected fields and cadence of the community level.
+   OUTPUTSELECTION selectionPFTPopulation; /// Selected fields and cadence of the PFT level.
+   OUTPUTSELECTION selectionPlant;        /// Selected fields and cadence of the cohort level.
+   OUTPUTAGGREGATOR aggregatorCommunity;  /// Statistics of the aggregated fields of the community level.
+   OUTPUTAGGREGATOR aggregatorPFTPopulation; /// Statistics of the aggregated fields of the PFT level.
 
    std::vector<int> outputWritingDates; /// Dates for writing output data.
+   std::vector<bool> outputWritingDays; /// Output writing dates as day bitmap (index = day count).
    bool outputWritingDatesFileOpened;   /// Flag indicating if the output writing dates file is opened.
 
-   void prepareModelOutput(std::string path, UTILS utils, PARAMETER &parameter);
+   std::string scenarioName;                    /// Name added to the output file names (e.g. management scenario of a branch).
+   std::vector<std::string> outputFileNames;   /// Names of the community, PFT population and plant output files.
+   std::string checkpointFile;                 /// Snapshot file of the run (see CHECKPOINT).
+   std::string profileFile;                    /// Runtime profile report of the run (see PROFILER).
+   std::string memoryFile;                     /// Samples of the memory footprint of the run (see MEMORYMONITOR).
+   std::vector<std::uint64_t> resumedFileSizes; /// Sizes of the output files at the snapshot a resumed run continues from.
+
+   bool prepareModelOutput(std::string path, UTILS utils, PARAMETER &parameter);
    void createOutputFolder(std::string path, UTILS utils);
    void openAndReadOutputWritingDates(std::string path, UTILS utils, PARAMETER &parameter);
+   void useSharedSettings(const OUTPUT &sharedOutput, const std::string &scenarioNameOfRun);
    void printSimulationSettingsToConsole(PARAMETER parameter, INPUT input);
 
-   void createAndOpenOutputFiles(PARAMETER parameter, UTILS utils);
+   void createOutputFileNames(const PARAMETER &parameter, UTILS utils);
+   static std::string getScenarioName(const std::string &managementFile);
+   bool createAndOpenOutputFiles(PARAMETER parameter, UTILS utils);
    void writeHeaderInOutputFiles(UTILS utils);
+   static std::vector<COLUMNTYPE> getColumnTypesOfOutputFile(const std::string &level, const std::vector<std::string> &columnNames);
+   void writeFullBuffersToOutputFiles();
    void writeSimulationResultsToOutputFiles(UTILS utils);
+   std::vector<std::uint64_t> flushOutputFiles();
+   bool isOutputWritingDate(int day) const;
+   bool isCommunityAggregationDay(int day) const;
+   void appendAggregatedRows(std::string &buffer, COLUMNARBUFFER &columns, const OUTPUTSELECTION &selection, const OUTPUTAGGREGATOR &aggregator, const std::string &date, int day, int numberOfRows);
    void closeOutputFiles(UTILS utils);
+
+   /**
+    * @brief Appends a row of simulation results to the text buffer or the columns of an output level.
+    *
+    * Only the selected fields of the output level are formatted.
+    *
+    * @param buffer Text buffer of the output level.
+    * @param columns Columns of the output level.
+    * @param selection Selected fields of the output level.
+    * @param date Date of the current day (YYYY-MM-DD).
+    * @param day Day count of the current day.
+    * @param values Values of the remaining columns.
+    */
+   template <typename... VALUES>
+   void appendRow(std::string &buffer, COLUMNARBUFFER &columns, const OUTPUTSELECTION &selection, const std::string &date, int day, const VALUES &...values)
+   {
+      if (columnarOutputActivated)
+      {
+         if (selection.allFieldsSelected)
+         {
+            columns.appendRow(date, day, values...);
+         }
+         else
+         {
+            columns.appendSelectedRow(selection.fieldIsSelected, date, day, values...);
+         }
+      }
+      else if (selection.allFieldsSelected)
+      {
+         formatter.appendRow(buffer, date, day, values...);
+      }
+      else
+      {
+         formatter.appendSelectedRow(buffer, selection.fieldIsSelected, date, day, values...);
+      }
+   }
+
+private:
+   void writeHeaderInOutputFile(const std::string &header, COLUMNARBUFFER &columns, OUTPUTWRITER &writer);
+   void moveBufferToOutputFile(std::string &buffer, COLUMNARBUFFER &columns, OUTPUTWRITER &writer);
 };
\ No newline at end of file
@@ -0,0 +1,89 @@
+#include "outputaggregator.h"
+#include <algorithm>
+
+OUTPUTAGGREGATOR::OUTPUTAGGREGATOR()
+{
+   numberOfDaysInWindow = 0;
+};
+OUTPUTAGGREGATOR::~OUTPUTAGGREGATOR() {};
+
+/**
+ * @brief Counts a new day of the current cadence period.
+ */
+void OUTPUTAGGREGATOR::beginDay()
+{
+   numberOfDaysInWindow++;
+}
+
+/**
+ * @brief Updates the statistics of one row with the values of the day.
+ *
+ * The statistics of a row are initialized with the values of the first day of the cadence period.
+ *
+ * @param selection Selected fields and aggregated columns of the output level.
+ * @param row Row of the output level.
+ * @param fieldValues Values of the columns after the key fields.
+ */
+void OUTPUTAGGREGATOR::accumulateFieldValues(const OUTPUTSELECTION &selection, int row, const double *fieldValues)
+{
+   std::size_t numberOfColumns = selection.aggregatedColumns.size();
+   std::size_t firstStatistic = row * numberOfColumns;
+   if (statistics.size() < firstStatistic + numberOfColumns)
+   {
+      statistics.resize(firstStatistic + numberOfColumns, 0.0);
+   }
+
+   for (std::size_t column = 0; column < numberOfColumns; column++)
+   {
+      const OUTPUTCOLUMN &aggregatedColumn = selection.aggregatedColumns[column];
+      double value = fieldValues[aggregatedColumn.field - selection.numberOfKeyFields];
+      double &statistic = statistics[firstStatistic + column];
+      if (numberOfDaysInWindow <= 1)
+      {
+         statistic = value;
+         continue;
+      }
+
+      switch (aggregatedColumn.statistic)
+      {
+      case OUTPUTSTATISTIC::mean:
+      case OUTPUTSTATISTIC::sum:
+         statistic += value;
+         break;
+      case OUTPUTSTATISTIC::minimum:
+         statistic = std::min(statistic, value);
+         break;
+      case OUTPUTSTATISTIC::maximum:
+         statistic = std::max(statistic, value);
+         break;
+      default:
+         statistic = value;
+         break;
+      }
+   }
+}
+
+/**
+ * @brief Returns the statistic of an aggregated column of a row over the current cadence period.
+ *
+ * @param selection Selected fields and aggregated columns of the output level.
+ * @param row Row of the output level.
+ * @param column Aggregated column.
+ */
+double OUTPUTAGGREGATOR::getStatistic(const OUTPUTSELECTION &selection, int row, std::size_t column) const
+{
+   double statistic = statistics[row * selection.aggregatedColumns.size() + column];
+   if (selection.aggregatedColumns[column].statistic == OUTPUTSTATISTIC::mean && numberOfDaysInWindow > 0)
+   {
+      statistic /= numberOfDaysInWindow;
+   }
+   return statistic;
+}
+
+/**
+ * @brief Starts a new cadence period (the statistics are reinitialized by the next day).
+ */
+void OUTPUTAGGREGATOR::startNewWindow()
+{
+   numberOfDaysInWindow = 0;
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "outputselection.h"
+#include <vector>
+
+/**
+ * @brief Online statistics of the aggregated fields of one output level.
+ *
+ * The `OUTPUTAGGREGATOR` class accumulates the daily values of the aggregated columns of an
+ * output level (see `OUTPUTSELECTION::aggregatedColumns`) for each row (one row at community
+ * level, one row per PFT at PFT level) over the days of the current cadence period. Only the
+ * running statistic of each column is stored, i.e. the mean is kept as the sum of the daily values
+ * and divided by the number of days of the period when the aggregated record is written. The
+ * statistics are exact with respect to the daily values of the unaggregated output.
+ */
+class OUTPUTAGGREGATOR
+{
+public:
+   OUTPUTAGGREGATOR();
+   ~OUTPUTAGGREGATOR();
+
+   std::vector<double> statistics; /// Running statistic of each row and aggregated column (row-major)
+   int numberOfDaysInWindow;       /// Days accumulated in the current cadence period
+
+   void beginDay();
+   double getStatistic(const OUTPUTSELECTION &selection, int row, std::size_t column) const;
+   void startNewWindow();
+
+   /**
+    * @brief Accumulates the values of one row of the day into the statistics.
+    *
+    * Must be called once per row after `beginDay()`.
+    *
+    * @param selection Selected fields and aggregated columns of the output level.
+    * @param row Row of the output level (0 at community level, PFT at PFT level).
+    * @param values Values of the columns after the key fields (in the order of the header).
+    */
+   template <typename... VALUES>
+   void accumulateRow(const OUTPUTSELECTION &selection, int row, const VALUES &...values)
+   {
+      const double fieldValues[] = {static_cast<double>(values)...};
+      accumulateFieldValues(selection, row, fieldValues);
+   }
+
+private:
+   void accumulateFieldValues(const OUTPUTSELECTION &selection, int row, const double *fieldValues);
+};
@@ -0,0 +1,57 @@
+#include "outputformatter.h"
+
+OUTPUTFORMATTER::OUTPUTFORMATTER()
+{
+   significantDigits = 6;
+};
+
+OUTPUTFORMATTER::~OUTPUTFORMATTER() {};
+
+/**
+ * @brief Sets the number of significant digits and builds the date table of the simulation.
+ *
+ * @param utils Utility functions for date calculations and warnings.
+ * @param parameter Parameters of the simulation (`outputSignificantDigits`, simulation period).
+ */
+void OUTPUTFORMATTER::prepareOutputFormatter(const UTILS &utils, const PARAMETER &parameter)
+{
+   significantDigits = parameter.outputSignificantDigits;
+   if (significantDigits < 1 || significantDigits > 17)
+   {
+      utils.handleWarning("The number of significant digits of the output (outputSignificantDigits) has to be between 1 and 17. 6 digits are used instead.");
+      significantDigits = 6;
+   }
+   buildDateTable(utils, parameter);
+}
+
+/**
+ * @brief Precomputes the date strings (YYYY-MM-DD) of all days of the simulation period.
+ *
+ * @param utils Utility functions for date calculations.
+ * @param parameter Parameters of the simulation (`simulationTimeInDays`, `referenceJulianDayStart`).
+ */
+void OUTPUTFORMATTER::buildDateTable(const UTILS &utils, const PARAMETER &parameter)
+{
+   dateOfDay.assign(parameter.simulationTimeInDays + 1, std::string());
+   for (int dayCount = 1; dayCount <= parameter.simulationTimeInDays; dayCount++)
+   {
+      int day = utils.calculateDateFromDayCount(utils, dayCount, parameter.referenceJulianDayStart, "day");
+      int month = utils.calculateDateFromDayCount(utils, dayCount, parameter.referenceJulianDayStart, "month");
+      int year = utils.calculateDateFromDayCount(utils, dayCount, parameter.referenceJulianDayStart, "year");
+
+      std::string sDay = (day < 10) ? ("0" + std::to_string(day)) : std::to_string(day);
+      std::string sMonth = (month < 10) ? ("0" + std::to_string(month)) : std::to_string(month);
+      dateOfDay[dayCount] = std::to_string(year) + "-" + sMonth + "-" + sDay;
+   }
+}
+
+/**
+ * @brief Returns the date string of a day count of the simulation.
+ *
+ * @param day Day count (1 = first day of the simulation).
+ * @return Date in the format YYYY-MM-DD.
+ */
+const std::string &OUTPUTFORMATTER::getDate(int day) const
+{
+   return dateOfDay.at(day);
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+#pragma once
+#include "../module_parameter/parameter.h"
+#include "../utils/utils.h"
+#include <string>
+#include <vector>
+#include <charconv>
+#include <type_traits>
+
+/**
+ * @brief Formats simulation results as tab-separated text without temporary strings.
+ *
+ * The `OUTPUTFORMATTER` class appends values directly to the output buffers of the `OUTPUT`
+ * class. Dates of all simulated days are precomputed once, numbers are written with
+ * `std::to_chars` and the buffers keep their capacity between writes, so that formatting
+ * daily output does not allocate memory.
+ *
+ * Floating point values are written with `significantDigits` significant digits in the
+ * same notation as `std::ostream` (`%g`), i.e. the default of 6 digits reproduces the
+ * former stream output.
+ */
+class OUTPUTFORMATTER
+{
+public:
+   OUTPUTFORMATTER();
+   ~OUTPUTFORMATTER();
+
+   int significantDigits;              /// Significant digits of floating point values in the output files.
+   std::vector<std::string> dateOfDay; /// Date (YYYY-MM-DD) of each day count of the simulation.
+
+   void prepareOutputFormatter(const UTILS &utils, const PARAMETER &parameter);
+   void buildDateTable(const UTILS &utils, const PARAMETER &parameter);
+   const std::string &getDate(int day) const;
+
+   /**
+    * @brief Appends a single value to a buffer.
+    *
+    * @param buffer Output buffer.
+    * @param value Floating point, integral or string value.
+    */
+   template <typename VALUE>
+   void appendValue(std::string &buffer, const VALUE &value) const
+   {
+      if constexpr (std::is_floating_point_v<VALUE> || std::is_integral_v<VALUE>)
+      {
+         char characters[32];
+         std::to_chars_result result;
+         if constexpr (std::is_floating_point_v<VALUE>)
+         {
+            result = std::to_chars(characters, characters + sizeof(characters), value, std::chars_format::general, significantDigits);
+         }
+         else
+         {
+            result = std::to_chars(characters, characters + sizeof(characters), value);
+         }
+         buffer.append(characters, result.ptr);
+      }
+      else
+      {
+         buffer.append(value);
+      }
+   }
+
+   /**
+    * @brief Appends values to a buffer, each followed by a tab.
+    *
+    * @param buffer Output buffer.
+    * @param values Values of the columns.
+    */
+   template <typename... VALUES>
+   void appendFields(std::string &buffer, const VALUES &...values) const
+   {
+      ((appendValue(buffer, values), buffer.push_back('\t')), ...);
+   }
+
+   /**
+    * @brief Appends a complete row of tab-separated values terminated by a newline.
+    *
+    * @param buffer Output buffer.
+    * @param values Values of the columns.
+    */
+   template <typename... VALUES>
+   void appendRow(std::string &buffer, const VALUES &...values) const
+   {
+      appendFields(buffer, values...);
+      buffer.back() = '\n';
+   }
+
+   /**
+    * @brief Appends a row of the selected values terminated by a newline (unselected values are not formatted).
+    *
+    * @param buffer Output buffer.
+    * @param fieldIsSelected Selection of each value (at least one value selected).
+    * @param values Values of the columns.
+    */
+   template <typename... VALUES>
+   void appendSelectedRow(std::string &buffer, const std::vector<bool> &fieldIsSelected, const VALUES &...values) const
+   {
+      std::size_t field = 0;
+      ((fieldIsSelected[field++] ? (appendValue(buffer, values), buffer.push_back('\t')) : void()), ...);
+      buffer.back() = '\n';
+   }
+};
\ No newline at end of file
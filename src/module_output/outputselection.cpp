@@ -0,0 +1,241 @@
+#include "outputselection.h"
+#include <algorithm>
+
+OUTPUTSELECTION::OUTPUTSELECTION()
+{
+   cadence = OUTPUTCADENCE::interval;
+   cadenceInterval = 1;
+   allFieldsSelected = true;
+   numberOfKeyFields = 2;
+   aggregationActivated = false;
+};
+OUTPUTSELECTION::~OUTPUTSELECTION() {};
+
+/**
+ * @brief Sets the requested fields and the cadence of the output level.
+ *
+ * Unknown cadences are reported and replaced by a daily cadence.
+ *
+ * @param utils Utility functions for warnings.
+ * @param level Name of the output level (community, PFT or plant).
+ * @param fields Requested fields (`all` or names of header columns).
+ * @param cadenceName Cadence (`daily`, `weekly`, `monthly`, `annual`, `none` or an interval in days).
+ */
+void OUTPUTSELECTION::setOutputSpecification(const UTILS &utils, const std::string &level, const std::vector<std::string> &fields, const std::string &cadenceName)
+{
+   levelName = level;
+   fieldNames = fields;
+   fieldIsSelected.clear();
+   allFieldsSelected = true;
+   aggregationActivated = false;
+   aggregatedColumns.clear();
+
+   cadence = OUTPUTCADENCE::interval;
+   cadenceInterval = 1;
+   if (cadenceName == "weekly")
+   {
+      cadenceInterval = 7;
+   }
+   else if (cadenceName == "monthly")
+   {
+      cadence = OUTPUTCADENCE::monthly;
+   }
+   else if (cadenceName == "annual")
+   {
+      cadence = OUTPUTCADENCE::annual;
+   }
+   else if (cadenceName == "none")
+   {
+      cadence = OUTPUTCADENCE::none;
+   }
+   else if (cadenceName != "daily" && cadenceName != "")
+   {
+      int interval = 0;
+      try
+      {
+         interval = std::stoi(cadenceName);
+      }
+      catch (const std::exception &)
+      {
+         interval = 0;
+      }
+      if (interval > 0)
+      {
+         cadenceInterval = interval;
+      }
+      else
+      {
+         utils.handleWarning("The output cadence " + cadenceName + " of the " + levelName + " level is unknown (daily, weekly, monthly, annual, none or days). Daily results are written instead.");
+      }
+   }
+}
+
+/**
+ * @brief Checks if results of the output level are written on a day.
+ *
+ * @param day Day count of the simulation.
+ * @param formatter Formatter with the dates of the simulation period.
+ */
+bool OUTPUTSELECTION::isOutputDay(int day, const OUTPUTFORMATTER &formatter) const
+{
+   switch (cadence)
+   {
+   case OUTPUTCADENCE::interval:
+      return day % cadenceInterval == 0;
+   case OUTPUTCADENCE::monthly:
+      return day + 1 >= static_cast<int>(formatter.dateOfDay.size()) || formatter.dateOfDay[day].compare(5, 2, formatter.dateOfDay[day + 1], 5, 2) != 0;
+   case OUTPUTCADENCE::annual:
+      return day + 1 >= static_cast<int>(formatter.dateOfDay.size()) || formatter.dateOfDay[day].compare(0, 4, formatter.dateOfDay[day + 1], 0, 4) != 0;
+   default:
+      return false;
+   }
+}
+
+
+/**
+ * @brief Selects the requested fields among the columns of a header line.
+ *
+ * Requested fields that are not a column of the header are reported and ignored. The written
+ * columns follow the order of the header (statistics of a field in the order value, mean, min, max, sum). If a requested field is followed by a statistic and
+ * aggregation is allowed, the columns of the aggregated records are set up (`aggregatedColumns`).
+ *
+ * @param utils Utility functions for warnings.
+ * @param header Tab-separated header line of the output file (ending with a newline).
+ * @param keyFields Number of leading columns that are always written (Date, DayCount, PFT).
+ * @param optionalFields Number of trailing columns only written if requested by name (not by `all`).
+ * @param aggregationAllowed Fields of the output level can be aggregated (community and PFT level).
+ * @return Header line of the written columns.
+ */
+std::string OUTPUTSELECTION::selectFieldsOfHeader(const UTILS &utils, const std::string &header, int keyFields, int optionalFields, bool aggregationAllowed)
+{
+   std::vector<std::string> columns;
+   std::size_t begin = 0;
+   std::size_t end = header.find_first_of("\t\n", begin);
+   while (end != std::string::npos)
+   {
+      columns.push_back(header.substr(begin, end - begin));
+      begin = end + 1;
+      end = header.find_first_of("\t\n", begin);
+   }
+   numberOfKeyFields = keyFields;
+
+   /* requested fields and statistics */
+   std::vector<OUTPUTCOLUMN> requests;
+   bool allRequested = fieldNames.empty();
+   for (const auto &fieldName : fieldNames)
+   {
+      std::string name = fieldName.substr(0, fieldName.find(':'));
+      OUTPUTSTATISTIC statistic = OUTPUTSTATISTIC::value;
+      if (name != fieldName && !getStatistic(fieldName.substr(name.size() + 1), statistic))
+      {
+         utils.handleWarning("The statistic of the output field " + fieldName + " is unknown (mean, min, max or sum). The field is ignored.");
+         continue;
+      }
+      if (statistic != OUTPUTSTATISTIC::value && !aggregationAllowed)
+      {
+         utils.handleWarning("Output fields of the " + levelName + " level cannot be aggregated. The value of " + name + " is written instead.");
+         statistic = OUTPUTSTATISTIC::value;
+      }
+
+      auto column = std::find(columns.begin(), columns.end(), name);
+      if (name == "all")
+      {
+         allRequested = true;
+      }
+      else if (column == columns.end())
+      {
+         utils.handleWarning("The output field " + name + " is not a column of the " + levelName + " output file and is ignored.");
+      }
+      else if (column - columns.begin() >= numberOfKeyFields)
+      {
+         requests.push_back({static_cast<std::size_t>(column - columns.begin()), statistic});
+      }
+   }
+   if (allRequested)
+   {
+      for (std::size_t column = numberOfKeyFields; column + optionalFields < columns.size(); column++)
+      {
+         requests.push_back({column, OUTPUTSTATISTIC::value});
+      }
+   }
+   std::sort(requests.begin(), requests.end(), [](const OUTPUTCOLUMN &first, const OUTPUTCOLUMN &second)
+             { return first.field < second.field || (first.field == second.field && first.statistic < second.statistic); });
+   auto duplicates = std::unique(requests.begin(), requests.end(), [](const OUTPUTCOLUMN &first, const OUTPUTCOLUMN &second)
+                                 { return first.field == second.field && first.statistic == second.statistic; });
+   requests.erase(duplicates, requests.end());
+
+   /* written columns */
+   aggregationActivated = std::any_of(requests.begin(), requests.end(), [](const OUTPUTCOLUMN &request)
+                                      { return request.statistic != OUTPUTSTATISTIC::value; });
+   aggregatedColumns.clear();
+   fieldIsSelected.assign(columns.size(), false);
+   std::string selectedHeader;
+   for (int column = 0; column < numberOfKeyFields; column++)
+   {
+      fieldIsSelected[column] = true;
+      selectedHeader += columns[column] + "\t";
+   }
+   for (const auto &request : requests)
+   {
+      fieldIsSelected[request.field] = true;
+      selectedHeader += columns[request.field] + getStatisticName(request.statistic) + "\t";
+      if (aggregationActivated)
+      {
+         aggregatedColumns.push_back(request);
+      }
+   }
+   selectedHeader.back() = '\n';
+
+   allFieldsSelected = !aggregationActivated && std::find(fieldIsSelected.begin(), fieldIsSelected.end(), false) == fieldIsSelected.end();
+   return selectedHeader;
+}
+
+/**
+ * @brief Converts the name of a statistic (mean, min, max, sum).
+ *
+ * @return False if the name is unknown.
+ */
+bool OUTPUTSELECTION::getStatistic(const std::string &statisticName, OUTPUTSTATISTIC &statistic)
+{
+   if (statisticName == "mean")
+   {
+      statistic = OUTPUTSTATISTIC::mean;
+   }
+   else if (statisticName == "min")
+   {
+      statistic = OUTPUTSTATISTIC::minimum;
+   }
+   else if (statisticName == "max")
+   {
+      statistic = OUTPUTSTATISTIC::maximum;
+   }
+   else if (statisticName == "sum")
+   {
+      statistic = OUTPUTSTATISTIC::sum;
+   }
+   else
+   {
+      return false;
+   }
+   return true;
+}
+
+/**
+ * @brief Returns the suffix of the column name of a statistic (empty for the value at the output day).
+ */
+std::string OUTPUTSELECTION::getStatisticName(OUTPUTSTATISTIC statistic)
+{
+   switch (statistic)
+   {
+   case OUTPUTSTATISTIC::mean:
+      return "_mean";
+   case OUTPUTSTATISTIC::minimum:
+      return "_min";
+   case OUTPUTSTATISTIC::maximum:
+      return "_max";
+   case OUTPUTSTATISTIC::sum:
+      return "_sum";
+   default:
+      return "";
+   }
+}
@@ -0,0 +1,79 @@
+#pragma once
+#include "../utils/utils.h"
+#include "outputformatter.h"
+#include <string>
+#include <vector>
+
+/**
+ * @brief Cadence of an output level.
+ */
+enum class OUTPUTCADENCE
+{
+   interval, /// Every `cadenceInterval`-th day (daily = 1, weekly = 7)
+   monthly,  /// Last day of each month
+   annual,   /// Last day of each year
+   none,     /// No results (output file with header only)
+};
+
+/**
+ * @brief Statistic of a field over the days between two output days of an output level.
+ */
+enum class OUTPUTSTATISTIC
+{
+   value,   /// Value at the output day
+   mean,    /// Mean of the daily values
+   minimum, /// Minimum of the daily values
+   maximum, /// Maximum of the daily values
+   sum,     /// Sum of the daily values
+};
+
+/**
+ * @brief Column of an output level with aggregated fields.
+ */
+struct OUTPUTCOLUMN
+{
+   std::size_t field;         /// Column of the field in the header of the output file
+   OUTPUTSTATISTIC statistic; /// Statistic of the field
+};
+
+/**
+ * @brief Selected fields and cadence of one output level (community, PFT or plant).
+ *
+ * The fields are given by the names of the header columns of the output file
+ * (outputFieldsCommunity, outputFieldsPFT and outputFieldsPlant of the configuration file, `all`
+ * for all fields except optional fields like `BiomassYield`). `Date` and `DayCount` and, at PFT
+ * and plant level, `PFT` are always written. Values of unselected fields are skipped before they are formatted.
+ *
+ * The cadence (outputCadenceCommunity, outputCadencePFT and outputCadencePlant) is `daily`,
+ * `weekly`, `monthly`, `annual`, `none` or an interval in days. If output writing dates are
+ * given (outputWritingDatesFile), results are only written at output writing dates matching the cadence.
+ *
+ * At community and PFT level, a field can be followed by a statistic (`:mean`, `:min`, `:max`
+ * or `:sum`, e.g. `LeafAreaIndex:max`). The statistics are then accumulated over all days of each
+ * cadence period (see `OUTPUTAGGREGATOR`) and only the aggregated records are written at the end of
+ * the period, with the columns named `<field>_<statistic>`.
+ */
+class OUTPUTSELECTION
+{
+public:
+   OUTPUTSELECTION();
+   ~OUTPUTSELECTION();
+
+   std::string levelName;                      /// Name of the output level in warnings
+   std::vector<std::string> fieldNames;        /// Requested fields (empty or `all` for all fields)
+   std::vector<bool> fieldIsSelected;          /// Selection of each column of the header
+   bool allFieldsSelected;                     /// No column is deselected (rows are formatted without checking the selection)
+   int numberOfKeyFields;                      /// Leading columns that are always written (Date, DayCount, PFT)
+   bool aggregationActivated;                  /// Fields are aggregated over the cadence periods
+   std::vector<OUTPUTCOLUMN> aggregatedColumns; /// Columns after the key fields (aggregation)
+   OUTPUTCADENCE cadence;                      /// Cadence of the output level
+   int cadenceInterval;                        /// Interval in days (`OUTPUTCADENCE::interval`)
+
+   void setOutputSpecification(const UTILS &utils, const std::string &level, const std::vector<std::string> &fields, const std::string &cadenceName);
+   std::string selectFieldsOfHeader(const UTILS &utils, const std::string &header, int keyFields, int optionalFields, bool aggregationAllowed);
+   bool isOutputDay(int day, const OUTPUTFORMATTER &formatter) const;
+   static std::string getStatisticName(OUTPUTSTATISTIC statistic);
+
+private:
+   static bool getStatistic(const std::string &statisticName, OUTPUTSTATISTIC &statistic);
+};
@@ -0,0 +1,219 @@
+#include "outputwriter.h"
+#include "../module_profile/trace.h"
+#include <filesystem>
+
+OUTPUTWRITER::OUTPUTWRITER()
+{
+   backgroundWriterActivated = false;
+   bytesSubmitted = 0;
+   stopRequested = false;
+   chunkInProgress = false;
+};
+
+OUTPUTWRITER::~OUTPUTWRITER()
+{
+   close();
+};
+
+/**
+ * @brief Opens the output file and starts the writer thread if requested.
+ *
+ * @param filename Name of the output file.
+ * @param backgroundWriterActivated If true, chunks are written by a background thread.
+ * @return True if the file could be opened.
+ */
+bool OUTPUTWRITER::open(const std::string &filename, bool backgroundWriterActivated)
+{
+   close();
+
+   file.open(filename, std::ios::binary);
+   bytesSubmitted = 0;
+   startWriting(backgroundWriterActivated);
+   return file.is_open();
+}
+
+/**
+ * @brief Opens an existing output file to continue it after the given size (resumed run).
+ *
+ * Content written after the size (e.g. after the last checkpoint of a preempted run) is removed.
+ *
+ * @param filename Name of the output file.
+ * @param backgroundWriterActivated If true, chunks are written by a background thread.
+ * @param fileSize Size of the file at the checkpoint (in bytes).
+ * @return False if the file cannot be opened or is shorter than the given size.
+ */
+bool OUTPUTWRITER::openForResume(const std::string &filename, bool backgroundWriterActivated, std::uint64_t fileSize)
+{
+   close();
+
+   std::error_code error;
+   if (std::filesystem::file_size(filename, error) < fileSize || error)
+   {
+      return false;
+   }
+   std::filesystem::resize_file(filename, fileSize, error);
+   if (error)
+   {
+      return false;
+   }
+
+   file.open(filename, std::ios::binary | std::ios::app);
+   bytesSubmitted = fileSize;
+   startWriting(backgroundWriterActivated);
+   return file.is_open();
+}
+
+/**
+ * @brief Starts the writer thread if requested and the file is open.
+ */
+void OUTPUTWRITER::startWriting(bool backgroundWriterActivated)
+{
+   this->backgroundWriterActivated = backgroundWriterActivated;
+   stopRequested = false;
+   chunkInProgress = false;
+
+   if (file.is_open() && backgroundWriterActivated)
+   {
+      writerThread = std::thread(&OUTPUTWRITER::runBackgroundWriter, this);
+   }
+}
+
+bool OUTPUTWRITER::is_open() const
+{
+   return file.is_open();
+}
+
+/**
+ * @brief Writes a chunk of output to the file and leaves an empty (recycled) buffer in `chunk`.
+ *
+ * With the background writer, the chunk is moved to the queue of pending chunks and written
+ * later in the order of submission. If the queue is full, the call waits for the writer thread.
+ *
+ * @param chunk Buffer of formatted output. Its content is taken over by the writer.
+ */
+void OUTPUTWRITER::write(std::string &chunk)
+{
+   if (!file.is_open() || chunk.empty())
+   {
+      chunk.clear();
+      return;
+   }
+   bytesSubmitted += chunk.size();
+
+   if (!backgroundWriterActivated)
+   {
+      TRACESCOPE traceScope("output_write_chunk");
+      file.write(chunk.data(), chunk.size());
+      chunk.clear();
+      return;
+   }
+
+   std::unique_lock<std::mutex> lock(chunkMutex);
+   if (pendingChunks.size() >= maximumPendingChunks)
+   {
+      TRACESCOPE traceScope("output_wait_for_writer");
+      chunkCondition.wait(lock, [this]
+                          { return pendingChunks.size() < maximumPendingChunks; });
+   }
+   pendingChunks.push_back(std::move(chunk));
+
+   /// continue with a recycled buffer (keeps its capacity) instead of allocating a new one
+   if (!recycledChunks.empty())
+   {
+      chunk = std::move(recycledChunks.back());
+      recycledChunks.pop_back();
+   }
+   else
+   {
+      chunk = std::string();
+   }
+   chunk.clear();
+   lock.unlock();
+   chunkCondition.notify_all();
+}
+
+/**
+ * @brief Waits until all submitted chunks are written and flushes the file.
+ *
+ * The size is taken from the position of the file after flushing, so that a snapshot records
+ * the size of the file on disk at which a resumed run continues.
+ *
+ * @return Size of the file (in bytes).
+ */
+std::uint64_t OUTPUTWRITER::flush()
+{
+   if (writerThread.joinable())
+   {
+      TRACESCOPE traceScope("output_wait_for_writer");
+      std::unique_lock<std::mutex> lock(chunkMutex);
+      chunkCondition.wait(lock, [this]
+                          { return pendingChunks.empty() && !chunkInProgress; });
+   }
+   if (file.is_open())
+   {
+      file.flush();
+      std::streamoff filePosition = file.tellp();
+      if (filePosition >= 0)
+      {
+         return static_cast<std::uint64_t>(filePosition);
+      }
+   }
+   return bytesSubmitted;
+}
+
+/**
+ * @brief Writes all pending chunks, stops the writer thread and closes the file.
+ */
+void OUTPUTWRITER::close()
+{
+   if (writerThread.joinable())
+   {
+      {
+         std::lock_guard<std::mutex> lock(chunkMutex);
+         stopRequested = true;
+      }
+      chunkCondition.notify_all();
+      writerThread.join();
+   }
+   recycledChunks.clear();
+
+   if (file.is_open())
+   {
+      file.close();
+   }
+}
+
+/**
+ * @brief Main loop of the writer thread: writes pending chunks in order until stopping is requested.
+ */
+void OUTPUTWRITER::runBackgroundWriter()
+{
+   TRACE::setThreadName("output writer");
+   std::unique_lock<std::mutex> lock(chunkMutex);
+   while (true)
+   {
+      chunkCondition.wait(lock, [this]
+                          { return !pendingChunks.empty() || stopRequested; });
+      if (pendingChunks.empty())
+      {
+         return; // stop requested and all chunks are written
+      }
+
+      std::string chunk = std::move(pendingChunks.front());
+      pendingChunks.pop_front();
+      chunkInProgress = true;
+      lock.unlock();
+      chunkCondition.notify_all();
+
+      {
+         TRACESCOPE traceScope("output_write_chunk");
+         file.write(chunk.data(), chunk.size());
+      }
+      chunk.clear();
+
+      lock.lock();
+      recycledChunks.push_back(std::move(chunk));
+      chunkInProgress = false;
+      chunkCondition.notify_all();
+   }
+}
\ No newline at end of file
@@ -0,0 +1,58 @@
+#pragma once
+#include <cstdint>
+#include <string>
+#include <vector>
+#include <deque>
+#include <fstream>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+/**
+ * @brief Writes chunks of formatted simulation results to one output file.
+ *
+ * The `OUTPUTWRITER` class takes over filled output buffers during the simulation, so that
+ * the memory used by the output stays bounded by the configured buffer size instead of
+ * growing with the simulation length. Chunks are either written directly or, if the
+ * background thread is activated, handed over to a writer thread so that file I/O overlaps
+ * with the simulation. At most `maximumPendingChunks` chunks wait for the writer thread;
+ * the simulation waits if the writer thread falls behind.
+ *
+ * Emptied chunk buffers are recycled, so that the capacity of the buffers is allocated only once.
+ *
+ * Files are written in binary mode, so that the bytes of columnar output files are not changed
+ * by a newline translation (Windows) and text output files have the same line endings on all platforms.
+ *
+ * For checkpoints, `flush()` waits until all chunks are written and returns the size of the file,
+ * and `openForResume()` continues a file at such a size.
+ */
+class OUTPUTWRITER
+{
+public:
+   OUTPUTWRITER();
+   ~OUTPUTWRITER();
+
+   bool open(const std::string &filename, bool backgroundWriterActivated);
+   bool openForResume(const std::string &filename, bool backgroundWriterActivated, std::uint64_t fileSize);
+   bool is_open() const;
+   void write(std::string &chunk);
+   std::uint64_t flush();
+   void close();
+
+private:
+   std::ofstream file;             /// Output file
+   bool backgroundWriterActivated; /// Chunks are written by the writer thread
+   std::uint64_t bytesSubmitted;   /// Size of the file after all submitted chunks are written
+
+   std::thread writerThread;                    /// Background thread writing the pending chunks
+   std::mutex chunkMutex;                       /// Guards the chunk queues and the stop flag
+   std::condition_variable chunkCondition;      /// Signals new chunks, free queue slots and stopping
+   std::deque<std::string> pendingChunks;       /// Chunks waiting to be written (in order)
+   std::vector<std::string> recycledChunks;     /// Written chunk buffers to be reused
+   bool stopRequested;                          /// Writer thread shall stop after all pending chunks are written
+   bool chunkInProgress;                        /// Writer thread is writing a chunk taken from the queue
+   const std::size_t maximumPendingChunks = 2;  /// Upper limit of chunks waiting for the writer thread
+
+   void startWriting(bool backgroundWriterActivated);
+   void runBackgroundWriter();
+};
\ No newline at end of file
@@ -25,13 +25,7 @@ public:
    int simulationTimeInDays;    /// Total time of the simulation in days.
 
    // **** parameters of the configuration file **** //
-   /// Names of configuration parameters.
-   std::vector<std::string> configParameterNames =
-       {"deimsID", "latitude", "longitude", "lastYear", "firstYear",
-        "weatherFile", "soilFile", "managementFile", "plantTraitsFile",
-        "outputFile", "outputWritingDatesFile", "clippingHeightOfBiomassMeasurement",
-        "randomNumberGeneratorSeed"};
-
+   /// Keywords of the configuration parameters are listed in PARAMETERREGISTRY (registry.h).
    std::string deimsID;
    std::string latitude;
    std::string longitude;
@@ -45,20 +39,26 @@ public:
    std::string outputWritingDatesFile;
    double clippingHeightOfBiomassMeasurement;
    unsigned int randomNumberGeneratorSeed;
+   int outputBufferSize;                /// Size of each output buffer (in kB) at which results are written to the file (0 = daily).
+   bool outputWriterThreadActivated;    /// Output buffers are written to the files by a background thread.
+   int outputSignificantDigits;         /// Significant digits of floating point values in the output files.
+   std::string outputFormat;            /// Format of the output files (text or columnar).
+   std::vector<std::string> outputFieldsCommunity; /// Fields of the community output (all or header columns).
+   std::vector<std::string> outputFieldsPFT;       /// Fields of the PFT output (all or header columns).
+   std::vector<std::string> outputFieldsPlant;     /// Fields of the plant output (all or header columns).
+   std::string outputCadenceCommunity;  /// Cadence of the community output (daily, weekly, monthly, annual, none or days).
+   std::string outputCadencePFT;        /// Cadence of the PFT output (daily, weekly, monthly, annual, none or days).
+   std::string outputCadencePlant;      /// Cadence of the plant output (daily, weekly, monthly, annual, none or days).
+   int checkpointInterval;              /// Interval (in days) of snapshots of the simulation state (0 = no snapshots).
+   int memorySamplingInterval;          /// Interval (in days) of samples of the memory footprint (0 = no samples).
+   bool cohortFusionActivated;          /// Fusion of similar plant cohorts of the same PFT.
+   int cohortFusionAgeTolerance;        /// Maximum age difference of fused cohorts (in days).
+   double cohortFusionHeightTolerance;  /// Maximum relative height difference of fused cohorts.
+   double cohortFusionBiomassTolerance; /// Maximum relative plant biomass difference of fused cohorts.
+   int maximumNumberOfCohorts;          /// Upper limit of the number of cohorts (0 = unlimited).
 
    // **** parameters of the plant traits file **** //
-   // vector needed to have names as string-keywords for searching parameters in plant traits file
-   std::vector<std::string> plantTraitsParameterNames =
-       {"pftCount", "maximumPlantHeight", "plantHeightToWidthRatio", "plantShootCorrectionFactor", "plantShootRootRatio",
-        "plantRootDepthParamIntercept", "plantRootDepthParamExponent", "plantSpecificLeafArea", "plantShootOverlapFactors",
-        "crowdingMortalityActivated", "brownBiomassFractionFalling", "rootLifeSpan", "leafLifeSpan", "plantLifeSpan", "plantMortalityProbability",
-        "seedlingMortalityProbability", "seedGerminationTimes", "seedGerminationRates",
-        "seedsFromMaturePlantsActivated", "seedMasses", "maturityAges", "maturityHeights", "externalSeedInfluxActivated", "externalSeedInfluxNumber", "dayOfExternalSeedInfluxStart",
-        "maximumGrossLeafPhotosynthesisRate", "initialSlopeOfLightResponseCurve", "lightExtinctionCoefficients", "growthRespirationFraction",
-        "maintenanceRespirationRate", "plantNppAllocationGrowth", "plantNppAllocationExudation", "useStaticShootRootAllocationRates", "plantCNRatioGreenLeaves", "plantCNRatioBrownLeaves", "plantCNRatioRoots", "plantCNRatioSeeds", "plantCNRatioExudates", "nitrogenFixationAbility",
-        "plantCostRhizobiaSymbiosis", "plantWaterUseEfficiency", "plantMinimalSoilWaterForGppReduction", "plantMaximalSoilWaterForGppReduction",
-        "plantResponseToTemperatureQ10Base", "plantResponseToTemperatureQ10Reference"};
-
+   /// Keywords of the plant trait parameters are listed in PARAMETERREGISTRY (registry.h).
    int pftCount;
    std::vector<double> maximumPlantHeight;
    std::vector<double> plantHeightToWidthRatio;
@@ -0,0 +1,86 @@
+#include "registry.h"
+
+PARAMETERREGISTRY::PARAMETERREGISTRY()
+{
+   /* parameters with a default value (third element) are optional */
+   configParameterFields = {
+       {"deimsID", &PARAMETER::deimsID},
+       {"latitude", &PARAMETER::latitude},
+       {"longitude", &PARAMETER::longitude},
+       {"lastYear", &PARAMETER::lastYear},
+       {"firstYear", &PARAMETER::firstYear},
+       {"weatherFile", &PARAMETER::weatherFile},
+       {"soilFile", &PARAMETER::soilFile},
+       {"managementFile", &PARAMETER::managementFile},
+       {"plantTraitsFile", &PARAMETER::plantTraitsFile},
+       {"outputFile", &PARAMETER::outputFile},
+       {"outputWritingDatesFile", &PARAMETER::outputWritingDatesFile},
+       {"clippingHeightOfBiomassMeasurement", &PARAMETER::clippingHeightOfBiomassMeasurement},
+       {"randomNumberGeneratorSeed", &PARAMETER::randomNumberGeneratorSeed},
+       {"outputBufferSize", &PARAMETER::outputBufferSize, 1024},
+       {"outputWriterThreadActivated", &PARAMETER::outputWriterThreadActivated, false},
+       {"outputSignificantDigits", &PARAMETER::outputSignificantDigits, 6},
+       {"outputFormat", &PARAMETER::outputFormat, std::string("text")},
+       {"outputFieldsCommunity", &PARAMETER::outputFieldsCommunity, std::vector<std::string>{"all"}},
+       {"outputFieldsPFT", &PARAMETER::outputFieldsPFT, std::vector<std::string>{"all"}},
+       {"outputFieldsPlant", &PARAMETER::outputFieldsPlant, std::vector<std::string>{"all"}},
+       {"outputCadenceCommunity", &PARAMETER::outputCadenceCommunity, std::string("daily")},
+       {"outputCadencePFT", &PARAMETER::outputCadencePFT, std::string("daily")},
+       {"outputCadencePlant", &PARAMETER::outputCadencePlant, std::string("daily")},
+       {"checkpointInterval", &PARAMETER::checkpointInterval, 0},
+       {"memorySamplingInterval", &PARAMETER::memorySamplingInterval, 0},
+       {"cohortFusionActivated", &PARAMETER::cohortFusionActivated, false},
+       {"cohortFusionAgeTolerance", &PARAMETER::cohortFusionAgeTolerance, 7},
+       {"cohortFusionHeightTolerance", &PARAMETER::cohortFusionHeightTolerance, 0.05},
+       {"cohortFusionBiomassTolerance", &PARAMETER::cohortFusionBiomassTolerance, 0.05},
+       {"maximumNumberOfCohorts", &PARAMETER::maximumNumberOfCohorts, 0}};
+
+   plantTraitsParameterFields = {
+       {"pftCount", &PARAMETER::pftCount},
+       {"maximumPlantHeight", &PARAMETER::maximumPlantHeight},
+       {"plantHeightToWidthRatio", &PARAMETER::plantHeightToWidthRatio},
+       {"plantShootCorrectionFactor", &PARAMETER::plantShootCorrectionFactor},
+       {"plantShootRootRatio", &PARAMETER::plantShootRootRatio},
+       {"plantRootDepthParamIntercept", &PARAMETER::plantRootDepthParamIntercept},
+       {"plantRootDepthParamExponent", &PARAMETER::plantRootDepthParamExponent},
+       {"plantSpecificLeafArea", &PARAMETER::plantSpecificLeafArea},
+       {"plantShootOverlapFactors", &PARAMETER::plantShootOverlapFactors},
+       {"crowdingMortalityActivated", &PARAMETER::crowdingMortalityActivated},
+       {"brownBiomassFractionFalling", &PARAMETER::brownBiomassFractionFalling},
+       {"rootLifeSpan", &PARAMETER::rootLifeSpan},
+       {"leafLifeSpan", &PARAMETER::leafLifeSpan},
+       {"plantLifeSpan", &PARAMETER::plantLifeSpan},
+       {"plantMortalityProbability", &PARAMETER::plantMortalityProbability},
+       {"seedlingMortalityProbability", &PARAMETER::seedlingMortalityProbability},
+       {"seedGerminationTimes", &PARAMETER::seedGerminationTimes},
+       {"seedGerminationRates", &PARAMETER::seedGerminationRates},
+       {"seedsFromMaturePlantsActivated", &PARAMETER::seedsFromMaturePlantsActivated},
+       {"seedMasses", &PARAMETER::seedMasses},
+       {"maturityAges", &PARAMETER::maturityAges},
+       {"maturityHeights", &PARAMETER::maturityHeights},
+       {"externalSeedInfluxActivated", &PARAMETER::externalSeedInfluxActivated},
+       {"externalSeedInfluxNumber", &PARAMETER::externalSeedInfluxNumber},
+       {"dayOfExternalSeedInfluxStart", &PARAMETER::dayOfExternalSeedInfluxStart},
+       {"maximumGrossLeafPhotosynthesisRate", &PARAMETER::maximumGrossLeafPhotosynthesisRate},
+       {"initialSlopeOfLightResponseCurve", &PARAMETER::initialSlopeOfLightResponseCurve},
+       {"lightExtinctionCoefficients", &PARAMETER::lightExtinctionCoefficients},
+       {"growthRespirationFraction", &PARAMETER::growthRespirationFraction},
+       {"maintenanceRespirationRate", &PARAMETER::maintenanceRespirationRate},
+       {"plantNppAllocationGrowth", &PARAMETER::plantNppAllocationGrowth},
+       {"plantNppAllocationExudation", &PARAMETER::plantNppAllocationExudation},
+       {"useStaticShootRootAllocationRates", &PARAMETER::useStaticShootRootAllocationRates},
+       {"plantCNRatioGreenLeaves", &PARAMETER::plantCNRatioGreenLeaves},
+       {"plantCNRatioBrownLeaves", &PARAMETER::plantCNRatioBrownLeaves},
+       {"plantCNRatioRoots", &PARAMETER::plantCNRatioRoots},
+       {"plantCNRatioSeeds", &PARAMETER::plantCNRatioSeeds},
+       {"plantCNRatioExudates", &PARAMETER::plantCNRatioExudates},
+       {"nitrogenFixationAbility", &PARAMETER::nitrogenFixationAbility},
+       {"plantCostRhizobiaSymbiosis", &PARAMETER::plantCostRhizobiaSymbiosis},
+       {"plantWaterUseEfficiency", &PARAMETER::plantWaterUseEfficiency},
+       {"plantMinimalSoilWaterForGppReduction", &PARAMETER::plantMinimalSoilWaterForGppReduction},
+       {"plantMaximalSoilWaterForGppReduction", &PARAMETER::plantMaximalSoilWaterForGppReduction},
+       {"plantResponseToTemperatureQ10Base", &PARAMETER::plantResponseToTemperatureQ10Base},
+       {"plantResponseToTemperatureQ10Reference", &PARAMETER::plantResponseToTemperatureQ10Reference}};
+};
+
+PARAMETERREGISTRY::~PARAMETERREGISTRY() {};
\ No newline at end of file
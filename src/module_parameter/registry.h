@@ -0,0 +1,49 @@
+#pragma once
+#include "parameter.h"
+#include <string>
+#include <variant>
+#include <vector>
+
+/**
+ * @brief Member of the `PARAMETER` class whose value is read from an input file.
+ */
+using PARAMETERMEMBER = std::variant<int PARAMETER::*, unsigned int PARAMETER::*, bool PARAMETER::*, double PARAMETER::*, std::string PARAMETER::*,
+                                     std::vector<int> PARAMETER::*, std::vector<bool> PARAMETER::*, std::vector<double> PARAMETER::*, std::vector<std::string> PARAMETER::*>;
+
+/**
+ * @brief Default value of an optional parameter (of the type of its `PARAMETER` member); `std::monostate` for required parameters.
+ */
+using PARAMETERDEFAULT = std::variant<std::monostate, int, unsigned int, bool, double, std::string,
+                                      std::vector<int>, std::vector<bool>, std::vector<double>, std::vector<std::string>>;
+
+/**
+ * @brief Keyword of a parameter in an input file and the `PARAMETER` member it is assigned to.
+ */
+struct PARAMETERFIELD
+{
+   std::string name;                                 /// Keyword of the parameter in the input file
+   PARAMETERMEMBER member;                           /// Member of the `PARAMETER` class receiving the value
+   PARAMETERDEFAULT defaultValue = std::monostate(); /// Value of an optional parameter missing in the input file (none for required parameters)
+};
+
+/**
+ * @brief Typed registry of all parameters of the configuration and plant traits files.
+ *
+ * The `PARAMETERREGISTRY` class lists the keywords expected in the input files together with
+ * the `PARAMETER` members they are assigned to. The member type determines which datatypes
+ * of the input file are accepted (see `INPUT::assignParameterValue()`), so that no intermediate
+ * maps from parameter names to values are needed. A new parameter only has to be added to
+ * the `PARAMETER` class and to one of the lists in the constructor.
+ *
+ * Parameters with a default value are optional: if they are missing in the input file, the
+ * default value is used without error, so that existing input files remain valid.
+ */
+class PARAMETERREGISTRY
+{
+public:
+   PARAMETERREGISTRY();
+   ~PARAMETERREGISTRY();
+
+   std::vector<PARAMETERFIELD> configParameterFields;      /// Parameters of the configuration file
+   std::vector<PARAMETERFIELD> plantTraitsParameterFields; /// Parameters of the plant traits file (arrays with one value per PFT)
+};
\ No newline at end of file
@@ -11,7 +11,7 @@ ALLOMETRY::~ALLOMETRY() {};
  * @param sla The specific leaf area (in square cm per g).
  * @return The calculated Leaf Area Index (LAI).
  */
-double ALLOMETRY::laiFromShootBiomassAreaSla(UTILS utils, double shootBiomass, double area, double sla)
+double ALLOMETRY::laiFromShootBiomassAreaSla(const UTILS &utils, double shootBiomass, double area, double sla) const
 {
    if (area <= 0.0)
    {
@@ -26,7 +26,7 @@ double ALLOMETRY::laiFromShootBiomassAreaSla(UTILS utils, double shootBiomass, d
  * @param width The diameter (or width) of the plant (in cm).
  * @return The calculated ground area (in square cm).
  */
-double ALLOMETRY::areaFromWidth(double width)
+double ALLOMETRY::areaFromWidth(double width) const
 {
    return ((PI / 4.0) * width * width);
 }
@@ -42,7 +42,7 @@ double ALLOMETRY::areaFromWidth(double width)
  * @param form The shoot form factor, which represents how much biomass is contained in the cylindric shape of the plant (g per cubic cm).
  * @return The calculated height of the plant (in cm).
  */
-double ALLOMETRY::heightFromShootBiomassWidthShootCorrection(UTILS utils, double shootBiomass, double width, double shootCorrectionFactor)
+double ALLOMETRY::heightFromShootBiomassWidthShootCorrection(const UTILS &utils, double shootBiomass, double width, double shootCorrectionFactor) const
 {
    if (width <= 0.0 || shootCorrectionFactor <= 0.0)
    {
@@ -61,7 +61,7 @@ double ALLOMETRY::heightFromShootBiomassWidthShootCorrection(UTILS utils, double
  * @param hwr The height-width ratio of the plant (in cm per cm).
  * @return The calculated height of the plant (in cm).
  */
-double ALLOMETRY::heightFromWidthByRatio(double width, double heightWidthRatio)
+double ALLOMETRY::heightFromWidthByRatio(double width, double heightWidthRatio) const
 {
    return (width * heightWidthRatio);
 }
@@ -76,7 +76,7 @@ double ALLOMETRY::heightFromWidthByRatio(double width, double heightWidthRatio)
  * @param hwr The height-width ratio of the plant (in cm per cm).
  * @return The calculated width of the plant (in cm).
  */
-double ALLOMETRY::widthFromHeightByRatio(UTILS utils, double height, double heightWidthRatio)
+double ALLOMETRY::widthFromHeightByRatio(const UTILS &utils, double height, double heightWidthRatio) const
 {
    if (heightWidthRatio <= 0.0)
    {
@@ -96,7 +96,7 @@ double ALLOMETRY::widthFromHeightByRatio(UTILS utils, double height, double heig
  * @param form The shoot form factor of the plant (in g per cubic cm).
  * @return The calculated height of the plant (in cm).
  */
-double ALLOMETRY::heightFromShootBiomassByRatioAndShootCorrection(UTILS utils, double shootBiomass, double heightWidthRatio, double shootCorrectionFactor)
+double ALLOMETRY::heightFromShootBiomassByRatioAndShootCorrection(const UTILS &utils, double shootBiomass, double heightWidthRatio, double shootCorrectionFactor) const
 {
    if (shootCorrectionFactor <= 0.0)
    {
@@ -116,7 +116,7 @@ double ALLOMETRY::heightFromShootBiomassByRatioAndShootCorrection(UTILS utils, d
  * @param form The shoot form factor of the plant (in g per cubic cm).
  * @return The calculated width of the plant (in g).
  */
-double ALLOMETRY::widthFromShootBiomassByRatioAndShootCorrection(UTILS utils, double shootBiomass, double heightWidthRatio, double shootCorrectionFactor)
+double ALLOMETRY::widthFromShootBiomassByRatioAndShootCorrection(const UTILS &utils, double shootBiomass, double heightWidthRatio, double shootCorrectionFactor) const
 {
    if (heightWidthRatio <= 0.0 || shootCorrectionFactor <= 0.0)
    {
@@ -140,12 +140,12 @@ double ALLOMETRY::widthFromShootBiomassByRatioAndShootCorrection(UTILS utils, do
  * @param form The shoot form factor of the plant (in g per cubic cm).
  * @return The calculated shoot biomass of the plant (in g).
  */
-double ALLOMETRY::shootBiomassFromHeightWidthShootCorrection(double height, double width, double shootCorrectionFactor)
+double ALLOMETRY::shootBiomassFromHeightWidthShootCorrection(double height, double width, double shootCorrectionFactor) const
 {
    return areaFromWidth(width) * height * shootCorrectionFactor;
 }
 
-double ALLOMETRY::heightFromPlantBiomassShootCorrectionAndByRatios(UTILS utils, double plantBiomass, double heightWidthRatio, double shootCorrectionFactor, double shootRootRatio)
+double ALLOMETRY::heightFromPlantBiomassShootCorrectionAndByRatios(const UTILS &utils, double plantBiomass, double heightWidthRatio, double shootCorrectionFactor, double shootRootRatio) const
 {
 
    if (shootRootRatio <= 0.0 || shootCorrectionFactor <= 0.0)
@@ -157,7 +157,7 @@ double ALLOMETRY::heightFromPlantBiomassShootCorrectionAndByRatios(UTILS utils,
    return (calcPart2);
 }
 
-double ALLOMETRY::rootBiomassFromShootBiomass(UTILS utils, double shootBiomass, double shootRootRatio)
+double ALLOMETRY::rootBiomassFromShootBiomass(const UTILS &utils, double shootBiomass, double shootRootRatio) const
 {
    if (shootRootRatio <= 0.0)
    {
@@ -166,7 +166,7 @@ double ALLOMETRY::rootBiomassFromShootBiomass(UTILS utils, double shootBiomass,
    return (shootBiomass / shootRootRatio);
 }
 
-double ALLOMETRY::rootDepthFromRootBiomassParametersRatioAndShootCorrection(UTILS utils, double rootBiomass, double parameterIntercept, double parameterExponent, double shootRootRatio, double shootCorrectionFactor)
+double ALLOMETRY::rootDepthFromRootBiomassParametersRatioAndShootCorrection(const UTILS &utils, double rootBiomass, double parameterIntercept, double parameterExponent, double shootRootRatio, double shootCorrectionFactor) const
 {
    if (shootCorrectionFactor <= 0.0)
    {
@@ -16,15 +16,15 @@ public:
    ALLOMETRY();
    ~ALLOMETRY();
 
-   double laiFromShootBiomassAreaSla(UTILS utils, double shootBiomass, double area, double sla);
-   double areaFromWidth(double width);
-   double heightFromShootBiomassWidthShootCorrection(UTILS utils, double shootBiomass, double width, double shootCorrectionFactor);
-   double heightFromWidthByRatio(double width, double heightWidthRatio);
-   double widthFromHeightByRatio(UTILS utils, double height, double heightWidthRatio);
-   double heightFromShootBiomassByRatioAndShootCorrection(UTILS utils, double shootBiomass, double heightWidthRatio, double shootCorrectionFactor);
-   double widthFromShootBiomassByRatioAndShootCorrection(UTILS utils, double shootBiomass, double heightWidthRatio, double shootCorrectionFactor);
-   double shootBiomassFromHeightWidthShootCorrection(double height, double width, double shootCorrectionFactor);
-   double heightFromPlantBiomassShootCorrectionAndByRatios(UTILS utils, double plantBiomass, double heightWidthRatio, double shootCorrectionFactor, double shootRootRatio);
-   double rootBiomassFromShootBiomass(UTILS utils, double shootBiomass, double shootRootRatio);
-   double rootDepthFromRootBiomassParametersRatioAndShootCorrection(UTILS utils, double rootBiomass, double parameterIntercept, double parameterExponent, double shootRootRatio, double shootCorrectionFactor);
+   double laiFromShootBiomassAreaSla(const UTILS &utils, double shootBiomass, double area, double sla) const;
+   double areaFromWidth(double width) const;
+   double heightFromShootBiomassWidthShootCorrection(const UTILS &utils, double shootBiomass, double width, double shootCorrectionFactor) const;
+   double heightFromWidthByRatio(double width, double heightWidthRatio) const;
+   double widthFromHeightByRatio(const UTILS &utils, double height, double heightWidthRatio) const;
+   double heightFromShootBiomassByRatioAndShootCorrection(const UTILS &utils, double shootBiomass, double heightWidthRatio, double shootCorrectionFactor) const;
+   double widthFromShootBiomassByRatioAndShootCorrection(const UTILS &utils, double shootBiomass, double heightWidthRatio, double shootCorrectionFactor) const;
+   double shootBiomassFromHeightWidthShootCorrection(double height, double width, double shootCorrectionFactor) const;
+   double heightFromPlantBiomassShootCorrectionAndByRatios(const UTILS &utils, double plantBiomass, double heightWidthRatio, double shootCorrectionFactor, double shootRootRatio) const;
+   double rootBiomassFromShootBiomass(const UTILS &utils, double shootBiomass, double shootRootRatio) const;
+   double rootDepthFromRootBiomassParametersRatioAndShootCorrection(const UTILS &utils, double rootBiomass, double parameterIntercept, double parameterExponent, double shootRootRatio, double shootCorrectionFactor) const;
 };
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "cohorttable.h"
+
+COHORTTABLE::COHORTTABLE() : nextCohortId(0) {};
+COHORTTABLE::~COHORTTABLE() {};
+
+/**
+ * @brief Returns the number of plant cohorts (rows) stored in the table.
+ */
+int COHORTTABLE::size() const
+{
+   return (int)amount.size();
+}
+
+/**
+ * @brief Removes all plant cohorts from the table and restarts the cohort ids.
+ */
+void COHORTTABLE::clear()
+{
+   forEachColumn([](auto &column)
+                 { column.clear(); });
+   nextCohortId = 0;
+}
+
+/**
+ * @brief Reserves memory in all columns for the given number of plant cohorts.
+ *
+ * @param numberOfCohorts Number of cohorts the table should hold without reallocation.
+ */
+void COHORTTABLE::reserve(int numberOfCohorts)
+{
+   forEachColumn([numberOfCohorts](auto &column)
+                 { column.reserve(numberOfCohorts); });
+}
+
+/**
+ * @brief Appends a plant cohort as a new row to all columns of the table.
+ *
+ * The cohort gets the next unused cohort id.
+ *
+ * @param plant The initialized plant (e.g. a new seedling cohort) to be stored.
+ * @return int The cohort handle (row index) of the added cohort.
+ */
+int COHORTTABLE::addCohort(const PLANT &plant)
+{
+   cohortId.push_back(nextCohortId++);
+   amount.push_back(plant.amount);
+   pft.push_back(plant.pft);
+   age.push_back(plant.age);
+   coveredArea.push_back(plant.coveredArea);
+   width.push_back(plant.width);
+   height.push_back(plant.height);
+   laiGreen.push_back(plant.laiGreen);
+   laiBrown.push_back(plant.laiBrown);
+   lai.push_back(plant.lai);
+   rootingDepth.push_back(plant.rootingDepth);
+   numberOfSoilLayersRooting.push_back(plant.numberOfSoilLayersRooting);
+   shootBiomass.push_back(plant.shootBiomass);
+   shootBiomassGreenLeaves.push_back(plant.shootBiomassGreenLeaves);
+   shootBiomassBrownLeaves.push_back(plant.shootBiomassBrownLeaves);
+   shootBiomassAboveClippingHeight.push_back(plant.shootBiomassAboveClippingHeight);
+   rootBiomass.push_back(plant.rootBiomass);
+   recruitmentBiomass.push_back(plant.recruitmentBiomass);
+   exudationBiomass.push_back(plant.exudationBiomass);
+   plantBiomass.push_back(plant.plantBiomass);
+   shootCarbonGreenLeaves.push_back(plant.shootCarbonGreenLeaves);
+   shootCarbonBrownLeaves.push_back(plant.shootCarbonBrownLeaves);
+   shootCarbon.push_back(plant.shootCarbon);
+   rootCarbon.push_back(plant.rootCarbon);
+   recruitmentCarbon.push_back(plant.recruitmentCarbon);
+   exudationCarbon.push_back(plant.exudationCarbon);
+   plantCarbon.push_back(plant.plantCarbon);
+   shootNitrogenGreenLeaves.push_back(plant.shootNitrogenGreenLeaves);
+   shootNitrogenBrownLeaves.push_back(plant.shootNitrogenBrownLeaves);
+   shootNitrogen.push_back(plant.shootNitrogen);
+   rootNitrogen.push_back(plant.rootNitrogen);
+   recruitmentNitrogen.push_back(plant.recruitmentNitrogen);
+   exudationNitrogen.push_back(plant.exudationNitrogen);
+   plantNitrogen.push_back(plant.plantNitrogen);
+   annualMortality.push_back(plant.annualMortality);
+   cumulativeOvertoppingCommunityLAI.push_back(plant.cumulativeOvertoppingCommunityLAI);
+   availableRadiation.push_back(plant.availableRadiation);
+   shadingIndicator.push_back(plant.shadingIndicator);
+   gpp.push_back(plant.gpp);
+   npp.push_back(plant.npp);
+   nppBuffer.push_back(plant.nppBuffer);
+   totalRespiration.push_back(plant.totalRespiration);
+   growthRespiration.push_back(plant.growthRespiration);
+   maintenanceRespiration.push_back(plant.maintenanceRespiration);
+   airTemperatureEffectOnRespiration.push_back(plant.airTemperatureEffectOnRespiration);
+   airTemperatureEffectOnGpp.push_back(plant.airTemperatureEffectOnGpp);
+   nppAllocationShoot.push_back(plant.nppAllocationShoot);
+   nppAllocationRoot.push_back(plant.nppAllocationRoot);
+   nppAllocationRecruitment.push_back(plant.nppAllocationRecruitment);
+   nppAllocationExudation.push_back(plant.nppAllocationExudation);
+   limitingFactorGppWater.push_back(plant.limitingFactorGppWater);
+   limitingFactorNppNitrogen.push_back(plant.limitingFactorNppNitrogen);
+   limitingFactorSymbiosisRhizobia.push_back(plant.limitingFactorSymbiosisRhizobia);
+   nitrogenSurplus.push_back(plant.nitrogenSurplus);
+   shootNitrogenUptake.push_back(plant.shootNitrogenUptake);
+   rootNitrogenUptake.push_back(plant.rootNitrogenUptake);
+   recruitmentNitrogenUptake.push_back(plant.recruitmentNitrogenUptake);
+
+   return (size() - 1);
+}
+
+/**
+ * @brief Copies all state variables of a plant cohort into a `PLANT` object.
+ *
+ * @param cohortIndex The cohort handle (row index) of the cohort.
+ * @return PLANT A copy of the plant cohort.
+ */
+PLANT COHORTTABLE::getCohort(int cohortIndex) const
+{
+   PLANT plant;
+   plant.amount = amount[cohortIndex];
+   plant.pft = pft[cohortIndex];
+   plant.age = age[cohortIndex];
+   plant.coveredArea = coveredArea[cohortIndex];
+   plant.width = width[cohortIndex];
+   plant.height = height[cohortIndex];
+   plant.laiGreen = laiGreen[cohortIndex];
+   plant.laiBrown = laiBrown[cohortIndex];
+   plant.lai = lai[cohortIndex];
+   plant.rootingDepth = rootingDepth[cohortIndex];
+   plant.numberOfSoilLayersRooting = numberOfSoilLayersRooting[cohortIndex];
+   plant.shootBiomass = shootBiomass[cohortIndex];
+   plant.shootBiomassGreenLeaves = shootBiomassGreenLeaves[cohortIndex];
+   plant.shootBiomassBrownLeaves = shootBiomassBrownLeaves[cohortIndex];
+   plant.shootBiomassAboveClippingHeight = shootBiomassAboveClippingHeight[cohortIndex];
+   plant.rootBiomass = rootBiomass[cohortIndex];
+   plant.recruitmentBiomass = recruitmentBiomass[cohortIndex];
+   plant.exudationBiomass = exudationBiomass[cohortIndex];
+   plant.plantBiomass = plantBiomass[cohortIndex];
+   plant.shootCarbonGreenLeaves = shootCarbonGreenLeaves[cohortIndex];
+   plant.shootCarbonBrownLeaves = shootCarbonBrownLeaves[cohortIndex];
+   plant.shootCarbon = shootCarbon[cohortIndex];
+   plant.rootCarbon = rootCarbon[cohortIndex];
+   plant.recruitmentCarbon = recruitmentCarbon[cohortIndex];
+   plant.exudationCarbon = exudationCarbon[cohortIndex];
+   plant.plantCarbon = plantCarbon[cohortIndex];
+   plant.shootNitrogenGreenLeaves = shootNitrogenGreenLeaves[cohortIndex];
+   plant.shootNitrogenBrownLeaves = shootNitrogenBrownLeaves[cohortIndex];
+   plant.shootNitrogen = shootNitrogen[cohortIndex];
+   plant.rootNitrogen = rootNitrogen[cohortIndex];
+   plant.recruitmentNitrogen = recruitmentNitrogen[cohortIndex];
+   plant.exudationNitrogen = exudationNitrogen[cohortIndex];
+   plant.plantNitrogen = plantNitrogen[cohortIndex];
+   plant.annualMortality = annualMortality[cohortIndex];
+   plant.cumulativeOvertoppingCommunityLAI = cumulativeOvertoppingCommunityLAI[cohortIndex];
+   plant.availableRadiation = availableRadiation[cohortIndex];
+   plant.shadingIndicator = shadingIndicator[cohortIndex];
+   plant.gpp = gpp[cohortIndex];
+   plant.npp = npp[cohortIndex];
+   plant.nppBuffer = nppBuffer[cohortIndex];
+   plant.totalRespiration = totalRespiration[cohortIndex];
+   plant.growthRespiration = growthRespiration[cohortIndex];
+   plant.maintenanceRespiration = maintenanceRespiration[cohortIndex];
+   plant.airTemperatureEffectOnRespiration = airTemperatureEffectOnRespiration[cohortIndex];
+   plant.airTemperatureEffectOnGpp = airTemperatureEffectOnGpp[cohortIndex];
+   plant.nppAllocationShoot = nppAllocationShoot[cohortIndex];
+   plant.nppAllocationRoot = nppAllocationRoot[cohortIndex];
+   plant.nppAllocationRecruitment = nppAllocationRecruitment[cohortIndex];
+   plant.nppAllocationExudation = nppAllocationExudation[cohortIndex];
+   plant.limitingFactorGppWater = limitingFactorGppWater[cohortIndex];
+   plant.limitingFactorNppNitrogen = limitingFactorNppNitrogen[cohortIndex];
+   plant.limitingFactorSymbiosisRhizobia = limitingFactorSymbiosisRhizobia[cohortIndex];
+   plant.nitrogenSurplus = nitrogenSurplus[cohortIndex];
+   plant.shootNitrogenUptake = shootNitrogenUptake[cohortIndex];
+   plant.rootNitrogenUptake = rootNitrogenUptake[cohortIndex];
+   plant.recruitmentNitrogenUptake = recruitmentNitrogenUptake[cohortIndex];
+
+   return plant;
+}
+
+/**
+ * @brief Removes the flagged plant cohorts from all columns of the table.
+ *
+ * The remaining cohorts are compacted towards the front of the columns while
+ * keeping their relative order, i.e. cohort handles of cohorts located before
+ * the first removed cohort stay valid.
+ *
+ * @param cohortIsRemoved Flag for each cohort (row) whether it shall be removed.
+ */
+void COHORTTABLE::removeCohorts(const std::vector<bool> &cohortIsRemoved)
+{
+   forEachColumn([&cohortIsRemoved](auto &column)
+                 {
+                    int keptCohorts = 0;
+                    for (int cohortIndex = 0; cohortIndex < (int)column.size(); cohortIndex++)
+                    {
+                       if (!cohortIsRemoved[cohortIndex])
+                       {
+                          column[keptCohorts] = column[cohortIndex];
+                          keptCohorts++;
+                       }
+                    }
+                    column.resize(keptCohorts);
+                 });
+}
\ No newline at end of file
@@ -0,0 +1,201 @@
+#pragma once
+#include "plant.h"
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief Contiguous structure-of-arrays storage of all plant cohorts of the community.
+ *
+ * The `COHORTTABLE` class holds one column (a `std::vector`) per state variable of the
+ * `PLANT` class. A plant cohort is addressed by its row index (the cohort handle), e.g.
+ * `community.allPlants.height[cohortIndex]`. Cohort handles stay valid until cohorts are
+ * removed from the table, which only happens in `COMMUNITY::checkPlantsAreAliveInCommunity()`
+ * and `FUSION::fuseSimilarCohorts()`.
+ *
+ * New cohorts are still initialized by the constructor of the `PLANT` class and then
+ * appended as a new row to all columns. Each cohort additionally gets a unique `cohortId`,
+ * which, in contrast to the row index, stays the same for the whole lifetime of the cohort
+ * and identifies its random number streams (see module_random/random.h).
+ */
+class COHORTTABLE
+{
+public:
+   COHORTTABLE();
+   ~COHORTTABLE();
+
+   std::uint64_t nextCohortId; /// Cohort id assigned to the next added cohort
+
+   std::vector<std::uint64_t> cohortId; /// Unique and persistent id of the plant cohort
+   std::vector<int> amount;             /// Number of plants in cohort with equal properties listed below (representative for ONE plant)
+   std::vector<short> pft;              /// Number of plant functional types (PFT)
+   std::vector<double> age;             /// Plant age (in days)
+
+   std::vector<double> coveredArea;            /// Ground area covered by plant (in square cm)
+   std::vector<double> width;                  /// Plant width (in cm)
+   std::vector<double> height;                 /// Plant height (in cm)
+   std::vector<double> laiGreen;               /// Green leaf area index of a plant (in square cm per square cm)
+   std::vector<double> laiBrown;               /// Senescent leaf area index of a plant (in square cm per square cm)
+   std::vector<double> lai;                    /// Leaf area index of plant (in square cm per square cm)
+   std::vector<double> rootingDepth;           /// Rooting depth (in cm)
+   std::vector<int> numberOfSoilLayersRooting; /// Number of soil layer a plant is rooting down to
+
+   std::vector<double> shootBiomass;                    /// Aboveground shoot biomass (in gODM)
+   std::vector<double> shootBiomassGreenLeaves;         /// Green photosynthetic active biomass of plant shoot (in gODM)
+   std::vector<double> shootBiomassBrownLeaves;         /// Senescent photosynthetic inactive brown biomass of plant shoot (in gODM)
+   std::vector<double> shootBiomassAboveClippingHeight; /// Shoot biomass above the clipping height of field measurements (in gODM)
+   std::vector<double> rootBiomass;                     /// Belowground root biomass (in gODM)
+   std::vector<double> recruitmentBiomass;              /// Recruitment biomass (in gODM)
+   std::vector<double> exudationBiomass;                /// Exudation biomass (in gODM)
+   std::vector<double> plantBiomass;                    /// Total plant biomass of shoot and root (in gODM)
+
+   std::vector<double> shootCarbonGreenLeaves; /// Carbon content in biomass of green plant shoot (in gC)
+   std::vector<double> shootCarbonBrownLeaves; /// Carbon content in biomass of senescent brown plant shoot (in gC)
+   std::vector<double> shootCarbon;            /// Carbon content in biomass of plant shoot (in gC)
+   std::vector<double> rootCarbon;             /// Carbon content in belowground root biomass (in gC)
+   std::vector<double> recruitmentCarbon;      /// Carbon content in recruitment biomass per plant (in gC)
+   std::vector<double> exudationCarbon;        /// Carbon content in exudation biomass per plant (in gC)
+   std::vector<double> plantCarbon;            /// Carbon content in biomass per plant of root and shoot (in gC)
+
+   std::vector<double> shootNitrogenGreenLeaves; /// Nitrogen content in biomass of green plant shoot (in gN)
+   std::vector<double> shootNitrogenBrownLeaves; /// Nitrogen content in biomass of senescent brown plant shoot (in gN)
+   std::vector<double> shootNitrogen;            /// Nitrogen content in biomass of plant shoot (in gN)
+   std::vector<double> rootNitrogen;             /// Nitrogen content in belowground root biomass (in gN)
+   std::vector<double> recruitmentNitrogen;      /// Nitrogen content in recruitment biomass per plant (in gN)
+   std::vector<double> exudationNitrogen;        /// Nitrogen content in exudation biomass per plant (in gN)
+   std::vector<double> plantNitrogen;            /// Nitrogen content in biomass per plant of root and shoot (in gN)
+
+   std::vector<double> annualMortality;                   /// Annual probability for a plant to die
+   std::vector<double> cumulativeOvertoppingCommunityLAI; /// Cumulative leaf area index above a plant accounting for light extinction (in square cm per square cm)
+   std::vector<double> availableRadiation;                /// Incoming radiation [micromol(photon) per square m per second]
+   std::vector<double> shadingIndicator;                  /// Fraction of sunlight reaching the plant in relation to full sun light (-)
+
+   std::vector<double> gpp;                               /// Gross primary productivity GPP (in gODM per day)
+   std::vector<double> npp;                               /// Net primary productivity NPP (in gODM per day)
+   std::vector<double> nppBuffer;                         /// Buffer of GPP (in gODM per d) if NPP < 0
+   std::vector<double> totalRespiration;                  /// Total respiration (in gODM per day)
+   std::vector<double> growthRespiration;                 /// Growth respiration (in gODM per day)
+   std::vector<double> maintenanceRespiration;            /// Maintanance respiration (in gODM per day)
+   std::vector<double> airTemperatureEffectOnRespiration; /// Effect of full-day air tempature on maintenance respiration
+   std::vector<double> airTemperatureEffectOnGpp;         /// Effect of daytime air temperature on GPP
+
+   std::vector<double> nppAllocationShoot;       /// Allocation rate of NPP to shoot growth
+   std::vector<double> nppAllocationRoot;        /// Allocation rate of NPP to root growth
+   std::vector<double> nppAllocationRecruitment; /// Allocation rate of NPP to seed production (recruitment biomass)
+   std::vector<double> nppAllocationExudation;   /// Allocation rate of NPP to exudates
+
+   std::vector<double> limitingFactorGppWater;          /// Limitation factor addressing the impact of soil water deficit and surplus on GPP
+   std::vector<double> limitingFactorNppNitrogen;       /// Limitation factor addressing the impact of soil nitrogen deficits on NPP
+   std::vector<double> limitingFactorSymbiosisRhizobia; /// ...
+
+   std::vector<double> nitrogenSurplus;           /// Nitrogen surplus provided by leaf senescence and nitrogen retranslocation to green leaves (in gN)
+   std::vector<double> shootNitrogenUptake;       /// Uptake of soil nitrogen at plant shoot (in gN per day)
+   std::vector<double> rootNitrogenUptake;        /// Uptake of soil nitrogen at plant root (in gN per day)
+   std::vector<double> recruitmentNitrogenUptake; /// Uptake of soil nitrogen for seed production (recruitment) (in gN per day)
+
+   int size() const;
+   void clear();
+   void reserve(int numberOfCohorts);
+   int addCohort(const PLANT &plant);
+   PLANT getCohort(int cohortIndex) const;
+   void removeCohorts(const std::vector<bool> &cohortIsRemoved);
+
+   /**
+    * @brief Applies a function to every column of the table.
+    *
+    * Used for operations that treat all columns alike (clearing, reserving, compacting),
+    * so that a new column only has to be added to `forEachColumnOf()` and in `addCohort()` / `getCohort()`.
+    *
+    * @param function Callable accepting any `std::vector<T>&` column.
+    */
+   template <typename FUNCTION>
+   void forEachColumn(FUNCTION function)
+   {
+      forEachColumnOf(*this, function);
+   }
+
+   /**
+    * @brief Applies a function to every column of the table without modifying it (e.g. to measure the columns).
+    *
+    * @param function Callable accepting any `const std::vector<T>&` column.
+    */
+   template <typename FUNCTION>
+   void forEachColumn(FUNCTION function) const
+   {
+      forEachColumnOf(*this, function);
+   }
+
+private:
+   /**
+    * @brief Lists the columns of a constant or non-constant table for both overloads of `forEachColumn()`.
+    */
+   template <typename TABLE, typename FUNCTION>
+   static void forEachColumnOf(TABLE &table, FUNCTION &function)
+   {
+      function(table.cohortId);
+      function(table.amount);
+      function(table.pft);
+      function(table.age);
+
+      function(table.coveredArea);
+      function(table.width);
+      function(table.height);
+      function(table.laiGreen);
+      function(table.laiBrown);
+      function(table.lai);
+      function(table.rootingDepth);
+      function(table.numberOfSoilLayersRooting);
+
+      function(table.shootBiomass);
+      function(table.shootBiomassGreenLeaves);
+      function(table.shootBiomassBrownLeaves);
+      function(table.shootBiomassAboveClippingHeight);
+      function(table.rootBiomass);
+      function(table.recruitmentBiomass);
+      function(table.exudationBiomass);
+      function(table.plantBiomass);
+
+      function(table.shootCarbonGreenLeaves);
+      function(table.shootCarbonBrownLeaves);
+      function(table.shootCarbon);
+      function(table.rootCarbon);
+      function(table.recruitmentCarbon);
+      function(table.exudationCarbon);
+      function(table.plantCarbon);
+
+      function(table.shootNitrogenGreenLeaves);
+      function(table.shootNitrogenBrownLeaves);
+      function(table.shootNitrogen);
+      function(table.rootNitrogen);
+      function(table.recruitmentNitrogen);
+      function(table.exudationNitrogen);
+      function(table.plantNitrogen);
+
+      function(table.annualMortality);
+      function(table.cumulativeOvertoppingCommunityLAI);
+      function(table.availableRadiation);
+      function(table.shadingIndicator);
+
+      function(table.gpp);
+      function(table.npp);
+      function(table.nppBuffer);
+      function(table.totalRespiration);
+      function(table.growthRespiration);
+      function(table.maintenanceRespiration);
+      function(table.airTemperatureEffectOnRespiration);
+      function(table.airTemperatureEffectOnGpp);
+
+      function(table.nppAllocationShoot);
+      function(table.nppAllocationRoot);
+      function(table.nppAllocationRecruitment);
+      function(table.nppAllocationExudation);
+
+      function(table.limitingFactorGppWater);
+      function(table.limitingFactorNppNitrogen);
+      function(table.limitingFactorSymbiosisRhizobia);
+
+      function(table.nitrogenSurplus);
+      function(table.shootNitrogenUptake);
+      function(table.rootNitrogenUptake);
+      function(table.recruitmentNitrogenUptake);
+   }
+};
\ No newline at end of file
@@ -6,100 +6,123 @@ COMMUNITY::~COMMUNITY() {};
 /**
  * @brief Checks if plant cohorts in the community vector are still alive and removes dead cohorts.
  *
- * This function iterates through all plant cohorts in the `allPlants` vector and checks
+ * This function iterates through all plant cohorts in the `allPlants` table and checks
  * if each cohort's count is greater than zero. If a cohort's count is zero or negative,
- * it is considered dead. The indices of dead cohorts are stored and then removed
- * from the community vector.
+ * it is considered dead. Dead cohorts are flagged and then removed
+ * from the community table.
  *
  * If any cohort has a negative count, an error is raised. Additionally,
- * if more cohorts are marked for deletion than exist in the community vector,
+ * if more cohorts are marked for deletion than exist in the community table,
  * an error will also be triggered.
  *
  * @param utils A utility object used for error handling and reporting.
  */
-void COMMUNITY::checkPlantsAreAliveInCommunity(UTILS utils)
+void COMMUNITY::checkPlantsAreAliveInCommunity(const UTILS &utils)
 {
-   std::vector<int> idsOfDeadPlantCohorts;
-   idsOfDeadPlantCohorts.clear();
+   std::vector<bool> cohortIsDead(allPlants.size(), false);
+   int numberOfDeadPlantCohorts = 0;
 
    if (allPlants.size() > 0)
    {
-      /* go through all plant cohorts in the community vector and save indices of dying cohorts */
+      /* go through all plant cohorts in the community table and flag dying cohorts */
       for (int cohortIndex = 0; cohortIndex < allPlants.size(); cohortIndex++)
       {
-         if (allPlants[cohortIndex]->amount == 0)
+         if (allPlants.amount[cohortIndex] == 0)
          {
-            idsOfDeadPlantCohorts.push_back(cohortIndex);
+            cohortIsDead[cohortIndex] = true;
+            numberOfDeadPlantCohorts++;
          }
-         else if (allPlants[cohortIndex]->amount < 0)
+         else if (allPlants.amount[cohortIndex] < 0)
          {
-            utils.handleError("Error (allPlants vector): there is an invalid negative amount of plants within a cohort.");
+            utils.handleError("Error (allPlants table): there is an invalid negative amount of plants within a cohort.");
          }
       }
 
-      /* throw an error if more cohorts should die than existing in the community vector */
-      if (idsOfDeadPlantCohorts.size() > allPlants.size())
+      /* throw an error if more cohorts should die than existing in the community table */
+      if (numberOfDeadPlantCohorts > allPlants.size())
       {
          utils.handleError("More plant cohorts shall be deleted than existing.");
       }
-      else if (idsOfDeadPlantCohorts.size() > 0) /* delete the dying cohorts */
+      else if (numberOfDeadPlantCohorts > 0) /* delete the dying cohorts */
       {
-         // reversed sorting of indicees to ensure a correct deleting of plants in community vector from back to front
-         std::sort(idsOfDeadPlantCohorts.rbegin(), idsOfDeadPlantCohorts.rend());
-         for (auto id : idsOfDeadPlantCohorts)
-         {
-            allPlants.erase(allPlants.begin() + id);
-         }
+         // compaction of the remaining cohorts keeps their order in the community table
+         allPlants.removeCohorts(cohortIsDead);
       }
    }
 }
 
+/**
+ * @brief Calculates the state variables of the community needed by the plant processes of the next day.
+ *
+ * Updated every day after the plant processes: the ground area covered by all plants (accounting
+ * for the shoot overlap of each PFT, used for crowding in recruitment and mortality) and the shoot
+ * biomass of each cohort above the clipping height of field measurements (a cohort state variable).
+ * The aggregates that are only written to the output files are calculated by
+ * `updateCommunityStateVariablesForOutput()` on output days.
+ *
+ * @param parameter A parameter object that provides the shoot overlap factors and the clipping height.
+ */
+void COMMUNITY::updateCommunityStateVariables(const PARAMETER &parameter)
+{
+   for (int cohortindex = 0; cohortindex < allPlants.size(); cohortindex++)
+   {
+      if (allPlants.height[cohortindex] > parameter.clippingHeightOfBiomassMeasurement)
+      {
+         allPlants.shootBiomassAboveClippingHeight[cohortindex] =
+             ((allPlants.height[cohortindex] - parameter.clippingHeightOfBiomassMeasurement) / allPlants.height[cohortindex]) * allPlants.shootBiomass[cohortindex];
+      }
+      coveredAreaOfAllPlants += allPlants.coveredArea[cohortindex] * parameter.plantShootOverlapFactors[allPlants.pft[cohortindex]];
+   }
+}
+
 /**
  * @brief Calculates aggregated state variables based on dynamic changes of the community vector.
  *
  * This function updates various state variables related to the plant community, including
  * PFT composition and total amount of plants. It iterates over all plant cohorts in the
- * `allPlants` vector, aggregating their amount into PFT-specific and community-wide totals values.
+ * `allPlants` table, aggregating their amount into PFT-specific and community-wide totals values.
  *
  * After processing all cohorts, the function normalizes the PFT composition values to
  * reflect their proportions relative to the total amount of plants in the community.
  *
+ * The aggregates are only used for output and are only calculated on days whose community or
+ * PFT results are written or aggregated (see `OUTPUT::isCommunityAggregationDay()`); on other
+ * days they keep the values reset by `INIT::initAndResetProcessVariables()`. Has to be called
+ * after `updateCommunityStateVariables()`.
+ *
  * @param parameter A parameter object that provides information about the number of PFTs
  *                  (Plant Functional Types) in the simulation.
  */
-void COMMUNITY::updateCommunityStateVariablesForOutput(PARAMETER parameter)
+void COMMUNITY::updateCommunityStateVariablesForOutput(const PARAMETER &parameter)
 {
    if (allPlants.size() > 0)
    {
       for (int cohortindex = 0; cohortindex < allPlants.size(); cohortindex++)
       {
          // PFT-specific calculations
-         pftComposition[allPlants[cohortindex]->pft] += allPlants[cohortindex]->amount;
-         numberOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->amount;
-         coveredAreaOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->coveredArea * allPlants[cohortindex]->amount;
-         shootBiomassOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->shootBiomass * allPlants[cohortindex]->amount;
-         greenShootBiomassOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->shootBiomassGreenLeaves * allPlants[cohortindex]->amount;
-         brownShootBiomassOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->shootBiomassBrownLeaves * allPlants[cohortindex]->amount;
+         pftComposition[allPlants.pft[cohortindex]] += allPlants.amount[cohortindex];
+         numberOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.amount[cohortindex];
+         coveredAreaOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.coveredArea[cohortindex] * allPlants.amount[cohortindex];
+         shootBiomassOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.shootBiomass[cohortindex] * allPlants.amount[cohortindex];
+         greenShootBiomassOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.shootBiomassGreenLeaves[cohortindex] * allPlants.amount[cohortindex];
+         brownShootBiomassOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.shootBiomassBrownLeaves[cohortindex] * allPlants.amount[cohortindex];
 
-         if (allPlants.at(cohortindex)->height > parameter.clippingHeightOfBiomassMeasurement)
+         if (allPlants.height[cohortindex] > parameter.clippingHeightOfBiomassMeasurement)
          {
-            allPlants.at(cohortindex)->shootBiomassAboveClippingHeight =
-                ((allPlants.at(cohortindex)->height - parameter.clippingHeightOfBiomassMeasurement) / allPlants.at(cohortindex)->height) * allPlants.at(cohortindex)->shootBiomass;
-            clippedShootBiomassOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->shootBiomassAboveClippingHeight * allPlants[cohortindex]->amount;
+            clippedShootBiomassOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.shootBiomassAboveClippingHeight[cohortindex] * allPlants.amount[cohortindex];
          }
 
-         rootBiomassOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->rootBiomass * allPlants[cohortindex]->amount;
-         recruitmentBiomassOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->recruitmentBiomass * allPlants[cohortindex]->amount;
-         exudationBiomassOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->exudationBiomass * allPlants[cohortindex]->amount;
+         rootBiomassOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.rootBiomass[cohortindex] * allPlants.amount[cohortindex];
+         recruitmentBiomassOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.recruitmentBiomass[cohortindex] * allPlants.amount[cohortindex];
+         exudationBiomassOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.exudationBiomass[cohortindex] * allPlants.amount[cohortindex];
 
-         gppOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->gpp * allPlants[cohortindex]->amount;
-         nppOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->npp * allPlants[cohortindex]->amount;
-         respirationOfPlantsPerPFT[allPlants[cohortindex]->pft] += allPlants[cohortindex]->totalRespiration * allPlants[cohortindex]->amount;
+         gppOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.gpp[cohortindex] * allPlants.amount[cohortindex];
+         nppOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.npp[cohortindex] * allPlants.amount[cohortindex];
+         respirationOfPlantsPerPFT[allPlants.pft[cohortindex]] += allPlants.totalRespiration[cohortindex] * allPlants.amount[cohortindex];
 
          // Community-wide calculations
-         totalNumberOfPlantsInCommunity += allPlants[cohortindex]->amount;
-         leafAreaIndexOfPlantsInCommunity += allPlants[cohortindex]->lai * allPlants[cohortindex]->coveredArea * allPlants[cohortindex]->amount;
-         coveredAreaOfAllPlants += allPlants[cohortindex]->coveredArea * parameter.plantShootOverlapFactors[allPlants[cohortindex]->pft];
+         totalNumberOfPlantsInCommunity += allPlants.amount[cohortindex];
+         leafAreaIndexOfPlantsInCommunity += allPlants.lai[cohortindex] * allPlants.coveredArea[cohortindex] * allPlants.amount[cohortindex];
       }
 
       // Normalizations
@@ -111,4 +134,4 @@ void COMMUNITY::updateCommunityStateVariablesForOutput(PARAMETER parameter)
          }
       }
    }
-}
\ No newline at end of file
+}
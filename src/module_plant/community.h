@@ -1,5 +1,6 @@
 #pragma once
 #include "plant.h"
+#include "cohorttable.h"
 #include "allometry.h"
 #include "../module_parameter/parameter.h"
 #include "../utils/utils.h"
@@ -21,9 +22,7 @@ public:
    COMMUNITY();
    ~COMMUNITY();
 
-   int randomNumberIndex;
-
-   std::vector<std::shared_ptr<PLANT>> allPlants;
+   COHORTTABLE allPlants; /// All plant cohorts of the community stored column-wise (structure of arrays)
 
    int totalNumberOfPlantsInCommunity;
    int totalNumberOfCohortsInCommunity;
@@ -54,6 +53,7 @@ public:
    std::vector<double> brownBiomassYieldPerPFT;
    std::vector<double> biomassYieldPerPFT;
 
-   void checkPlantsAreAliveInCommunity(UTILS utils);
-   void updateCommunityStateVariablesForOutput(PARAMETER parameter);
+   void checkPlantsAreAliveInCommunity(const UTILS &utils);
+   void updateCommunityStateVariables(const PARAMETER &parameter);
+   void updateCommunityStateVariablesForOutput(const PARAMETER &parameter);
 };
@@ -31,7 +31,7 @@ public:
     * @param plantBiomass The initial biomass of the plant in g(ODM).
     * @param amount The number of plants in the cohort.
     */
-   PLANT(UTILS utils, PARAMETER parameter, ALLOMETRY allometry, int pft, int amount) : pft(pft), amount(amount)
+   PLANT(const UTILS &utils, const PARAMETER &parameter, const ALLOMETRY &allometry, int pft, int amount) : pft(pft), amount(amount)
    {
       age = 0;
       plantBiomass = parameter.seedMasses[pft];
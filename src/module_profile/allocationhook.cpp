@@ -0,0 +1,34 @@
+#include "memory.h"
+#include <cstdlib>
+#include <new>
+
+/**
+ * @brief Replacement of the global operator new counting the heap allocations for `MEMORYMONITOR`.
+ *
+ * Only linked into the model executable (not into the grassmind library), so that programs
+ * using the library keep their own allocator. Allocations are only counted while the
+ * memory footprint is sampled (`memorySamplingInterval` > 0).
+ */
+void *operator new(std::size_t size)
+{
+   if (MEMORYMONITOR::allocationCountingActivated.load(std::memory_order_relaxed))
+   {
+      MEMORYMONITOR::numberOfAllocations.fetch_add(1, std::memory_order_relaxed);
+      MEMORYMONITOR::numberOfAllocatedBytes.fetch_add(size, std::memory_order_relaxed);
+   }
+   if (void *memory = std::malloc(size > 0 ? size : 1))
+   {
+      return memory;
+   }
+   throw std::bad_alloc();
+}
+
+void operator delete(void *memory) noexcept
+{
+   std::free(memory);
+}
+
+void operator delete(void *memory, std::size_t) noexcept
+{
+   std::free(memory);
+}
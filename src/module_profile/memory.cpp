@@ -0,0 +1,100 @@
+#include "memory.h"
+#include <type_traits>
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+MEMORYMONITOR::MEMORYMONITOR() {};
+MEMORYMONITOR::~MEMORYMONITOR() {};
+
+/**
+ * @brief Checks if the memory footprint is sampled at the end of the current day.
+ */
+bool MEMORYMONITOR::isSamplingDay(const PARAMETER &parameter) const
+{
+   return parameter.memorySamplingInterval > 0 && (parameter.day % parameter.memorySamplingInterval == 0 || parameter.day == parameter.simulationTimeInDays);
+}
+
+/**
+ * @brief Appends a sample of the memory footprint to the memory file (created at the first sample).
+ *
+ * @param utils Utility functions for error handling and dates.
+ * @param parameter Parameters of the simulation (current day).
+ * @param community Community with the cohort table.
+ * @param recruitment Recruitment with the seed pool.
+ * @param output Output with the buffers and the name of the memory file.
+ */
+void MEMORYMONITOR::saveMemorySample(const UTILS &utils, const PARAMETER &parameter, const COMMUNITY &community, const RECRUITMENT &recruitment, const OUTPUT &output)
+{
+   if (!memoryFile.is_open())
+   {
+      memoryFile.open(output.memoryFile);
+      if (!memoryFile.is_open())
+      {
+         utils.handleError("The memory file " + output.memoryFile + " cannot be written.");
+         return;
+      }
+      memoryFile << "Date\tDayCount\tNumberCohorts\tAllocations\tAllocatedBytes\tCohortTableBytes\tSeedPoolBytes\tOutputBufferBytes\tResidentSetSizeBytes\n";
+   }
+
+   memoryFile << output.formatter.getDate(parameter.day) << "\t" << parameter.day << "\t" << community.allPlants.size() << "\t"
+              << numberOfAllocations.load(std::memory_order_relaxed) << "\t" << numberOfAllocatedBytes.load(std::memory_order_relaxed) << "\t"
+              << getBytesOfCohortTable(community.allPlants) << "\t" << getBytesOfSeedPool(recruitment) << "\t"
+              << getBytesOfOutputBuffers(output) << "\t" << getResidentSetSize() << std::endl; // flushed to catch growth of aborted runs
+}
+
+/**
+ * @brief Returns the bytes allocated by all columns of the cohort table (capacity of the columns).
+ */
+std::uint64_t MEMORYMONITOR::getBytesOfCohortTable(const COHORTTABLE &allPlants)
+{
+   std::uint64_t bytes = 0;
+   allPlants.forEachColumn([&bytes](const auto &column)
+                           { bytes += column.capacity() * sizeof(typename std::decay_t<decltype(column)>::value_type); });
+   return bytes;
+}
+
+/**
+ * @brief Returns the bytes allocated by the seed pool and the germination time counters of all PFTs.
+ */
+std::uint64_t MEMORYMONITOR::getBytesOfSeedPool(const RECRUITMENT &recruitment)
+{
+   std::uint64_t bytes = 0;
+   for (const auto &seeds : recruitment.seedPool)
+   {
+      bytes += seeds.capacity() * sizeof(int);
+   }
+   for (const auto &counters : recruitment.seedGerminationTimeCounter)
+   {
+      bytes += counters.capacity() * sizeof(int);
+   }
+   return bytes;
+}
+
+/**
+ * @brief Returns the bytes allocated by the community, PFT, plant and environment output buffers (text and columnar).
+ */
+std::uint64_t MEMORYMONITOR::getBytesOfOutputBuffers(const OUTPUT &output)
+{
+   return output.bufferCommunity.capacity() + output.bufferPFTPopulation.capacity() + output.bufferPlant.capacity() + output.bufferEnvironment.capacity() +
+          output.columnsCommunity.capacity() + output.columnsPFTPopulation.capacity() + output.columnsPlant.capacity();
+}
+
+/**
+ * @brief Returns the resident set size of the process (in bytes) from /proc/self/statm, -1 if not available.
+ */
+long long MEMORYMONITOR::getResidentSetSize()
+{
+   std::ifstream statm("/proc/self/statm");
+   long long totalPages = 0;
+   long long residentPages = 0;
+   if (!(statm >> totalPages >> residentPages))
+   {
+      return -1;
+   }
+#if defined(__unix__) || defined(__APPLE__)
+   return residentPages * sysconf(_SC_PAGESIZE);
+#else
+   return residentPages * 4096;
+#endif
+}
@@ -0,0 +1,46 @@
+#pragma once
+#include "../module_parameter/parameter.h"
+#include "../module_plant/community.h"
+#include "../module_recruitment/recruitment.h"
+#include "../module_output/output.h"
+#include "../utils/utils.h"
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+/**
+ * @brief Samples the memory footprint of a simulation run and writes it to a side file.
+ *
+ * Every `memorySamplingInterval`-th day (configuration file) and at the last day, a line is
+ * appended to the memory file in the output folder (ending `__memory__<plant traits>.txt`):
+ *
+ * - heap allocations (number and requested bytes) since the start of the run, counted by
+ *   the replaced global operator new (see allocationhook.cpp, linked into the executable;
+ *   programs using the library without the hook report 0)
+ * - bytes held by the cohort table (`COMMUNITY::allPlants`), the seed pool
+ *   (`RECRUITMENT::seedPool`) and the output buffers of the run
+ * - resident set size of the process (from /proc/self/statm, -1 if not available)
+ *
+ * Allocations and the resident set size are counted for the whole process, i.e. for all
+ * runs of an ensemble, batch or fork together.
+ */
+class MEMORYMONITOR
+{
+public:
+   MEMORYMONITOR();
+   ~MEMORYMONITOR();
+
+   inline static std::atomic<bool> allocationCountingActivated{false}; /// Heap allocations are counted by the operator new hook
+   inline static std::atomic<std::uint64_t> numberOfAllocations{0};    /// Calls of operator new since counting was activated
+   inline static std::atomic<std::uint64_t> numberOfAllocatedBytes{0}; /// Bytes requested from operator new since counting was activated
+
+   std::ofstream memoryFile; /// Side file of the samples
+
+   bool isSamplingDay(const PARAMETER &parameter) const;
+   void saveMemorySample(const UTILS &utils, const PARAMETER &parameter, const COMMUNITY &community, const RECRUITMENT &recruitment, const OUTPUT &output);
+   static std::uint64_t getBytesOfCohortTable(const COHORTTABLE &allPlants);
+   static std::uint64_t getBytesOfSeedPool(const RECRUITMENT &recruitment);
+   static std::uint64_t getBytesOfOutputBuffers(const OUTPUT &output);
+   static long long getResidentSetSize();
+};
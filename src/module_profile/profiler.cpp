@@ -0,0 +1,141 @@
+#include "profiler.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+
+PROFILER::PROFILER()
+{
+   profilingActivated = false;
+   phaseTimes.resize(static_cast<std::size_t>(PHASE::numberOfPhases));
+};
+
+PROFILER::~PROFILER() {};
+
+/**
+ * @brief Reads the option `--profile [report file]` from the command line.
+ *
+ * @param commandLineInput Command line arguments (the configuration file is the first argument).
+ * @param utils Utility functions for error handling (unused, same signature as the other command line readers).
+ * @return False if an option is invalid.
+ */
+bool PROFILER::readCommandLineOptions(const std::vector<std::string> &commandLineInput, [[maybe_unused]] const UTILS &utils)
+{
+   for (std::size_t it = 2; it < commandLineInput.size(); it++)
+   {
+      if (commandLineInput[it] == "--profile")
+      {
+         profilingActivated = true;
+         if (it + 1 < commandLineInput.size() && commandLineInput[it + 1].rfind("--", 0) != 0)
+         {
+            reportFile = commandLineInput[++it];
+         }
+      }
+   }
+   return true;
+}
+
+/**
+ * @brief Returns the name of a phase as used in the report.
+ */
+const char *PROFILER::getPhaseName(PHASE phase)
+{
+   switch (phase)
+   {
+   case PHASE::input:
+      return "input";
+   case PHASE::recruitment:
+      return "recruitment";
+   case PHASE::mortality:
+      return "mortality";
+   case PHASE::fusion:
+      return "fusion";
+   case PHASE::light:
+      return "light";
+   case PHASE::growth:
+      return "growth";
+   case PHASE::management:
+      return "management";
+   case PHASE::communityAggregation:
+      return "community_aggregation";
+   case PHASE::communityOutputAggregation:
+      return "community_output_aggregation";
+   case PHASE::outputBuffering:
+      return "output_buffering";
+   case PHASE::outputWriting:
+      return "output_writing";
+   default:
+      return "unknown";
+   }
+}
+
+/**
+ * @brief Adds the runtime of one call of a phase.
+ *
+ * @param phase Measured phase.
+ * @param seconds Runtime of the call (in s).
+ */
+void PROFILER::addTime(PHASE phase, double seconds)
+{
+   PHASETIME &phaseTime = phaseTimes[static_cast<std::size_t>(phase)];
+   phaseTime.calls++;
+   phaseTime.totalSeconds += seconds;
+   phaseTime.maximumSeconds = std::max(phaseTime.maximumSeconds, seconds);
+}
+
+/**
+ * @brief Prints the number of calls and the total, mean and maximum runtime of every phase to the console.
+ */
+void PROFILER::printReportToConsole() const
+{
+   double totalSeconds = 0.0;
+   for (const auto &phaseTime : phaseTimes)
+   {
+      totalSeconds += phaseTime.totalSeconds;
+   }
+
+   std::cout << "*************** Runtime profile ****************" << std::endl
+             << std::endl;
+   std::cout << std::left << std::setw(30) << "phase" << std::right << std::setw(10) << "calls" << std::setw(12) << "total[s]"
+             << std::setw(12) << "mean[ms]" << std::setw(12) << "max[ms]" << std::setw(9) << "share" << std::endl;
+   for (std::size_t phase = 0; phase < phaseTimes.size(); phase++)
+   {
+      const PHASETIME &phaseTime = phaseTimes[phase];
+      double meanSeconds = (phaseTime.calls > 0) ? phaseTime.totalSeconds / phaseTime.calls : 0.0;
+      double share = (totalSeconds > 0.0) ? 100.0 * phaseTime.totalSeconds / totalSeconds : 0.0;
+      std::cout << std::left << std::setw(30) << getPhaseName(static_cast<PHASE>(phase)) << std::right << std::fixed
+                << std::setw(10) << phaseTime.calls
+                << std::setw(12) << std::setprecision(3) << phaseTime.totalSeconds
+                << std::setw(12) << std::setprecision(4) << meanSeconds * 1000.0
+                << std::setw(12) << std::setprecision(4) << phaseTime.maximumSeconds * 1000.0
+                << std::setw(8) << std::setprecision(1) << share << "%" << std::endl;
+   }
+   std::cout << std::defaultfloat << std::setprecision(6) << std::endl;
+}
+
+/**
+ * @brief Writes the runtime of every phase as JSON file.
+ *
+ * @param filename Name of the JSON file.
+ * @param utils Utility functions for error handling.
+ */
+void PROFILER::writeJsonReport(const std::string &filename, const UTILS &utils) const
+{
+   std::ofstream file(filename);
+   if (!file.is_open())
+   {
+      utils.handleError("The profile report " + filename + " cannot be written.");
+      return;
+   }
+
+   file << std::setprecision(9) << "{\n  \"phases\": [\n";
+   for (std::size_t phase = 0; phase < phaseTimes.size(); phase++)
+   {
+      const PHASETIME &phaseTime = phaseTimes[phase];
+      double meanSeconds = (phaseTime.calls > 0) ? phaseTime.totalSeconds / phaseTime.calls : 0.0;
+      file << "    {\"name\": \"" << getPhaseName(static_cast<PHASE>(phase)) << "\", \"calls\": " << phaseTime.calls
+           << ", \"total_seconds\": " << phaseTime.totalSeconds << ", \"mean_seconds\": " << meanSeconds
+           << ", \"max_seconds\": " << phaseTime.maximumSeconds << "}" << ((phase + 1 < phaseTimes.size()) ? "," : "") << "\n";
+   }
+   file << "  ]\n}\n";
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include "trace.h"
+#include "../utils/utils.h"
+#include <chrono>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Phases of a simulation run measured by the `PROFILER`.
+ */
+enum class PHASE
+{
+   input,                      /// Reading of all input files
+   recruitment,                /// RECRUITMENT::doPlantRecruitment
+   mortality,                  /// MORTALITY::doPlantMortality
+   fusion,                     /// FUSION::doCohortFusion
+   light,                      /// INTERACTION::calculateLightAttenuationAndAvailabilityForPlants
+   growth,                     /// GROWTH::doPlantGrowth
+   management,                 /// MANAGEMENT::applyManagementRegime
+   communityAggregation,       /// COMMUNITY::updateCommunityStateVariables (every day)
+   communityOutputAggregation, /// COMMUNITY::updateCommunityStateVariablesForOutput (output days)
+   outputBuffering,            /// STEP::saveSimulationResultsToBuffer
+   outputWriting,              /// Writing of the output buffers to the output files
+   numberOfPhases
+};
+
+/**
+ * @brief Accumulated runtime of one phase.
+ */
+struct PHASETIME
+{
+   long long calls = 0;
+   double totalSeconds = 0.0;
+   double maximumSeconds = 0.0;
+};
+
+/**
+ * @brief Runtime profile of the phases of a simulation run.
+ *
+ * Enabled by the command line option `--profile [report file]`. The runtime of every phase
+ * is measured by `SCOPEDTIMER` objects placed around the phase; if profiling is not enabled,
+ * the timers do not read the clock. At the end of the run, the total, mean and maximum
+ * runtime of every phase are printed as a table and written as JSON report (by default next
+ * to the output files, ending with `__profile.json`).
+ */
+class PROFILER
+{
+public:
+   PROFILER();
+   ~PROFILER();
+
+   bool profilingActivated; /// Runtimes of the phases are measured (--profile option given)
+   std::string reportFile;  /// JSON file of the report (empty = next to the output files)
+   std::vector<PHASETIME> phaseTimes;
+
+   bool readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils);
+   static const char *getPhaseName(PHASE phase);
+   void addTime(PHASE phase, double seconds);
+   void printReportToConsole() const;
+   void writeJsonReport(const std::string &filename, const UTILS &utils) const;
+};
+
+/**
+ * @brief Measures the runtime of the enclosing scope and adds it to a phase of the profiler.
+ *
+ * The scope is also recorded in the trace (see `TRACE`) if tracing is enabled.
+ * Defined in the header so that a disabled timer reduces to a single branch.
+ */
+class SCOPEDTIMER
+{
+public:
+   SCOPEDTIMER(PROFILER &profiler, PHASE phase) : profiler(profiler), phase(phase), traceScope(TRACE::tracingActivated ? PROFILER::getPhaseName(phase) : nullptr)
+   {
+      if (profiler.profilingActivated)
+      {
+         startTime = std::chrono::steady_clock::now();
+      }
+   }
+
+   ~SCOPEDTIMER()
+   {
+      if (profiler.profilingActivated)
+      {
+         profiler.addTime(phase, std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count());
+      }
+   }
+
+private:
+   PROFILER &profiler;
+   PHASE phase;
+   std::chrono::steady_clock::time_point startTime;
+   TRACESCOPE traceScope;
+};
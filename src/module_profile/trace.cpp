@@ -0,0 +1,112 @@
+#include "trace.h"
+#include <fstream>
+#include <iomanip>
+
+/**
+ * @brief Reads the option `--trace <file>` from the command line.
+ *
+ * @param commandLineInput Command line arguments.
+ * @param utils Utility functions for error handling.
+ * @return False if the trace file is missing.
+ */
+bool TRACE::readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils)
+{
+   for (std::size_t it = 1; it < commandLineInput.size(); it++)
+   {
+      if (commandLineInput[it] == "--trace")
+      {
+         if (it + 1 >= commandLineInput.size())
+         {
+            utils.handleError("The --trace option requires a trace file.");
+            return false;
+         }
+         traceFile = commandLineInput[++it];
+         tracingActivated = true;
+         setThreadName("main");
+      }
+   }
+   return true;
+}
+
+/**
+ * @brief Returns the event buffer of the calling thread, created at its first event.
+ */
+TRACEBUFFER &TRACE::getBufferOfThread()
+{
+   thread_local TRACEBUFFER *buffer = nullptr;
+   if (!buffer)
+   {
+      std::lock_guard<std::mutex> lock(buffersMutex);
+      buffers.push_back(std::make_unique<TRACEBUFFER>());
+      buffer = buffers.back().get();
+      buffer->threadId = static_cast<int>(buffers.size());
+      buffer->threadName = "thread " + std::to_string(buffer->threadId);
+   }
+   return *buffer;
+}
+
+/**
+ * @brief Sets the name of the track of the calling thread (e.g. "worker 2").
+ */
+void TRACE::setThreadName(const std::string &threadName)
+{
+   if (tracingActivated)
+   {
+      getBufferOfThread().threadName = threadName;
+   }
+}
+
+/**
+ * @brief Records an event of the calling thread.
+ *
+ * @param name Name of the scope (string literal).
+ * @param phase 'B' (begin) or 'E' (end).
+ * @param argumentName Name of an optional argument shown with the event (string literal or nullptr).
+ * @param argument Value of the optional argument.
+ */
+void TRACE::addEvent(const char *name, char phase, const char *argumentName, long long argument)
+{
+   double timestamp = std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - startTime).count();
+   getBufferOfThread().events.push_back({name, phase, timestamp, argumentName, argument});
+}
+
+/**
+ * @brief Writes all recorded events in the Chrome trace JSON format.
+ *
+ * Has to be called after all worker threads are finished.
+ *
+ * @param utils Utility functions for error handling.
+ */
+void TRACE::writeTraceFile(const UTILS &utils)
+{
+   if (!tracingActivated)
+   {
+      return;
+   }
+   std::ofstream file(traceFile);
+   if (!file.is_open())
+   {
+      utils.handleError("The trace file " + traceFile + " cannot be written.");
+      return;
+   }
+
+   std::lock_guard<std::mutex> lock(buffersMutex);
+   file << std::fixed << std::setprecision(3) << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [\n";
+   file << "{\"name\": \"process_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": 0, \"args\": {\"name\": \"GRASSMIND3\"}}";
+   for (const auto &buffer : buffers)
+   {
+      file << ",\n{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer->threadId << ", \"args\": {\"name\": \"" << buffer->threadName << "\"}}";
+      file << ",\n{\"name\": \"thread_sort_index\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer->threadId << ", \"args\": {\"sort_index\": " << buffer->threadId << "}}";
+      for (const auto &event : buffer->events)
+      {
+         file << ",\n{\"name\": \"" << event.name << "\", \"cat\": \"grassmind\", \"ph\": \"" << event.phase << "\", \"ts\": " << event.timestamp
+              << ", \"pid\": 1, \"tid\": " << buffer->threadId;
+         if (event.argumentName)
+         {
+            file << ", \"args\": {\"" << event.argumentName << "\": " << event.argument << "}";
+         }
+         file << "}";
+      }
+   }
+   file << "\n]}\n";
+}
@@ -0,0 +1,91 @@
+#pragma once
+#include "../utils/utils.h"
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Begin or end event of a traced scope.
+ *
+ * Names are string literals, so that recording an event does not allocate memory.
+ */
+struct TRACEEVENT
+{
+   const char *name;         /// Name of the scope (string literal)
+   char phase;               /// 'B' (begin) or 'E' (end) as in the Chrome trace format
+   double timestamp;         /// Time since the start of the trace (in microseconds)
+   const char *argumentName; /// Name of the optional argument (nullptr = no argument)
+   long long argument;       /// Value of the optional argument (e.g. the simulated day)
+};
+
+/**
+ * @brief Events recorded by one thread (one track of the timeline).
+ */
+struct TRACEBUFFER
+{
+   int threadId;
+   std::string threadName;
+   std::vector<TRACEEVENT> events;
+};
+
+/**
+ * @brief Timeline of the simulation phases in the Chrome trace format (viewable with Perfetto or chrome://tracing).
+ *
+ * Enabled by the command line option `--trace <file>`. Scopes are recorded by `TRACESCOPE`
+ * objects (and by the `SCOPEDTIMER` objects of the profiler) for every day step, every phase
+ * of the day step and the input and output stages. Replicates, jobs and branches running on
+ * worker threads and the background writers of the output files are recorded on their own
+ * tracks. Every thread appends its events to its own buffer without locking; all events are
+ * kept in memory and written to the trace file at the end of the run.
+ *
+ * The trace is shared by all threads of the process and is therefore implemented by static members.
+ */
+class TRACE
+{
+public:
+   inline static std::atomic<bool> tracingActivated{false}; /// Scopes are recorded (--trace option given)
+   inline static std::string traceFile;                      /// File the trace is written to
+
+   static bool readCommandLineOptions(const std::vector<std::string> &commandLineInput, const UTILS &utils);
+   static void setThreadName(const std::string &threadName);
+   static void addEvent(const char *name, char phase, const char *argumentName = nullptr, long long argument = 0);
+   static void writeTraceFile(const UTILS &utils);
+
+private:
+   static TRACEBUFFER &getBufferOfThread();
+
+   inline static std::mutex buffersMutex;
+   inline static std::vector<std::unique_ptr<TRACEBUFFER>> buffers;
+   inline static const std::chrono::steady_clock::time_point startTime = std::chrono::steady_clock::now();
+};
+
+/**
+ * @brief Records the begin and end of the enclosing scope in the trace.
+ *
+ * If tracing is not enabled, the scope only checks a flag.
+ */
+class TRACESCOPE
+{
+public:
+   TRACESCOPE(const char *name, const char *argumentName = nullptr, long long argument = 0) : name(TRACE::tracingActivated ? name : nullptr)
+   {
+      if (this->name)
+      {
+         TRACE::addEvent(name, 'B', argumentName, argument);
+      }
+   }
+
+   ~TRACESCOPE()
+   {
+      if (name)
+      {
+         TRACE::addEvent(name, 'E');
+      }
+   }
+
+private:
+   const char *name; /// Name of the recorded scope (nullptr = not recorded)
+};
@@ -0,0 +1,196 @@
+#include "random.h"
+
+RANDOM::RANDOM() {};
+RANDOM::~RANDOM() {};
+
+/**
+ * @brief Returns a uniformly distributed random number in [0, 1).
+ *
+ * The random number is fully determined by the arguments: the seed and the event type
+ * form the key, the simulation day, the stream id (e.g. the id of a plant cohort) and
+ * the draw index (e.g. the index of a plant within the cohort) form the counter.
+ *
+ * @param seed Random number generator seed of the simulation run.
+ * @param day Current simulation day.
+ * @param streamId Identifier of the random stream, e.g. the cohort id of a plant cohort.
+ * @param eventType Type of the stochastic event (see `randomEvent...` constants).
+ * @param drawIndex Index of the draw within the stream, event and day.
+ * @return double Random number in [0, 1) with 53 bits of resolution.
+ */
+double RANDOM::uniform(unsigned int seed, int day, std::uint64_t streamId, int eventType, std::uint32_t drawIndex) const
+{
+   std::array<std::uint32_t, 4> counter = {(std::uint32_t)day, (std::uint32_t)streamId, (std::uint32_t)(streamId >> 32), drawIndex};
+   std::array<std::uint32_t, 2> key = {seed, (std::uint32_t)eventType};
+   std::array<std::uint32_t, 4> bits = philox4x32(counter, key);
+
+   std::uint64_t mantissa = ((((std::uint64_t)bits[0]) << 32) | bits[1]) >> 11;
+   return mantissa * (1.0 / 9007199254740992.0); // 2^-53
+}
+
+/**
+ * @brief Returns a binomially distributed random number, i.e. the number of successes in
+ *        `numberOfTrials` independent Bernoulli trials with success probability `probability`.
+ *
+ * The sample is exact (no normal or Poisson approximation). Small expected numbers of
+ * successes are sampled by inversion via geometric waiting times, larger ones by the
+ * transformed rejection method BTRS. Both consume consecutive draw indices of the random
+ * stream given by the seed, day, stream id and event type.
+ *
+ * @cite Hoermann, W. (1993). The generation of binomial random variates. Journal of
+ *       Statistical Computation and Simulation, 46(1-2), 101-110.
+ *
+ * @param numberOfTrials Number of Bernoulli trials, e.g. plants in a cohort.
+ * @param probability Success probability of each trial, e.g. daily mortality probability.
+ * @param seed Random number generator seed of the simulation run.
+ * @param day Current simulation day.
+ * @param streamId Identifier of the random stream, e.g. the cohort id of a plant cohort.
+ * @param eventType Type of the stochastic event (see `randomEvent...` constants).
+ * @return int Number of successes between 0 and `numberOfTrials`; 0 if the probability is not finite
+ *         (NaN would pass all checks below and the rejection method would never accept a sample).
+ */
+int RANDOM::binomial(int numberOfTrials, double probability, unsigned int seed, int day, std::uint64_t streamId, int eventType) const
+{
+   if (numberOfTrials <= 0 || !std::isfinite(probability) || probability <= 0.0)
+   {
+      return 0;
+   }
+   if (probability >= 1.0)
+   {
+      return numberOfTrials;
+   }
+
+   // both sampling methods require a probability of at most 0.5
+   if (probability > 0.5)
+   {
+      return numberOfTrials - binomial(numberOfTrials, 1.0 - probability, seed, day, streamId, eventType);
+   }
+
+   if (numberOfTrials * probability < 10.0)
+   {
+      return binomialByInversion(numberOfTrials, probability, seed, day, streamId, eventType);
+   }
+   return binomialByTransformedRejection(numberOfTrials, probability, seed, day, streamId, eventType);
+}
+
+/**
+ * @brief Binomial sampling by summing up geometric waiting times between successes.
+ *
+ * The expected number of uniform draws is `numberOfTrials * probability + 1`.
+ */
+int RANDOM::binomialByInversion(int numberOfTrials, double probability, unsigned int seed, int day, std::uint64_t streamId, int eventType) const
+{
+   double logProbabilityOfFailure = std::log1p(-probability);
+   std::uint32_t drawIndex = 0;
+   double sumOfWaitingTimes = 0.0;
+   int numberOfSuccesses = 0;
+
+   while (true)
+   {
+      // 1 - uniform lies in (0, 1], so that the logarithm is finite
+      double randomNumber = 1.0 - uniform(seed, day, streamId, eventType, drawIndex++);
+      sumOfWaitingTimes += std::ceil(std::log(randomNumber) / logProbabilityOfFailure);
+      if (sumOfWaitingTimes > numberOfTrials)
+      {
+         break;
+      }
+      numberOfSuccesses++;
+   }
+   return numberOfSuccesses;
+}
+
+/**
+ * @brief Binomial sampling by the transformed rejection method with squeeze (BTRS).
+ *
+ * Valid for `numberOfTrials * probability >= 10` and `probability <= 0.5`.
+ */
+int RANDOM::binomialByTransformedRejection(int numberOfTrials, double probability, unsigned int seed, int day, std::uint64_t streamId, int eventType) const
+{
+   double n = numberOfTrials;
+   double p = probability;
+   double q = 1.0 - p;
+   double spq = std::sqrt(n * p * q);
+
+   double b = 1.15 + 2.53 * spq;
+   double a = -0.0873 + 0.0248 * b + 0.01 * p;
+   double c = n * p + 0.5;
+   double vr = 0.92 - 4.2 / b;
+   double r = p / q;
+   double alpha = (2.83 + 5.1 / b) * spq;
+   double m = std::floor((n + 1) * p);
+
+   std::uint32_t drawIndex = 0;
+   while (true)
+   {
+      double u = uniform(seed, day, streamId, eventType, drawIndex++) - 0.5;
+      double v = uniform(seed, day, streamId, eventType, drawIndex++);
+      double us = 0.5 - std::fabs(u);
+      double k = std::floor((2.0 * a / us + b) * u + c);
+
+      if (k < 0.0 || k > n)
+      {
+         continue;
+      }
+      // squeeze acceptance
+      if (us >= 0.07 && v <= vr)
+      {
+         return (int)k;
+      }
+
+      v = std::log(v * alpha / (a / (us * us) + b));
+      double upperBound = (m + 0.5) * std::log((m + 1.0) / (r * (n - m + 1.0))) +
+                          (n + 1.0) * std::log((n - m + 1.0) / (n - k + 1.0)) +
+                          (k + 0.5) * std::log(r * (n - k + 1.0) / (k + 1.0)) +
+                          stirlingApproximationTail(m) + stirlingApproximationTail(n - m) -
+                          stirlingApproximationTail(k) - stirlingApproximationTail(n - k);
+      if (v <= upperBound)
+      {
+         return (int)k;
+      }
+   }
+}
+
+/**
+ * @brief Tail of Stirling's approximation, log(k!) - [(k + 0.5) log(k + 1) - (k + 1) + 0.5 log(2 PI)].
+ */
+double RANDOM::stirlingApproximationTail(double k) const
+{
+   static const double tailValues[] = {0.0810614667953272, 0.0413406959554092, 0.0276779256849983,
+                                       0.02079067210376509, 0.0166446911898211, 0.0138761288230707,
+                                       0.0118967099458917, 0.0104112652619720, 0.00925546218271273,
+                                       0.00833056343336287};
+   if (k <= 9)
+   {
+      return tailValues[(int)k];
+   }
+   double kPlusOneSquared = (k + 1.0) * (k + 1.0);
+   return (1.0 / 12 - (1.0 / 360 - 1.0 / 1260 / kPlusOneSquared) / kPlusOneSquared) / (k + 1.0);
+}
+
+/**
+ * @brief Philox4x32-10 bijection of a 128-bit counter under a 64-bit key.
+ *
+ * @param counter Four 32-bit words of the counter.
+ * @param key Two 32-bit words of the key.
+ * @return std::array<std::uint32_t, 4> Four 32-bit random words.
+ */
+std::array<std::uint32_t, 4> RANDOM::philox4x32(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key) const
+{
+   const std::uint32_t multiplier0 = 0xD2511F53;
+   const std::uint32_t multiplier1 = 0xCD9E8D57;
+   const std::uint32_t weyl0 = 0x9E3779B9;
+   const std::uint32_t weyl1 = 0xBB67AE85;
+
+   for (int round = 0; round < 10; round++)
+   {
+      std::uint64_t product0 = (std::uint64_t)multiplier0 * counter[0];
+      std::uint64_t product1 = (std::uint64_t)multiplier1 * counter[2];
+
+      counter = {(std::uint32_t)(product1 >> 32) ^ counter[1] ^ key[0], (std::uint32_t)product1,
+                 (std::uint32_t)(product0 >> 32) ^ counter[3] ^ key[1], (std::uint32_t)product0};
+
+      key[0] += weyl0;
+      key[1] += weyl1;
+   }
+
+   return counter;
+}
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+#include <array>
+#include <cmath>
+
+/// Event types of stochastic processes, used as part of the key of independent random streams
+const int randomEventCrowdingMortality = 0; /// Extra dying plant of a cohort in crowding mortality
+const int randomEventBasicMortality = 1;    /// Death of a single plant in basic mortality
+const int randomEventSeedGermination = 2;   /// Rounding of the number of germinating seeds of a seed cohort
+
+/**
+ * @brief Counter-based random number generator (Philox4x32-10).
+ *
+ * The `RANDOM` class does not hold any state. Every random number is computed directly
+ * from a key (random number generator seed and event type) and a counter (simulation day,
+ * stream id and draw index) by the Philox4x32-10 bijection. Random numbers of different
+ * plant cohorts, days and processes are therefore statistically independent and
+ * reproducible regardless of the order in which cohorts are processed or how many threads
+ * are used.
+ *
+ * @cite Salmon, J. K., Moraes, M. A., Dror, R. O., & Shaw, D. E. (2011). Parallel random numbers:
+ *       as easy as 1, 2, 3. Proceedings of the International Conference for High Performance
+ *       Computing, Networking, Storage and Analysis (SC11).
+ */
+class RANDOM
+{
+public:
+   RANDOM();
+   ~RANDOM();
+
+   double uniform(unsigned int seed, int day, std::uint64_t streamId, int eventType, std::uint32_t drawIndex) const;
+   int binomial(int numberOfTrials, double probability, unsigned int seed, int day, std::uint64_t streamId, int eventType) const;
+   std::array<std::uint32_t, 4> philox4x32(std::array<std::uint32_t, 4> counter, std::array<std::uint32_t, 2> key) const;
+
+private:
+   int binomialByInversion(int numberOfTrials, double probability, unsigned int seed, int day, std::uint64_t streamId, int eventType) const;
+   int binomialByTransformedRejection(int numberOfTrials, double probability, unsigned int seed, int day, std::uint64_t streamId, int eventType) const;
+   double stirlingApproximationTail(double k) const;
+};
\ No newline at end of file
@@ -30,7 +30,7 @@ RECRUITMENT::~RECRUITMENT() {};
  *                   sowing of seeds for plant recruitment.
  * @param soil Reference to a `SOIL` object representing the soil characteristics.
  */
-void RECRUITMENT::doPlantRecruitment(UTILS utils, PARAMETER parameter, ALLOMETRY allometry, COMMUNITY &community, MANAGEMENT management, SOIL &soil)
+void RECRUITMENT::doPlantRecruitment(const UTILS &utils, const PARAMETER &parameter, const ALLOMETRY &allometry, COMMUNITY &community, const MANAGEMENT &management, SOIL &soil)
 {
    // 1. seed influx by different seed sources
    getIncomingSeedsByPlantReproduction(parameter, community);
@@ -43,7 +43,7 @@ void RECRUITMENT::doPlantRecruitment(UTILS utils, PARAMETER parameter, ALLOMETRY
    // 3. seed germination from seed pool accounting for germination times and rates
    calculateSeedGerminationToSeedlings(utils, parameter, allometry, community, soil);
 
-   // 4. Update number of cohorts in allPlants-vector
+   // 4. Update number of cohorts in allPlants-table
    community.totalNumberOfCohortsInCommunity = community.allPlants.size();
 }
 
@@ -67,7 +67,7 @@ void RECRUITMENT::doPlantRecruitment(UTILS utils, PARAMETER parameter, ALLOMETRY
  *                  parameters, including flags and numbers associated
  *                  with the external seed influx.
  */
-void RECRUITMENT::getIncomingSeedsByExternalInflux(PARAMETER parameter)
+void RECRUITMENT::getIncomingSeedsByExternalInflux(const PARAMETER &parameter)
 {
    if (parameter.externalSeedInfluxActivated && parameter.day >= parameter.dayOfExternalSeedInfluxStart)
    {
@@ -88,11 +88,9 @@ void RECRUITMENT::getIncomingSeedsByExternalInflux(PARAMETER parameter)
  * functional type (PFT).
  *
  * The function performs the following operations:
- * - Checks if there are any specified sowing dates in the management
- *   file.
- * - Iterates through the sowing dates to find any that match the
- *   current simulation day.
- * - If a match is found, it updates the `incomingSeeds` vector by
+ * - Gets the management events of the current simulation day from the
+ *   day-indexed management timeline (no scan of all sowing dates).
+ * - For each sowing event, it updates the `incomingSeeds` vector by
  *   adding the amount of seeds sown for each PFT on that day.
  *
  * @param parameter A `PARAMETER` object that contains simulation parameters,
@@ -101,20 +99,16 @@ void RECRUITMENT::getIncomingSeedsByExternalInflux(PARAMETER parameter)
  *                   sowing dates and the corresponding amounts of seeds
  *                   sown for each PFT.
  */
-void RECRUITMENT::getIncomingSeedsBySowing(PARAMETER parameter, MANAGEMENT management)
+void RECRUITMENT::getIncomingSeedsBySowing(const PARAMETER &parameter, const MANAGEMENT &management)
 {
-   if (management.sowingDate.size() > 0)
+   /* for each sowing event of the current day */
+   for (const MANAGEMENTEVENT &event : management.timeline.getEventsOfDay(parameter.day))
    {
-      /* for each sowing day from the management file */
-      for (int sowingDayIndex = 0; sowingDayIndex < management.sowingDate.size(); sowingDayIndex++)
+      if (event.action == MANAGEMENTACTION::sowing)
       {
-         /* if the current day is exactly a sowing day */
-         if (parameter.day == management.sowingDate[sowingDayIndex])
+         for (int pft = 0; pft < parameter.pftCount; pft++)
          {
-            for (int pft = 0; pft < parameter.pftCount; pft++)
-            {
-               incomingSeeds[pft] += management.amountOfSownSeeds[pft][sowingDayIndex];
-            }
+            incomingSeeds[pft] += event.amountOfSownSeeds[pft];
          }
       }
    }
@@ -145,21 +139,21 @@ void RECRUITMENT::getIncomingSeedsBySowing(PARAMETER parameter, MANAGEMENT manag
  * @param community A `COMMUNITY` object that holds information about all
  *                  plants, including their characteristics and biomass.
  */
-void RECRUITMENT::getIncomingSeedsByPlantReproduction(PARAMETER parameter, COMMUNITY &community)
+void RECRUITMENT::getIncomingSeedsByPlantReproduction(const PARAMETER &parameter, COMMUNITY &community)
 {
    int pft, numberOfSeeds;
 
    for (int cohortIndex = 0; cohortIndex < community.totalNumberOfCohortsInCommunity; cohortIndex++)
    {
       /* new plant cohorts are stored at the end of the community vector */
-      pft = community.allPlants[cohortIndex]->pft;
+      pft = community.allPlants.pft[cohortIndex];
 
       /* if plants have reached maturity, their recruitment biomass pool is used for seed production (based on PFT-specific seed mass) */
-      if (community.allPlants[cohortIndex]->height >= parameter.maturityHeights[pft])
+      if (community.allPlants.height[cohortIndex] >= parameter.maturityHeights[pft])
       {
-         if (community.allPlants[cohortIndex]->recruitmentBiomass > 0)
+         if (community.allPlants.recruitmentBiomass[cohortIndex] > 0)
          {
-            numberOfSeeds = (int)floor((community.allPlants[cohortIndex]->recruitmentBiomass / parameter.seedMasses[pft]) + 0.5);
+            numberOfSeeds = (int)floor((community.allPlants.recruitmentBiomass[cohortIndex] / parameter.seedMasses[pft]) + 0.5);
             if (parameter.seedsFromMaturePlantsActivated)
             {
                incomingSeeds[pft] += numberOfSeeds;
@@ -170,9 +164,9 @@ void RECRUITMENT::getIncomingSeedsByPlantReproduction(PARAMETER parameter, COMMU
                incomingSeeds[pft] += 0;
                outgoingSeeds[pft] += numberOfSeeds;
             }
-            community.allPlants[cohortIndex]->recruitmentBiomass = 0;
-            community.allPlants[cohortIndex]->recruitmentCarbon = 0;
-            community.allPlants[cohortIndex]->recruitmentNitrogen = 0;
+            community.allPlants.recruitmentBiomass[cohortIndex] = 0;
+            community.allPlants.recruitmentCarbon[cohortIndex] = 0;
+            community.allPlants.recruitmentNitrogen[cohortIndex] = 0;
          }
       }
    }
@@ -199,7 +193,7 @@ void RECRUITMENT::getIncomingSeedsByPlantReproduction(PARAMETER parameter, COMMU
  *                  including the number of plant functional types (PFTs)
  *                  and their respective germination times.
  */
-void RECRUITMENT::saveIncomingSeedsInSeedPool(PARAMETER parameter)
+void RECRUITMENT::saveIncomingSeedsInSeedPool(const PARAMETER &parameter)
 {
    for (int pft = 0; pft < parameter.pftCount; pft++)
    {
@@ -245,7 +239,7 @@ void RECRUITMENT::saveIncomingSeedsInSeedPool(PARAMETER parameter)
  * @param soil A `SOIL` object that contains information about the soil
  *             environment.
  */
-void RECRUITMENT::calculateSeedGerminationToSeedlings(UTILS utils, PARAMETER parameter, ALLOMETRY allometry, COMMUNITY &community, SOIL &soil)
+void RECRUITMENT::calculateSeedGerminationToSeedlings(const UTILS &utils, const PARAMETER &parameter, const ALLOMETRY &allometry, COMMUNITY &community, SOIL &soil)
 {
    for (int pft = 0; pft < parameter.pftCount; pft++)
    {
@@ -255,7 +249,7 @@ void RECRUITMENT::calculateSeedGerminationToSeedlings(UTILS utils, PARAMETER par
          if (seedGerminationTimeCounter[pft].at(cohortindex) == 0) /* only if counter is 0 seeds are now ready to germinate as seedlings */
          {
             // calculate number of successful germinated seeds from seedpool
-            calculateNumberOfGerminatingSeeds(utils, parameter, community, pft, cohortindex);
+            calculateNumberOfGerminatingSeeds(utils, parameter, pft, cohortindex);
 
             // check if there is enough space left for all seedlings to establish
 
@@ -302,7 +296,7 @@ void RECRUITMENT::calculateSeedGerminationToSeedlings(UTILS utils, PARAMETER par
  * @throw std::runtime_error If the calculated number of successfully
  *                            germinated seeds is negative.
  */
-void RECRUITMENT::calculateNumberOfGerminatingSeeds(UTILS utils, PARAMETER parameter, COMMUNITY &community, int pft, int cohortindex)
+void RECRUITMENT::calculateNumberOfGerminatingSeeds(const UTILS &utils, const PARAMETER &parameter, int pft, int cohortindex)
 {
    int integerPartOfCalculatedNumberOfSeeds;
    double calculatedNumberOfSeeds;
@@ -310,14 +304,13 @@ void RECRUITMENT::calculateNumberOfGerminatingSeeds(UTILS utils, PARAMETER param
    integerPartOfCalculatedNumberOfSeeds = std::floor(calculatedNumberOfSeeds);
 
    double randomNumber = -1;
-   community.randomNumberIndex++;
 
    // stochasticity in ceiling or flooring of the calculated number of germinating seeds if not integer
    if ((calculatedNumberOfSeeds - integerPartOfCalculatedNumberOfSeeds) > 0)
    {
-      std::uniform_real_distribution<> dis(0.0, 1.0);
-      std::mt19937 gen(community.randomNumberIndex); // generator initialized with the incremental variable
-      randomNumber = dis(gen);
+      // random stream of the seed cohort identified by its PFT and index in the seed pool
+      std::uint64_t seedCohortId = ((std::uint64_t)pft << 32) | (std::uint32_t)cohortindex;
+      randomNumber = random.uniform(parameter.randomNumberGeneratorSeed, parameter.day, seedCohortId, randomEventSeedGermination, 0);
       if (randomNumber <= (calculatedNumberOfSeeds - integerPartOfCalculatedNumberOfSeeds))
       {
          successfullGerminatedSeeds.at(pft) = integerPartOfCalculatedNumberOfSeeds + 1;
@@ -338,7 +331,7 @@ void RECRUITMENT::calculateNumberOfGerminatingSeeds(UTILS utils, PARAMETER param
    }
 }
 
-void RECRUITMENT::seedlingCrowdingMortality(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry)
+void RECRUITMENT::seedlingCrowdingMortality(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry)
 {
    double requiredSpaceForNewSeedlings = 0.0;
    double newCoveredAreaOfAllPlants = 0.0;
@@ -399,7 +392,7 @@ void RECRUITMENT::seedlingCrowdingMortality(UTILS utils, PARAMETER parameter, CO
  *                            not match the total seeds, a warning is logged
  *                            for numerical consistency.
  */
-void RECRUITMENT::transferFailedToGerminateSeedsToLitterPool(UTILS utils, PARAMETER parameter, SOIL &soil, int pft, int cohortindex)
+void RECRUITMENT::transferFailedToGerminateSeedsToLitterPool(const UTILS &utils, const PARAMETER &parameter, SOIL &soil, int pft, int cohortindex)
 {
    /* calculate number of failed germinated seeds from seedpool */
    int failedToGerminateSeeds;
@@ -456,10 +449,10 @@ void RECRUITMENT::updateSeedPool(int pft, int cohortindex)
  * @param successfullGerminatedSeeds An integer representing the number of
  *                                    successfully germinated seedlings to be added.
  */
-void RECRUITMENT::addGerminatedSeedlingsToCommunity(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry, int pft)
+void RECRUITMENT::addGerminatedSeedlingsToCommunity(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry, int pft)
 {
    if (successfullGerminatedSeeds.at(pft) > 0)
    {
-      community.allPlants.emplace_back(std::make_shared<PLANT>(utils, parameter, allometry, pft, successfullGerminatedSeeds.at(pft)));
+      community.allPlants.addCohort(PLANT(utils, parameter, allometry, pft, successfullGerminatedSeeds.at(pft)));
    }
 }
@@ -4,8 +4,8 @@
 #include "../module_plant/allometry.h"
 #include "../module_plant/community.h"
 #include "../module_soil/soil.h"
+#include "../module_random/random.h"
 #include "../utils/utils.h"
-#include <random>
 
 /**
  * @brief Class representing the recruitment processes of plants.
@@ -34,15 +34,18 @@ public:
    /// vector that keeps track of successfully germinated seeds at each time step for each PFT
    std::vector<int> successfullGerminatedSeeds;
 
-   void doPlantRecruitment(UTILS utils, PARAMETER parameter, ALLOMETRY allometry, COMMUNITY &community, MANAGEMENT management, SOIL &soil);
-   void getIncomingSeedsByExternalInflux(PARAMETER parameter);
-   void getIncomingSeedsBySowing(PARAMETER parameter, MANAGEMENT management);
-   void getIncomingSeedsByPlantReproduction(PARAMETER parameter, COMMUNITY &community);
-   void saveIncomingSeedsInSeedPool(PARAMETER parameter);
-   void calculateSeedGerminationToSeedlings(UTILS utils, PARAMETER parameter, ALLOMETRY allometry, COMMUNITY &community, SOIL &soil);
-   void calculateNumberOfGerminatingSeeds(UTILS utils, PARAMETER parameter, COMMUNITY &community, int pft, int cohortindex);
-   void transferFailedToGerminateSeedsToLitterPool(UTILS utils, PARAMETER parameter, SOIL &soil, int pft, int cohortindex);
+   /// Counter-based random number generator for stochastic germination
+   RANDOM random;
+
+   void doPlantRecruitment(const UTILS &utils, const PARAMETER &parameter, const ALLOMETRY &allometry, COMMUNITY &community, const MANAGEMENT &management, SOIL &soil);
+   void getIncomingSeedsByExternalInflux(const PARAMETER &parameter);
+   void getIncomingSeedsBySowing(const PARAMETER &parameter, const MANAGEMENT &management);
+   void getIncomingSeedsByPlantReproduction(const PARAMETER &parameter, COMMUNITY &community);
+   void saveIncomingSeedsInSeedPool(const PARAMETER &parameter);
+   void calculateSeedGerminationToSeedlings(const UTILS &utils, const PARAMETER &parameter, const ALLOMETRY &allometry, COMMUNITY &community, SOIL &soil);
+   void calculateNumberOfGerminatingSeeds(const UTILS &utils, const PARAMETER &parameter, int pft, int cohortindex);
+   void transferFailedToGerminateSeedsToLitterPool(const UTILS &utils, const PARAMETER &parameter, SOIL &soil, int pft, int cohortindex);
    void updateSeedPool(int pft, int cohortindex);
-   void addGerminatedSeedlingsToCommunity(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry, int pft);
-   void seedlingCrowdingMortality(UTILS utils, PARAMETER parameter, COMMUNITY &community, ALLOMETRY allometry);
+   void addGerminatedSeedlingsToCommunity(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry, int pft);
+   void seedlingCrowdingMortality(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community, const ALLOMETRY &allometry);
 };
\ No newline at end of file
@@ -0,0 +1,107 @@
+#include "simulation.h"
+#include <algorithm>
+#include <stdexcept>
+
+/**
+ * @brief Sets up a simulation from in-memory inputs and initializes the community.
+ *
+ * @param parameter Parameters of the simulation, copied into the simulation.
+ * @param weather Weather data, copied into the simulation (the daily driver table is built here).
+ * @param soil Soil data, copied into the simulation.
+ * @param management Management events (referenced, has to outlive the simulation; events added to
+ *                   `management.timeline` in memory require `MANAGEMENTTIMELINE::compileTimeline()`).
+ *
+ * @throws std::invalid_argument If the weather data covers fewer days than the simulation period.
+ */
+SIMULATION::SIMULATION(const PARAMETER &parameter, const WEATHER &weather, const SOIL &soil, const MANAGEMENT &management)
+    : parameter(parameter), weather(weather), management(management), soil(soil),
+      context(utils, this->parameter, this->weather, management, allometry)
+{
+   const WEATHER &data = this->weather;
+   for (std::size_t numberOfDays : {data.dayLength.size(), data.dayTimeAirTemperature.size(), data.fullDayAirTemperature.size(), data.photosyntheticPhotonFluxDensity.size()})
+   {
+      if (numberOfDays < static_cast<std::size_t>(this->parameter.simulationTimeInDays))
+      {
+         throw std::invalid_argument("The weather data covers " + std::to_string(numberOfDays) + " days, the simulation period " + std::to_string(this->parameter.simulationTimeInDays) + " days.");
+      }
+   }
+   this->weather.dailyDrivers.buildDailyDriverTable(this->parameter, this->weather);
+
+   init.initModelSimulation(this->parameter, community, recruitment, this->soil, interaction);
+   lastSimulatedDay = 0;
+};
+
+SIMULATION::~SIMULATION() {};
+
+/**
+ * @brief Simulates the next days of the simulation period.
+ *
+ * The simulation stops at the end of the simulation period, i.e. fewer days are simulated
+ * if less than `numberOfDays` days are left.
+ *
+ * @param numberOfDays Number of days to be simulated.
+ * @return Number of simulated days.
+ */
+int SIMULATION::step(int numberOfDays)
+{
+   int lastDay = std::min(lastSimulatedDay + std::max(numberOfDays, 0), parameter.simulationTimeInDays);
+   int numberOfSimulatedDays = 0;
+   for (int day = lastSimulatedDay + 1; day <= lastDay; day++)
+   {
+      parameter.day = day;
+      dayStep.simulateDay(context, init, community, recruitment, mortality, growth, soil, interaction);
+      community.updateCommunityStateVariablesForOutput(parameter);
+      lastSimulatedDay = day;
+      numberOfSimulatedDays++;
+   }
+   return numberOfSimulatedDays;
+}
+
+/**
+ * @brief Returns the last simulated day as day count from the first simulated day (0 before the first step).
+ */
+int SIMULATION::getDay() const
+{
+   return lastSimulatedDay;
+}
+
+/**
+ * @brief Returns true if all days of the simulation period are simulated.
+ */
+bool SIMULATION::isFinished() const
+{
+   return lastSimulatedDay >= parameter.simulationTimeInDays;
+}
+
+/**
+ * @brief Returns the parameters of the simulation (incl. the current day).
+ */
+const PARAMETER &SIMULATION::getParameter() const
+{
+   return parameter;
+}
+
+/**
+ * @brief Returns the community with its aggregated state variables per PFT (e.g. `shootBiomassOfPlantsPerPFT`)
+ *        and of all plants of the last simulated day.
+ */
+const COMMUNITY &SIMULATION::getCommunity() const
+{
+   return community;
+}
+
+/**
+ * @brief Returns the state variables of all plant cohorts (see `COHORTTABLE`).
+ */
+const COHORTTABLE &SIMULATION::getCohorts() const
+{
+   return community.allPlants;
+}
+
+/**
+ * @brief Returns the soil state of the simulation.
+ */
+const SOIL &SIMULATION::getSoil() const
+{
+   return soil;
+}
@@ -0,0 +1,71 @@
+#pragma once
+#include "../module_parameter/parameter.h"
+#include "../module_weather/weather.h"
+#include "../module_soil/soil.h"
+#include "../module_management/management.h"
+#include "../module_plant/allometry.h"
+#include "../module_plant/community.h"
+#include "../module_plant/cohorttable.h"
+#include "../module_init/init.h"
+#include "../module_step/step.h"
+#include "../module_context/context.h"
+#include "../module_recruitment/recruitment.h"
+#include "../module_mortality/mortality.h"
+#include "../module_growth/growth.h"
+#include "../module_interaction/interaction.h"
+#include "../utils/utils.h"
+
+/**
+ * @brief Step-wise simulation of one site, driven from C++ code without file input or output.
+ *
+ * The `SIMULATION` class is the entry point of the grassmind library for embedding the model
+ * in other programs. It is set up from in-memory input objects (e.g. filled by the caller or
+ * read once with `INPUT::getInputData()`) and simulates a given number of days per call of
+ * `step()`. The state of the community (cohorts and aggregates per PFT) and of the soil can be
+ * read after each call.
+ *
+ * Parameters, weather and soil are copied into the simulation, the daily drivers of the weather
+ * (`WEATHER::dailyDrivers`) are built from the weather data by the constructor. The management is
+ * referenced and has to outlive the simulation (it can be shared by several simulations).
+ *
+ * The PARAMETER object has to be complete as after reading the configuration and plant traits
+ * files, i.e. including the simulation period (`simulationTimeInDays`, `referenceJulianDayStart`).
+ * Simulations are independent of each other and can be run on different threads.
+ */
+class SIMULATION
+{
+public:
+   SIMULATION(const PARAMETER &parameter, const WEATHER &weather, const SOIL &soil, const MANAGEMENT &management);
+   ~SIMULATION();
+
+   SIMULATION(const SIMULATION &) = delete;
+   SIMULATION &operator=(const SIMULATION &) = delete;
+
+   int step(int numberOfDays);
+
+   int getDay() const;
+   bool isFinished() const;
+   const PARAMETER &getParameter() const;
+   const COMMUNITY &getCommunity() const;
+   const COHORTTABLE &getCohorts() const;
+   const SOIL &getSoil() const;
+
+private:
+   UTILS utils;
+   PARAMETER parameter;
+   WEATHER weather;
+   const MANAGEMENT &management;
+   ALLOMETRY allometry;
+   SOIL soil;
+
+   INIT init;
+   STEP dayStep;
+   COMMUNITY community;
+   RECRUITMENT recruitment;
+   MORTALITY mortality;
+   GROWTH growth;
+   INTERACTION interaction;
+
+   SIMULATIONCONTEXT context; /// References the members above, therefore declared last
+   int lastSimulatedDay;      /// Last simulated day (0 before the first step)
+};
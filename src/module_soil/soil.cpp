@@ -3,7 +3,7 @@
 SOIL::SOIL() {};
 SOIL::~SOIL() {};
 
-void SOIL::transferDyingPlantPartsToLitterPools(PARAMETER parameter, int number, double biomass, int typeOfMaterial, int pft)
+void SOIL::transferDyingPlantPartsToLitterPools(const PARAMETER &parameter, int number, double biomass, int typeOfMaterial, int pft)
 {
    if (typeOfMaterial == 0)
    {
@@ -29,7 +29,7 @@ void SOIL::transferDyingPlantPartsToLitterPools(PARAMETER parameter, int number,
 
 /*
 * @cite Function and code has been reused from the CENTURY4.0 soil model
-void SOIL::calculateSoilCarbonNitrogenWaterDynamics(UTILS utils, PARAMETER parameter, COMMUNITY &community)
+void SOIL::calculateSoilCarbonNitrogenWaterDynamics(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community)
 {
    double aminrl = 0, tcflow = 0;
    const double maxflow = 5000.0 * 1E-06; // in [g/m²]
@@ -172,7 +172,7 @@ void SOIL::calculateSoilCarbonNitrogenWaterDynamics(UTILS utils, PARAMETER param
 }
 
 * @cite Function and code has been reused from the CENTURY4.0 soil model
-double SOIL::calculateTemperatureAndWaterEffectsOnDecomposition(UTILS utils, PARAMETER parameter)
+double SOIL::calculateTemperatureAndWaterEffectsOnDecomposition(const UTILS &utils, const PARAMETER &parameter)
 {
    if (snowContent > 0.0)
    {
@@ -201,7 +201,7 @@ double SOIL::calculateTemperatureAndWaterEffectsOnDecomposition(UTILS utils, PAR
    return (defac);
 }
 
-bool SOIL::decomposable(PARAMETER parameter, double aminrl, std::string type)
+bool SOIL::decomposable(const PARAMETER &parameter, double aminrl, std::string type)
 {
 
    // aminrl in [g/m²]
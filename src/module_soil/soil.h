@@ -157,10 +157,10 @@ public:
 
    double CLeach;
 
-   void transferDyingPlantPartsToLitterPools(PARAMETER parameter, int number, double biomass, int typeOfMaterial, int pft);
-   /*void calculateSoilCarbonNitrogenWaterDynamics(UTILS utils, PARAMETER parameter, COMMUNITY &community);
-   double calculateTemperatureAndWaterEffectsOnDecomposition(UTILS utils, PARAMETER parameter);
-   bool decomposable(PARAMETER parameter, double aminrl, std::string type);
+   void transferDyingPlantPartsToLitterPools(const PARAMETER &parameter, int number, double biomass, int typeOfMaterial, int pft);
+   /*void calculateSoilCarbonNitrogenWaterDynamics(const UTILS &utils, const PARAMETER &parameter, COMMUNITY &community);
+   double calculateTemperatureAndWaterEffectsOnDecomposition(const UTILS &utils, const PARAMETER &parameter);
+   bool decomposable(const PARAMETER &parameter, double aminrl, std::string type);
    void calculateLitterCarbonRespiration(std::string type, std::string dest);
    void calculateLitterNitrogenRespiration(std::string type, std::string dest);
    double calculateLitterNitrogenFlow(std::string type, std::string dest);
@@ -10,42 +10,112 @@ STEP::~STEP() {};
  * by the `parameter.simulationTimeInDays`. For each day in the simulation, it resets specific state variables,
  * performs daily plant processes, updates the community's dynamic state variables, and saves the simulation results.
  *
- * @param utils Utility functions for string manipulation and error handling.
- * @param parameter Reference to a `PARAMETER` object containing simulation parameters,
- *                  including the current day of the simulation.
- * @param init An `INIT` object used for initializing and resetting process variables.
- * @param allometry An `ALLOMETRY` object that contains functions related to allometric
- *                  calculations for plant growth and structure.
+ * The simulation starts at `parameter.day` (1, or the day after the snapshot of a resumed run) and
+ * saves a snapshot of the simulation state every `parameter.checkpointInterval` days.
+ *
+ * @param context Read-only `SIMULATIONCONTEXT` referencing parameters, weather, management,
+ *                allometry and utility functions of the simulation run.
+ * @param parameter Reference to the `PARAMETER` object viewed by the context, used to advance
+ *                  the current day of the simulation.
+ * @param init Reference to an `INIT` object used for initializing and resetting process variables.
  * @param community Reference to a `COMMUNITY` object representing the plant community
  *                  being simulated.
  * @param recruitment Reference to a `RECRUITMENT` object handling the plant recruitment processes
  *                    within the community.
- * @param mortality A `MORTALITY` object that handles plant mortality processes in the community.
- * @param growth A `GROWTH` object that calculates plant growth processes of the community.
- * @param management A `MANAGEMENT` object that performs predefined management regimes.
+ * @param mortality Reference to a `MORTALITY` object that handles plant mortality processes in the community.
+ * @param growth Reference to a `GROWTH` object that calculates plant growth processes of the community.
  * @param soil Reference to a `SOIL` object representing soil characteristics and processes.
+ * @param interaction Reference to an `INTERACTION` object holding the environmental conditions of the day
+ *                    and the light competition between plants.
  * @param output Reference to an `OUTPUT` object for saving simulation results.
  */
-void STEP::runModelSimulation(UTILS utils, PARAMETER &parameter, INIT init, ALLOMETRY allometry, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY mortality, GROWTH growth, MANAGEMENT management, SOIL &soil, WEATHER weather, INTERACTION &interaction, OUTPUT &output)
+void STEP::runModelSimulation(const SIMULATIONCONTEXT &context, PARAMETER &parameter, INIT &init, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY &mortality, GROWTH &growth, SOIL &soil, INTERACTION &interaction, OUTPUT &output)
 {
+   runModelSimulationUntilDay(parameter.simulationTimeInDays, context, parameter, init, community, recruitment, mortality, growth, soil, interaction, output);
+}
+
+/**
+ * @brief Simulates the days from `parameter.day` up to and including `lastDay`.
+ *
+ * Used by `runModelSimulation()` for the entire simulation period and by `FORK` to simulate
+ * the shared spin-up period up to the branch date.
+ *
+ * @param lastDay Last day to be simulated (day count from the first simulated day).
+ * @param context, parameter, init, community, recruitment, mortality, growth, soil, interaction, output
+ *        See `runModelSimulation()`.
+ */
+void STEP::runModelSimulationUntilDay(int lastDay, const SIMULATIONCONTEXT &context, PARAMETER &parameter, INIT &init, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY &mortality, GROWTH &growth, SOIL &soil, INTERACTION &interaction, OUTPUT &output)
+{
+   if (parameter.memorySamplingInterval > 0)
+   {
+      MEMORYMONITOR::allocationCountingActivated = true;
+   }
+
    /* Daily steps to be simulated */
-   for (int day = 1; day <= parameter.simulationTimeInDays; day++)
+   for (int day = parameter.day; day <= lastDay; day++)
    {
       parameter.day = day; // increase day according to for-loop
+      TRACESCOPE dayScope("day", "day", day);
+
+      simulateDay(context, init, community, recruitment, mortality, growth, soil, interaction);
+
+      /* Aggregation of the community only on days with community or PFT output */
+      if (output.isCommunityAggregationDay(day))
+      {
+         SCOPEDTIMER timer(profiler, PHASE::communityOutputAggregation);
+         community.updateCommunityStateVariablesForOutput(parameter);
+      }
+
+      /* Writing of daily output of simulation results */
+      {
+         SCOPEDTIMER timer(profiler, PHASE::outputBuffering);
+         saveSimulationResultsToBuffer(context, community, output);
+      }
+      {
+         SCOPEDTIMER timer(profiler, PHASE::outputWriting);
+         output.writeFullBuffersToOutputFiles();
+      }
 
-      /* Resetting of specific state / process variables of the community */
-      init.initAndResetProcessVariables(parameter, recruitment, community, interaction);
+      /* Snapshot of the simulation state */
+      if (checkpoint.isCheckpointDay(context.parameter))
+      {
+         checkpoint.saveSnapshot(context.utils, parameter, community, recruitment, soil, output);
+      }
+
+      /* Sample of the memory footprint */
+      if (memory.isSamplingDay(context.parameter))
+      {
+         memory.saveMemorySample(context.utils, parameter, community, recruitment, output);
+      }
+   }
+}
 
-      /* Environmental conditions of the day */
-      interaction.getEnvironmentalConditionsOfDay(weather, soil, management, parameter.day);
+/**
+ * @brief Simulates the day `context.parameter.day` without writing output.
+ *
+ * Resets the process variables, gets the environmental conditions of the day, performs
+ * all plant processes and updates the state variables of the community needed by the next day
+ * (the aggregates written to the output files are calculated by `runModelSimulationUntilDay()`
+ * on output days only).
+ * Used by `runModelSimulationUntilDay()` and by `SIMULATION::step()`.
+ *
+ * @param context, init, community, recruitment, mortality, growth, soil, interaction
+ *        See `runModelSimulation()`.
+ */
+void STEP::simulateDay(const SIMULATIONCONTEXT &context, INIT &init, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY &mortality, GROWTH &growth, SOIL &soil, INTERACTION &interaction)
+{
+   /* Resetting of specific state / process variables of the community */
+   init.initAndResetProcessVariables(context.parameter, recruitment, community);
 
-      /* Calculation of ecological and plant processes */
-      doDayStepOfModelSimulation(utils, parameter, allometry, community, recruitment, mortality, growth, interaction, management, soil);
+   /* Environmental conditions of the day */
+   interaction.getEnvironmentalConditionsOfDay(context.weather, soil, context.management, context.parameter.day);
 
-      community.updateCommunityStateVariablesForOutput(parameter);
+   /* Calculation of ecological and plant processes */
+   doDayStepOfModelSimulation(context, community, recruitment, mortality, growth, interaction, soil);
 
-      /* Writing of daily output of simulation results */
-      saveSimulationResultsToBuffer(utils, parameter, community, output);
+   {
+      SCOPEDTIMER timer(profiler, PHASE::communityAggregation);
+      community.updateCommunityStateVariables(context.parameter);
    }
 }
 
@@ -53,41 +123,63 @@ void STEP::runModelSimulation(UTILS utils, PARAMETER &parameter, INIT init, ALLO
  * @brief Performs one day step of all plant processes.
  *
  * This function executes the daily processes for plant dynamics, including recruitment,
- * mortality, and growth.
+ * mortality, cohort fusion and growth.
  *
- * @param utils Utility functions for various operations including error handling.
- * @param parameter Reference to a `PARAMETER` object containing simulation parameters.
- * @param allometry An `ALLOMETRY` object that handles allometric calculations related
- *                  to plant growth and structure.
+ * @param context Read-only `SIMULATIONCONTEXT` referencing parameters, management regimes,
+ *                allometry and utility functions of the simulation run.
  * @param community Reference to a `COMMUNITY` object representing the current state
  *                  of the plant community.
  * @param recruitment Reference to a `RECRUITMENT` object that manages the recruitment
  *                    of new plants into the community.
- * @param mortality A `MORTALITY` object that processes and calculates plant mortality and leaf senescence
+ * @param mortality Reference to a `MORTALITY` object that processes and calculates plant mortality and leaf senescence
  *                  within the community.
- * @param growth A `GROWTH` object responsible for calculating the growth of plants
+ * @param growth Reference to a `GROWTH` object responsible for calculating the growth of plants
  *               in the community.
- * @param management A `MANAGEMENT` object that applies predefined management regimes
- *                   to the community.
+ * @param interaction Reference to an `INTERACTION` object holding the environmental conditions of the day.
  * @param soil Reference to a `SOIL` object that represents the soil characteristics
  *              affecting plant processes.
  */
-void STEP::doDayStepOfModelSimulation(UTILS utils, PARAMETER &parameter, ALLOMETRY allometry, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY mortality, GROWTH growth, INTERACTION &interaction, MANAGEMENT management, SOIL &soil)
+void STEP::doDayStepOfModelSimulation(const SIMULATIONCONTEXT &context, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY &mortality, GROWTH &growth, INTERACTION &interaction, SOIL &soil)
 {
+   const UTILS &utils = context.utils;
+   const PARAMETER &parameter = context.parameter;
+   const ALLOMETRY &allometry = context.allometry;
+
    /* Plant recruitment */
-   recruitment.doPlantRecruitment(utils, parameter, allometry, community, management, soil);
+   {
+      SCOPEDTIMER timer(profiler, PHASE::recruitment);
+      recruitment.doPlantRecruitment(utils, parameter, allometry, community, context.management, soil);
+   }
 
    /* Plant mortality */
-   mortality.doPlantMortality(utils, parameter, community, allometry, growth, interaction, soil);
+   {
+      SCOPEDTIMER timer(profiler, PHASE::mortality);
+      mortality.doPlantMortality(utils, parameter, community, allometry, interaction, soil);
+   }
+
+   /* Cohort fusion */
+   {
+      SCOPEDTIMER timer(profiler, PHASE::fusion);
+      fusion.doCohortFusion(utils, parameter, community);
+   }
 
    /* Calculate light conditions & plant shading */
-   interaction.calculateLightAttenuationAndAvailabilityForPlants(utils, parameter, community, interaction.fullSunLight);
+   {
+      SCOPEDTIMER timer(profiler, PHASE::light);
+      interaction.calculateLightAttenuationAndAvailabilityForPlants(utils, parameter, community, interaction.fullSunLight);
+   }
 
    /* Plant photosynthesis, respiration, NPP and allocation */
-   growth.doPlantGrowth(utils, parameter, community, interaction, allometry, soil);
+   {
+      SCOPEDTIMER timer(profiler, PHASE::growth);
+      growth.doPlantGrowth(utils, parameter, community, interaction, allometry, soil);
+   }
 
    /* Management activities */
-   management.applyManagementRegime(utils, community, allometry, parameter);
+   {
+      SCOPEDTIMER timer(profiler, PHASE::management);
+      context.management.applyManagementRegime(utils, community, allometry, parameter);
+   }
 
    /* Soil resource dynamics */
    // to be added
@@ -103,105 +195,111 @@ void STEP::doDayStepOfModelSimulation(UTILS utils, PARAMETER &parameter, ALLOMET
  * their composition and the number of individual plants. The data is saved
  * conditionally based on whether specific output writing dates are configured.
  *
- * @param parameter A `PARAMETER` object containing simulation parameters such as
- *                  the current day and the number of plant functional types (PFTs).
- * @param community A `COMMUNITY` object that holds the current state of the plant
+ * @param context Read-only `SIMULATIONCONTEXT` whose parameters contain
+ *                the current day and the number of plant functional types (PFTs).
+ * @param community Const reference to a `COMMUNITY` object that holds the current state of the plant
  *                  community, including its composition and number of plants per PFT.
  * @param output Reference to an `OUTPUT` object that manages the output buffer
  *               and handles writing the results to files.
  *
  * The function distinguishes between two cases:
  * - If the `outputWritingDatesFileOpened` is true, results are only saved for
- *   the days specified in `output.outputWritingDates`.
+ *   the days specified in `output.outputWritingDates` (looked up in the day bitmap
+ *   `output.outputWritingDays`).
  * - Otherwise, results for every day of the simulation are stored directly in the
  *   buffer.
+ *
+ * On these days, the results of each output level (community, PFT, plant) are only saved
+ * if the day matches the cadence of the level, and only the selected fields of the level are
+ * formatted (see `OUTPUTSELECTION`). Aggregated fields of the community and PFT level are
+ * accumulated every day and written at the end of each cadence period (see `OUTPUTAGGREGATOR`).
+ *
+ * Dates are taken from the precomputed date table of the output formatter and values
+ * are appended to the text buffers without temporary strings, or to the columns of the
+ * columnar output files (outputFormat `columnar`).
  */
-void STEP::saveSimulationResultsToBuffer(UTILS utils, PARAMETER parameter, COMMUNITY community, OUTPUT &output)
+void STEP::saveSimulationResultsToBuffer(const SIMULATIONCONTEXT &context, const COMMUNITY &community, OUTPUT &output)
 {
-   int day = utils.calculateDateFromDayCount(utils, parameter.day, parameter.referenceJulianDayStart, "day");
-   int month = utils.calculateDateFromDayCount(utils, parameter.day, parameter.referenceJulianDayStart, "month");
-   int year = utils.calculateDateFromDayCount(utils, parameter.day, parameter.referenceJulianDayStart, "year");
-
-   std::string sDay, sMonth, date;
-   sDay = (day < 10) ? ("0" + std::to_string(day)) : std::to_string(day);
-   sMonth = (month < 10) ? ("0" + std::to_string(month)) : std::to_string(month);
-   date = std::to_string(year) + "-" + sMonth + "-" + sDay;
-
-   if (output.outputWritingDatesFileOpened)
-   { /* results only at outputWritinDates are stored in buffer */
-      for (auto day : output.outputWritingDates)
+   const PARAMETER &parameter = context.parameter;
+   const std::string &date = output.formatter.getDate(parameter.day);
+
+   bool isOutputWritingDate = output.isOutputWritingDate(parameter.day);
+
+   /* community level */
+   bool isCommunityOutputDay = output.selectionCommunity.isOutputDay(parameter.day, output.formatter);
+   if (output.selectionCommunity.aggregationActivated)
+   {
+      output.aggregatorCommunity.beginDay();
+      output.aggregatorCommunity.accumulateRow(output.selectionCommunity, 0, community.totalNumberOfPlantsInCommunity, community.leafAreaIndexOfPlantsInCommunity, community.biomassYield);
+      if (isCommunityOutputDay)
       {
-         if (parameter.day == day)
+         if (isOutputWritingDate)
          {
-            output.bufferCommunity << date << "\t" << parameter.day << "\t";
-            output.bufferCommunity << community.totalNumberOfPlantsInCommunity << "\t" << community.leafAreaIndexOfPlantsInCommunity << "\t";
-
-            for (int pft = 0; pft < parameter.pftCount; pft++)
-            {
-               output.bufferPFTPopulation << date << "\t" << parameter.day << "\t" << pft << "\t";
-               output.bufferPFTPopulation << community.pftComposition[pft] << "\t" << community.numberOfPlantsPerPFT[pft] << "\t";
-               output.bufferPFTPopulation << community.coveredAreaOfPlantsPerPFT[pft] << "\t" << community.shootBiomassOfPlantsPerPFT[pft] << "\t";
-               output.bufferPFTPopulation << community.greenShootBiomassOfPlantsPerPFT[pft] << "\t" << community.brownShootBiomassOfPlantsPerPFT[pft] << "\t";
-               output.bufferPFTPopulation << community.clippedShootBiomassOfPlantsPerPFT[pft] << "\t" << community.rootBiomassOfPlantsPerPFT[pft] << "\t";
-               output.bufferPFTPopulation << community.recruitmentBiomassOfPlantsPerPFT[pft] << "\t" << community.exudationBiomassOfPlantsPerPFT[pft] << "\t";
-               output.bufferPFTPopulation << community.gppOfPlantsPerPFT[pft] << "\t" << community.nppOfPlantsPerPFT[pft] << "\t" << community.respirationOfPlantsPerPFT[pft];
-               output.bufferPFTPopulation << std::endl;
-            }
-
-            for (int cohortindex = 0; cohortindex < community.allPlants.size(); cohortindex++)
-            {
-               output.bufferPlant << date << "\t" << parameter.day << "\t" << community.allPlants.at(cohortindex)->pft << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->age << "\t" << community.allPlants.at(cohortindex)->amount << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->height << "\t" << community.allPlants.at(cohortindex)->width << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->lai << "\t" << community.allPlants.at(cohortindex)->coveredArea << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->rootingDepth << "\t" << community.allPlants.at(cohortindex)->numberOfSoilLayersRooting << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->shootBiomass << "\t" << community.allPlants.at(cohortindex)->shootBiomassGreenLeaves << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->shootBiomassBrownLeaves << "\t" << community.allPlants.at(cohortindex)->shootBiomassAboveClippingHeight << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->rootBiomass << "\t" << community.allPlants.at(cohortindex)->recruitmentBiomass << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->exudationBiomass << "\t" << community.allPlants.at(cohortindex)->gpp << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->npp << "\t" << community.allPlants.at(cohortindex)->totalRespiration << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->availableRadiation << "\t" << community.allPlants.at(cohortindex)->shadingIndicator << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->limitingFactorGppWater << "\t" << community.allPlants.at(cohortindex)->limitingFactorNppNitrogen << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->nppAllocationShoot << "\t" << community.allPlants.at(cohortindex)->nppAllocationRoot << "\t";
-               output.bufferPlant << community.allPlants.at(cohortindex)->nppAllocationRecruitment << "\t" << community.allPlants.at(cohortindex)->nppAllocationExudation;
-               output.bufferPlant << std::endl;
-            }
+            output.appendAggregatedRows(output.bufferCommunity, output.columnsCommunity, output.selectionCommunity, output.aggregatorCommunity, date, parameter.day, 1);
          }
+         output.aggregatorCommunity.startNewWindow();
       }
    }
-   else /* daily results stored in buffer */
+   else if (isOutputWritingDate && isCommunityOutputDay)
    {
-      output.bufferCommunity << date << "\t" << parameter.day << "\t";
-      output.bufferCommunity << community.totalNumberOfPlantsInCommunity << "\t" << community.leafAreaIndexOfPlantsInCommunity << std::endl;
+      output.appendRow(output.bufferCommunity, output.columnsCommunity, output.selectionCommunity, date, parameter.day, community.totalNumberOfPlantsInCommunity, community.leafAreaIndexOfPlantsInCommunity, community.biomassYield);
+   }
 
-      for (int pft = 0; pft < parameter.pftCount; pft++)
+   /* PFT level */
+   bool isPFTOutputDay = output.selectionPFTPopulation.isOutputDay(parameter.day, output.formatter);
+   if (output.selectionPFTPopulation.aggregationActivated)
+   {
+      output.aggregatorPFTPopulation.beginDay();
+      forEachPFTPopulationRow(parameter, community, [&](int pft, const auto &...values)
+                              { output.aggregatorPFTPopulation.accumulateRow(output.selectionPFTPopulation, pft, values...); });
+      if (isPFTOutputDay)
       {
-         output.bufferPFTPopulation << date << "\t" << parameter.day << "\t" << pft << "\t" << community.pftComposition[pft] << "\t" << community.numberOfPlantsPerPFT[pft] << "\t";
-         output.bufferPFTPopulation << community.coveredAreaOfPlantsPerPFT[pft] << "\t" << community.shootBiomassOfPlantsPerPFT[pft] << "\t";
-         output.bufferPFTPopulation << community.greenShootBiomassOfPlantsPerPFT[pft] << "\t" << community.brownShootBiomassOfPlantsPerPFT[pft] << "\t";
-         output.bufferPFTPopulation << community.clippedShootBiomassOfPlantsPerPFT[pft] << "\t" << community.rootBiomassOfPlantsPerPFT[pft] << "\t";
-         output.bufferPFTPopulation << community.recruitmentBiomassOfPlantsPerPFT[pft] << "\t" << community.exudationBiomassOfPlantsPerPFT[pft] << "\t";
-         output.bufferPFTPopulation << community.gppOfPlantsPerPFT[pft] << "\t" << community.nppOfPlantsPerPFT[pft] << "\t" << community.respirationOfPlantsPerPFT[pft];
-         output.bufferPFTPopulation << std::endl;
+         if (isOutputWritingDate)
+         {
+            output.appendAggregatedRows(output.bufferPFTPopulation, output.columnsPFTPopulation, output.selectionPFTPopulation, output.aggregatorPFTPopulation, date, parameter.day, parameter.pftCount);
+         }
+         output.aggregatorPFTPopulation.startNewWindow();
       }
+   }
+   else if (isOutputWritingDate && isPFTOutputDay)
+   {
+      forEachPFTPopulationRow(parameter, community, [&](int pft, const auto &...values)
+                              { output.appendRow(output.bufferPFTPopulation, output.columnsPFTPopulation, output.selectionPFTPopulation, date, parameter.day, pft, values...); });
+   }
 
-      for (int cohortindex = 0; cohortindex < community.allPlants.size(); cohortindex++)
-      {
-         output.bufferPlant << date << "\t" << parameter.day << "\t" << community.allPlants.at(cohortindex)->pft << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->age << "\t" << community.allPlants.at(cohortindex)->amount << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->height << "\t" << community.allPlants.at(cohortindex)->width << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->lai << "\t" << community.allPlants.at(cohortindex)->coveredArea << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->rootingDepth << "\t" << community.allPlants.at(cohortindex)->numberOfSoilLayersRooting << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->shootBiomass << "\t" << community.allPlants.at(cohortindex)->shootBiomassGreenLeaves << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->shootBiomassBrownLeaves << "\t" << community.allPlants.at(cohortindex)->shootBiomassAboveClippingHeight << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->rootBiomass << "\t" << community.allPlants.at(cohortindex)->recruitmentBiomass << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->exudationBiomass << "\t" << community.allPlants.at(cohortindex)->gpp << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->npp << "\t" << community.allPlants.at(cohortindex)->totalRespiration << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->availableRadiation << "\t" << community.allPlants.at(cohortindex)->shadingIndicator << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->limitingFactorGppWater << "\t" << community.allPlants.at(cohortindex)->limitingFactorNppNitrogen << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->nppAllocationShoot << "\t" << community.allPlants.at(cohortindex)->nppAllocationRoot << "\t";
-         output.bufferPlant << community.allPlants.at(cohortindex)->nppAllocationRecruitment << "\t" << community.allPlants.at(cohortindex)->nppAllocationExudation;
-         output.bufferPlant << std::endl;
-      }
+   /* plant level */
+   if (isOutputWritingDate && output.selectionPlant.isOutputDay(parameter.day, output.formatter))
+   {
+      savePlantResultsToBuffer(parameter, date, community, output);
+   }
+}
+
+/**
+ * @brief Appends one row per plant cohort to the plant output buffer.
+ *
+ * @param parameter Parameters containing the current day.
+ * @param date Date of the current day (YYYY-MM-DD).
+ * @param community Plant community whose cohorts are written.
+ * @param output `OUTPUT` object holding the buffer and its formatter.
+ */
+void STEP::savePlantResultsToBuffer(const PARAMETER &parameter, const std::string &date, const COMMUNITY &community, OUTPUT &output)
+{
+   const COHORTTABLE &plants = community.allPlants;
+   for (int cohortindex = 0; cohortindex < plants.size(); cohortindex++)
+   {
+      output.appendRow(output.bufferPlant, output.columnsPlant, output.selectionPlant, date, parameter.day, plants.pft[cohortindex],
+                                 plants.age[cohortindex], plants.amount[cohortindex],
+                                 plants.height[cohortindex], plants.width[cohortindex],
+                                 plants.lai[cohortindex], plants.coveredArea[cohortindex],
+                                 plants.rootingDepth[cohortindex], plants.numberOfSoilLayersRooting[cohortindex],
+                                 plants.shootBiomass[cohortindex], plants.shootBiomassGreenLeaves[cohortindex],
+                                 plants.shootBiomassBrownLeaves[cohortindex], plants.shootBiomassAboveClippingHeight[cohortindex],
+                                 plants.rootBiomass[cohortindex], plants.recruitmentBiomass[cohortindex],
+                                 plants.exudationBiomass[cohortindex], plants.gpp[cohortindex],
+                                 plants.npp[cohortindex], plants.totalRespiration[cohortindex],
+                                 plants.availableRadiation[cohortindex], plants.shadingIndicator[cohortindex],
+                                 plants.limitingFactorGppWater[cohortindex], plants.limitingFactorNppNitrogen[cohortindex],
+                                 plants.nppAllocationShoot[cohortindex], plants.nppAllocationRoot[cohortindex],
+                                 plants.nppAllocationRecruitment[cohortindex], plants.nppAllocationExudation[cohortindex]);
    }
 }
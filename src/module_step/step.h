@@ -1,4 +1,5 @@
 #pragma once
+#include "../module_context/context.h"
 #include "../module_parameter/parameter.h"
 #include "../module_init/init.h"
 #include "../module_plant/community.h"
@@ -8,8 +9,12 @@
 #include "../module_recruitment/recruitment.h"
 #include "../module_mortality/mortality.h"
 #include "../module_growth/growth.h"
+#include "../module_fusion/fusion.h"
 #include "../module_management/management.h"
 #include "../module_output/output.h"
+#include "../module_checkpoint/checkpoint.h"
+#include "../module_profile/profiler.h"
+#include "../module_profile/memory.h"
 #include "../utils/utils.h"
 #include <random>
 
@@ -19,7 +24,40 @@ public:
    STEP();
    ~STEP();
 
-   void runModelSimulation(UTILS utils, PARAMETER &parameter, INIT init, ALLOMETRY allometry, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY mortality, GROWTH growth, MANAGEMENT management, SOIL &soil, WEATHER weather, INTERACTION &interaction, OUTPUT &output);
-   void doDayStepOfModelSimulation(UTILS utils, PARAMETER &parameter, ALLOMETRY allometry, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY mortality, GROWTH growth, INTERACTION &interaction, MANAGEMENT management, SOIL &soil);
-   void saveSimulationResultsToBuffer(UTILS utils, PARAMETER parameter, COMMUNITY community, OUTPUT &output);
+   FUSION fusion;         /// Cohort fusion applied after plant mortality
+   CHECKPOINT checkpoint; /// Snapshots of the simulation state for resuming the run
+   PROFILER profiler;     /// Runtimes of the phases of the day step (--profile option)
+   MEMORYMONITOR memory;  /// Samples of the memory footprint (memorySamplingInterval)
+
+   void runModelSimulation(const SIMULATIONCONTEXT &context, PARAMETER &parameter, INIT &init, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY &mortality, GROWTH &growth, SOIL &soil, INTERACTION &interaction, OUTPUT &output);
+   void runModelSimulationUntilDay(int lastDay, const SIMULATIONCONTEXT &context, PARAMETER &parameter, INIT &init, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY &mortality, GROWTH &growth, SOIL &soil, INTERACTION &interaction, OUTPUT &output);
+   void simulateDay(const SIMULATIONCONTEXT &context, INIT &init, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY &mortality, GROWTH &growth, SOIL &soil, INTERACTION &interaction);
+   void doDayStepOfModelSimulation(const SIMULATIONCONTEXT &context, COMMUNITY &community, RECRUITMENT &recruitment, MORTALITY &mortality, GROWTH &growth, INTERACTION &interaction, SOIL &soil);
+   void saveSimulationResultsToBuffer(const SIMULATIONCONTEXT &context, const COMMUNITY &community, OUTPUT &output);
+
+private:
+   /**
+    * @brief Calls a function with the state variables of each plant functional type (PFT) in the order of the PFT output file.
+    *
+    * Used to append the rows of the PFT population output file and to accumulate its aggregated fields.
+    *
+    * @param parameter Parameters containing the number of PFTs.
+    * @param community Plant community whose state variables per PFT are passed.
+    * @param function Callable accepting the PFT and the values of the remaining columns.
+    */
+   template <typename FUNCTION>
+   void forEachPFTPopulationRow(const PARAMETER &parameter, const COMMUNITY &community, FUNCTION function)
+   {
+      for (int pft = 0; pft < parameter.pftCount; pft++)
+      {
+         function(pft, community.pftComposition[pft], community.numberOfPlantsPerPFT[pft],
+                  community.coveredAreaOfPlantsPerPFT[pft], community.shootBiomassOfPlantsPerPFT[pft],
+                  community.greenShootBiomassOfPlantsPerPFT[pft], community.brownShootBiomassOfPlantsPerPFT[pft],
+                  community.clippedShootBiomassOfPlantsPerPFT[pft], community.rootBiomassOfPlantsPerPFT[pft],
+                  community.recruitmentBiomassOfPlantsPerPFT[pft], community.exudationBiomassOfPlantsPerPFT[pft],
+                  community.gppOfPlantsPerPFT[pft], community.nppOfPlantsPerPFT[pft], community.respirationOfPlantsPerPFT[pft],
+                  community.biomassYieldPerPFT[pft]);
+      }
+   }
+   void savePlantResultsToBuffer(const PARAMETER &parameter, const std::string &date, const COMMUNITY &community, OUTPUT &output);
 };
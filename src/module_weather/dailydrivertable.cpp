@@ -0,0 +1,127 @@
+#include "dailydrivertable.h"
+#include "weather.h"
+#include "../module_parameter/parameter.h"
+#include <cmath>
+
+DAILYDRIVERTABLE::DAILYDRIVERTABLE() {};
+DAILYDRIVERTABLE::~DAILYDRIVERTABLE() {};
+
+int DAILYDRIVERTABLE::size() const
+{
+   return (int)secondsOfDaylight.size();
+}
+
+/**
+ * @brief Precomputes the environmental drivers of all days of the weather time series.
+ *
+ * Must be called after the weather file and the plant trait parameters (Q10 values of
+ * respiration) have been read. The expressions are the same as in the former per-cohort
+ * calculations, so that the results are unchanged.
+ *
+ * @param parameter Const reference to a `PARAMETER` object with the temperature response parameters.
+ * @param weather Const reference to a `WEATHER` object with the daily weather data of the simulation period.
+ */
+void DAILYDRIVERTABLE::buildDailyDriverTable(const PARAMETER &parameter, const WEATHER &weather)
+{
+   int numberOfDays = (int)weather.dayLength.size();
+
+   effectOfDayTimeAirTemperatureOnGpp.resize(numberOfDays);
+   effectOfFullDayAirTemperatureOnRespiration.resize(numberOfDays);
+   radiationCorrectionForDayLength.resize(numberOfDays);
+   secondsOfDaylight.resize(numberOfDays);
+   photosyntheticPhotonFluxDensity.resize(numberOfDays);
+
+   for (int dayIndex = 0; dayIndex < numberOfDays; dayIndex++)
+   {
+      double dayLength = weather.dayLength[dayIndex];
+
+      effectOfDayTimeAirTemperatureOnGpp[dayIndex] = calculateEffectOfAirTemperatureOnGPP(weather.dayTimeAirTemperature[dayIndex]);
+      effectOfFullDayAirTemperatureOnRespiration[dayIndex] = calculateEffectOfAirTemperatureOnRespiration(parameter, weather.fullDayAirTemperature[dayIndex]);
+      radiationCorrectionForDayLength[dayIndex] = 24.0 / dayLength; // correct mean daily radiation by daylength hours for photosynthesis
+      secondsOfDaylight[dayIndex] = dayLength * 60 * 60;             // scaling from seconds to day
+      photosyntheticPhotonFluxDensity[dayIndex] = weather.photosyntheticPhotonFluxDensity[dayIndex];
+   }
+}
+
+/**
+ * @brief Calculates the temperature-based reduction factor for gross primary productivity (GPP).
+ *
+ * This function determines how daytime air temperature influences the plant's ability
+ * to photosynthesize. It returns a dimensionless reduction factor between 0 and 1
+ * that scales GPP accordingly.
+ *
+ * The relationship is piecewise linear and defined as follows:
+ * - **For temperatures ≤ -5°C**:      no photosynthesis (factor = 0)
+ * - **Between -5°C and 2°C**:         linear increase from 0 to ~0.2
+ * - **Between 2°C and 10°C**:         linear increase from ~0.2 to 1.0
+ * - **Above 10°C**:                   no limitation (factor = 1.0)
+ *
+ * @param dayTimeAirTemperature  Daytime air temperature in degrees Celsius.
+ *
+ * @return Reduction factor (0.0 – 1.0) for GPP based on air temperature.
+ * @cite Temperature effects are based on publication:
+ *       Schippers & Kropff 2001, Functional Ecology 15, 155–164
+ */
+double DAILYDRIVERTABLE::calculateEffectOfAirTemperatureOnGPP(double dayTimeAirTemperature) const
+{
+   double reductionFactor = 0;
+
+   if (dayTimeAirTemperature <= -5)
+   {
+      reductionFactor = 0;
+   }
+
+   if (dayTimeAirTemperature > -5 && dayTimeAirTemperature <= 2)
+   {
+      reductionFactor = (0.02857 * dayTimeAirTemperature + 0.142);
+   }
+
+   if (dayTimeAirTemperature > 2 && dayTimeAirTemperature <= 10)
+   {
+      reductionFactor = (0.1 * dayTimeAirTemperature);
+   }
+
+   if (dayTimeAirTemperature > 10)
+   {
+      reductionFactor = 1.0;
+   }
+
+   return reductionFactor;
+}
+
+/**
+ * @brief Calculates a temperature-dependent scaling factor for plant respiration.
+ *
+ * This function estimates how air temperature affects the rate of maintenance
+ * respiration using a Q₁₀ temperature response model. The result is a dimensionless
+ * factor used to scale base respiration rates.
+ *
+ * The temperature response is modeled as follows:
+ * - **For T > 15°C**: Q₁₀ model is applied where `Q10` is the base rate and `T_ref` is the reference temperature.
+ * - **For T ≤ 0°C**: Respiration is fully suppressed (factor = 0).
+ * - **For 0°C < T ≤ 15°C**: A linear interpolation from 0 to ~0.5.
+ *
+ * @param parameter      Struct containing plant functional type-specific parameters,
+ *                       including `plantResponseToTemperatureQ10Base` and reference temperature.
+ * @param airTemperature Full-day mean air temperature in degrees Celsius.
+ *
+ * @return Temperature-dependent reduction factor for maintenance respiration (unitless).
+ * @cite Temperature effect is based on publication:
+ *       Schippers & Kropff 2001, Functional Ecology 15, 155–164
+ */
+double DAILYDRIVERTABLE::calculateEffectOfAirTemperatureOnRespiration(const PARAMETER &parameter, double airTemperature) const
+{
+   double reductionFactor = 0;
+
+   if (airTemperature > 15)
+   {
+      double tExponent = (airTemperature - parameter.plantResponseToTemperatureQ10Reference) / 10.0;
+      reductionFactor = std::pow(parameter.plantResponseToTemperatureQ10Base, tExponent);
+   }
+   else if (airTemperature <= 0)
+      reductionFactor = 0;
+   else
+      reductionFactor = 0.03333 * airTemperature;
+
+   return reductionFactor;
+}
\ No newline at end of file
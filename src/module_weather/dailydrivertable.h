@@ -0,0 +1,31 @@
+#pragma once
+#include <vector>
+
+class PARAMETER;
+class WEATHER;
+
+/**
+ * @brief Per-day environmental drivers of the plant processes, precomputed once after reading the weather file.
+ *
+ * The `DAILYDRIVERTABLE` class holds all variables of the plant processes that only depend on
+ * the day of the simulation (and not on the plant cohort) as flat arrays with one entry per
+ * simulated day (index = day - 1). Growth and mortality read the entries of the current day
+ * (see `INTERACTION::getEnvironmentalConditionsOfDay()`) instead of recomputing them for every cohort.
+ */
+class DAILYDRIVERTABLE
+{
+public:
+   DAILYDRIVERTABLE();
+   ~DAILYDRIVERTABLE();
+
+   std::vector<double> effectOfDayTimeAirTemperatureOnGpp;         /// Reduction factor of GPP and leaf senescence by daytime air temperature (-)
+   std::vector<double> effectOfFullDayAirTemperatureOnRespiration; /// Scaling factor of maintenance respiration by full-day air temperature (-)
+   std::vector<double> radiationCorrectionForDayLength;            /// Correction of mean daily radiation to daylight hours (24 / day length)
+   std::vector<double> secondsOfDaylight;                          /// Duration of daylight (in seconds / day)
+   std::vector<double> photosyntheticPhotonFluxDensity;            /// Photosynthetic active radiation (PAR) at full sun light (in µmol(photons)/m²/s)
+
+   int size() const;
+   void buildDailyDriverTable(const PARAMETER &parameter, const WEATHER &weather);
+   double calculateEffectOfAirTemperatureOnGPP(double dayTimeAirTemperature) const;
+   double calculateEffectOfAirTemperatureOnRespiration(const PARAMETER &parameter, double airTemperature) const;
+};
\ No newline at end of file
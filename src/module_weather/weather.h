@@ -1,4 +1,5 @@
 #pragma once
+#include "dailydrivertable.h"
 #include <vector>
 #include <iostream>
 
@@ -64,4 +65,11 @@ public:
     * The values represent the astronomically duration of daylight (from sunrise to sunset, in hours / day).
     */
    std::vector<double> dayLength;
+
+   /**
+    * @brief Per-day drivers of the plant processes derived from the weather data.
+    *
+    * Built once in `INPUT::getInputData()` after reading the weather file.
+    */
+   DAILYDRIVERTABLE dailyDrivers;
 };
\ No newline at end of file
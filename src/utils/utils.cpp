@@ -42,7 +42,7 @@ void UTILS::splitString(std::string str, char separator)
  *
  * @throws std::invalid_argument If the string cannot be converted to a valid boolean.
  */
-bool UTILS::stringToBool(const std::string &str)
+bool UTILS::stringToBool(const std::string &str) const
 {
    // Convert to lower case letters
    std::string lowercaseStr;
@@ -74,7 +74,7 @@ bool UTILS::stringToBool(const std::string &str)
  *
  * @param errorString The error message to be handled.
  */
-void UTILS::handleError(std::string errorString)
+void UTILS::handleError(std::string errorString) const
 {
    try
    {
@@ -94,7 +94,7 @@ void UTILS::handleError(std::string errorString)
  *
  * @param warnString The warning message to be displayed.
  */
-void UTILS::handleWarning(std::string warnString)
+void UTILS::handleWarning(std::string warnString) const
 {
    std::cerr << warnString << std::endl;
 }
@@ -146,7 +146,7 @@ std::string UTILS::getFileEnding(std::string file)
  * @param year The year (e.g., 2024).
  * @return The Julian day number corresponding to the given date.
  */
-int UTILS::calculateJulianDayFromDate(int day, int month, int year)
+int UTILS::calculateJulianDayFromDate(int day, int month, int year) const
 {
    int a = (14 - month) / 12;
    int y = year + 4800 - a;
@@ -168,7 +168,7 @@ int UTILS::calculateJulianDayFromDate(int day, int month, int year)
  * @param startDay The Julian day number of the reference date, from which the counting starts.
  * @return The number of days from the reference date to the given date, starting with 1 for the reference date.
  */
-int UTILS::calculateDayCountFromDate(int day, int month, int year, int startDay)
+int UTILS::calculateDayCountFromDate(int day, int month, int year, int startDay) const
 {
    int dayCount = calculateJulianDayFromDate(day, month, year) - startDay + 1;
    return dayCount;
@@ -190,7 +190,7 @@ int UTILS::calculateDayCountFromDate(int day, int month, int year, int startDay)
  *
  * @note The function accounts for the Gregorian calendar and includes leap year adjustments.
  */
-int UTILS::calculateDateFromDayCount(UTILS utils, int dayCount, int startDay, std::string keywordForReturn)
+int UTILS::calculateDateFromDayCount(const UTILS &utils, int dayCount, int startDay, std::string keywordForReturn) const
 {
    int a = dayCount + startDay - 1 + 32044;
    int b = (4 * a + 3) / 146097;
@@ -234,7 +234,7 @@ int UTILS::calculateDateFromDayCount(UTILS utils, int dayCount, int startDay, st
  *
  * @throws std::invalid_argument If the input string is neither a valid number nor "NaN".
  */
-double UTILS::parseDoubleOrNaN(const std::string &str)
+double UTILS::parseDoubleOrNaN(const std::string &str) const
 {
    std::stringstream ss(str);
    double value;
@@ -272,7 +272,7 @@ double UTILS::parseDoubleOrNaN(const std::string &str)
  *
  * @throws std::invalid_argument If the input string is neither a valid integer nor "NaN".
  */
-int UTILS::parseIntegerOrNaN(const std::string &str)
+int UTILS::parseIntegerOrNaN(const std::string &str) const
 {
    std::stringstream ss(str);
    int value;
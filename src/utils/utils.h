@@ -27,13 +27,13 @@ public:
    std::vector<std::string> strings;
 
    void splitString(std::string str, char separator);
-   bool stringToBool(const std::string &str);
-   void handleError(std::string errorString);
-   void handleWarning(std::string warnString);
+   bool stringToBool(const std::string &str) const;
+   void handleError(std::string errorString) const;
+   void handleWarning(std::string warnString) const;
    std::string getFileEnding(std::string file);
-   int calculateJulianDayFromDate(int day, int month, int year);
-   int calculateDayCountFromDate(int day, int month, int year, int startDay);
-   int calculateDateFromDayCount(UTILS utils, int dayCount, int startDay, std::string keywordForReturn);
-   double parseDoubleOrNaN(const std::string &str);
-   int parseIntegerOrNaN(const std::string &str);
+   int calculateJulianDayFromDate(int day, int month, int year) const;
+   int calculateDayCountFromDate(int day, int month, int year, int startDay) const;
+   int calculateDateFromDayCount(const UTILS &utils, int dayCount, int startDay, std::string keywordForReturn) const;
+   double parseDoubleOrNaN(const std::string &str) const;
+   int parseIntegerOrNaN(const std::string &str) const;
 };